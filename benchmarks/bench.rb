@@ -100,3 +100,117 @@ if Berns.respond_to?(:escape_html)
     x.compare!
   end
 end
+
+if Berns.respond_to?(:escape_html_all)
+  puts '========'
+  puts 'escape_html_all'
+
+  CELLS = Array.new(10_000) { |i| i.even? ? "Cell #{ i } <b>'bold'</b> & more" : "Clean cell number #{ i }" }.freeze
+
+  Benchmark.ips do |x|
+    x.report('map') { CELLS.map { |cell| Berns.escape_html(cell) } }
+    x.report('all') { Berns.escape_html_all(CELLS) }
+    x.report('all without gvl') { Berns.escape_html_all(CELLS, without_gvl: true) }
+
+    x.compare!
+  end
+
+  puts '========'
+  puts 'sanitize_all'
+
+  Benchmark.ips do |x|
+    x.report('map') { CELLS.map { |cell| Berns.sanitize(cell) } }
+    x.report('all') { Berns.sanitize_all(CELLS) }
+    x.report('all without gvl') { Berns.sanitize_all(CELLS, without_gvl: true) }
+
+    x.compare!
+  end
+end
+
+if Berns.respond_to?(:snippet)
+  puts '========'
+  puts 'snippet'
+
+  DOCUMENT = ('<article><h1>Title</h1><p>Some "quoted" <em>text</em> &amp; more.</p></article>' * 1_500).freeze
+
+  Benchmark.ips do |x|
+    x.report('sanitize + truncate + escape') do
+      text = Berns.sanitize(DOCUMENT)
+      text = "#{ text[0, 197] }..." if text.length > 200
+      Berns.escape_html(text)
+    end
+
+    x.report('snippet') { Berns.snippet(DOCUMENT, 200) }
+
+    x.compare!
+  end
+end
+
+if Berns.respond_to?(:collapse_whitespace)
+  puts '========'
+  puts 'collapse_whitespace'
+
+  INDENTED = ("<div>\n  <p>\n    Some indented text\n  </p>\n  <pre>  kept\n  as is</pre>\n</div>\n" * 100).freeze
+  TIGHT = ('<div><p>Some text without extra whitespace</p></div>' * 100).freeze
+
+  Benchmark.ips do |x|
+    x.report('gsub') { INDENTED.gsub(/\s+/, ' ') }
+    x.report('indented') { Berns.collapse_whitespace(INDENTED) }
+    x.report('tight') { Berns.collapse_whitespace(TIGHT) }
+
+    x.compare!
+  end
+end
+
+if Berns.const_defined?(:Digest)
+  puts '========'
+  puts 'Digest'
+
+  require 'digest/md5'
+
+  PAGE = Berns.build { ul { 2_000.times { |i| li(class: 'item') { "Item #{ i }" } } } }.freeze
+
+  Benchmark.ips do |x|
+    x.report('Digest::MD5') { Digest::MD5.hexdigest(PAGE) }
+    x.report('Berns::Digest') { Berns::Digest.hexdigest(PAGE) }
+
+    x.compare!
+  end
+end
+
+if Berns.const_defined?(:Component)
+  puts '========'
+  puts 'Component'
+
+  AVATAR = proc do |name, size:|
+    span(class: 'avatar') do
+      img(src: "/avatars/#{ name }.png", alt: name, width: size, height: size)
+      span(class: 'avatar-name') { name }
+    end
+  end
+
+  AVATAR_BUILDER = Berns::Builder.new(&AVATAR)
+  AVATAR_COMPONENT = Berns::Component.new(&AVATAR)
+
+  Benchmark.ips do |x|
+    x.report('Builder') { AVATAR_BUILDER.call('alice', size: 32) }
+    x.report('Component') { AVATAR_COMPONENT.call('alice', size: 32) }
+
+    x.compare!
+  end
+end
+
+if Berns.const_defined?(:Sanitizer)
+  puts '========'
+  puts 'Sanitizer'
+
+  COMMENT = <<~HTML
+    <p>Thanks for the <b>great</b> post! See <a href="https://example.com/more" onclick="track()">this</a>
+    and <a href="javascript:alert(1)">that</a>.<script>alert(document.cookie)</script></p>
+    <blockquote cite="https://example.com"><p>Quoted <em>text</em> &amp; more</p></blockquote>
+  HTML
+
+  Benchmark.ips do |x|
+    x.report('comment') { Berns::Sanitizer::DEFAULT.sanitize(COMMENT) }
+  end
+end
@@ -0,0 +1,91 @@
+# frozen_string_literal: true
+$LOAD_PATH.unshift File.expand_path('../lib', __dir__)
+
+require 'berns'
+require 'optparse'
+require_relative 'pages/form'
+require_relative 'pages/layout'
+require_relative 'pages/table'
+
+PAGES = {
+  'table' => Pages::Table,
+  'layout' => Pages::Layout,
+  'form' => Pages::Form
+}.freeze
+
+options = { iterations: 200, pages: PAGES.keys }
+
+OptionParser.new do |parser|
+  parser.banner = 'Usage: pages.rb [options]'
+
+  parser.on('--iterations N', Integer, 'The number of timed renders per page and renderer') do |n|
+    options[:iterations] = n
+  end
+
+  parser.on('--pages x,y,z', Array, "The pages to render, any of #{ PAGES.keys.join(', ') }") do |pages|
+    options[:pages] = pages
+  end
+
+  parser.on('-h', '--help', 'Prints this help') do
+    puts parser
+    exit
+  end
+end.parse!
+
+# Strip the whitespace between tags that templates like ERB add so output from
+# every renderer can be compared byte for byte.
+def normalize(html)
+  html.gsub(/>\s+</, '><').strip
+end
+
+def percentile(sorted, pct)
+  sorted[((sorted.size - 1) * pct).round]
+end
+
+def clock
+  Process.clock_gettime(Process::CLOCK_MONOTONIC)
+end
+
+puts "Berns #{ Berns::VERSION } / Ruby #{ RUBY_VERSION } / #{ options[:iterations] } iterations"
+
+options[:pages].each do |name|
+  page = PAGES.fetch(name)
+  data = page.data
+  renderers = page::RENDERERS
+  expected = normalize(renderers.values.first.call(data))
+
+  renderers.each do |renderer, render|
+    abort "#{ name }: #{ renderer } output does not match #{ renderers.keys.first }" unless normalize(render.call(data)) == expected
+  end
+
+  puts '========'
+  puts "#{ name } (#{ expected.bytesize } bytes)"
+  puts format('%-16<renderer>s %10<p50>s %10<p90>s %10<p99>s %10<rate>s %14<allocs>s', renderer: '', p50: 'p50 ms', p90: 'p90 ms', p99: 'p99 ms', rate: 'MB/s', allocs: 'allocs/render')
+
+  renderers.each do |renderer, render|
+    [options[:iterations] / 10, 1].max.times { render.call(data) }
+
+    GC.start
+    allocated = GC.stat(:total_allocated_objects)
+    bytes = 0
+
+    times = Array.new(options[:iterations]) do
+      started = clock
+      bytes += render.call(data).bytesize
+      clock - started
+    end
+
+    allocs = (GC.stat(:total_allocated_objects) - allocated) / options[:iterations]
+    times.sort!
+
+    puts format(
+      '%-16<renderer>s %10.3<p50>f %10.3<p90>f %10.3<p99>f %10.1<rate>f %14<allocs>d',
+      renderer: renderer,
+      p50: percentile(times, 0.5) * 1000,
+      p90: percentile(times, 0.9) * 1000,
+      p99: percentile(times, 0.99) * 1000,
+      rate: bytes / times.sum / 1_000_000,
+      allocs: allocs
+    )
+  end
+end
@@ -0,0 +1,95 @@
+# frozen_string_literal: true
+require 'berns'
+require 'cgi/escape'
+require 'erb'
+require 'json'
+
+module Pages
+  # A form with 200 labelled inputs.
+  module Form
+    # @return [Hash]
+    def self.data
+      form = JSON.parse(File.read(File.expand_path('../fixtures/form.json', __dir__)))
+
+      fields = Array.new(200) do |index|
+        field = form['fields'][index % form['fields'].size]
+        id = "#{ field['name'] }_#{ index }"
+
+        input = { type: field['type'], name: id, id: id }
+        input[:value] = field['value'] unless field['value'].empty?
+        input[:placeholder] = field['placeholder'] unless field['placeholder'].empty?
+        input[:required] = true if field['required']
+
+        { 'index' => index, 'id' => id, 'label' => field['label'], 'input' => input }
+      end
+
+      { 'action' => form['action'], 'fields' => fields }
+    end
+
+    # Ruby equivalent of Berns.to_attributes for the flat input hashes above.
+    def self.attributes(attrs)
+      attrs.map { |attr, value| value == true ? attr.to_s : %(#{ attr }="#{ CGI.escapeHTML(value) }") }.join(' ')
+    end
+
+    BUILDER = Berns::Builder.new do |signup|
+      form(action: signup['action'], method: 'post', class: 'signup') do
+        input(type: 'hidden', name: 'authenticity_token', value: 'token')
+
+        signup['fields'].each do |field|
+          div(class: 'field', data: { field: { index: field['index'] } }) do
+            label(for: field['id']) { field['label'] }
+            input(field['input'])
+          end
+        end
+
+        button(type: 'submit') { 'Sign up' }
+      end
+    end
+
+    COMPILED = BUILDER.compile
+
+    def self.builder(form)
+      BUILDER.call(form)
+    end
+
+    def self.compiled(form)
+      COMPILED.call(form)
+    end
+
+    def self.berns(form)
+      Berns.form(action: form['action'], method: 'post', class: 'signup') do
+        Berns.input(type: 'hidden', name: 'authenticity_token', value: 'token') +
+          form['fields'].map do |field|
+            Berns.div(class: 'field', data: { field: { index: field['index'] } }) do
+              Berns.label(for: field['id']) { Berns.escape_html(field['label']) } + Berns.input(field['input'])
+            end
+          end.join +
+          Berns.button(type: 'submit') { 'Sign up' }
+      end
+    end
+
+    def self.cgi(form)
+      html = +'<form action="' << CGI.escapeHTML(form['action']) << '" method="post" class="signup">'
+      html << '<input type="hidden" name="authenticity_token" value="token">'
+
+      form['fields'].each do |field|
+        html << '<div class="field" data-field-index="' << field['index'].to_s << '">'
+        html << '<label for="' << CGI.escapeHTML(field['id']) << '">' << CGI.escapeHTML(field['label']) << '</label>'
+        html << '<input ' << attributes(field['input']) << '>'
+        html << '</div>'
+      end
+
+      html << '<button type="submit">Sign up</button></form>'
+    end
+
+    ERB.new(File.read(File.expand_path('form.erb', __dir__)), trim_mode: '-').def_method(singleton_class, 'erb(form)', 'form.erb')
+
+    RENDERERS = {
+      'Berns::Builder' => method(:builder),
+      'Builder#compile' => method(:compiled),
+      'Berns' => method(:berns),
+      'ERB' => method(:erb),
+      'CGI' => method(:cgi)
+    }.freeze
+  end
+end
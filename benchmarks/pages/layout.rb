@@ -0,0 +1,175 @@
+# frozen_string_literal: true
+require 'berns'
+require 'cgi/escape'
+require 'erb'
+require 'json'
+
+module Pages
+  # A full page layout with nested navigation, an article, and a sidebar.
+  module Layout
+    DOCTYPE = '<!DOCTYPE html>'
+
+    # @return [Hash]
+    def self.data
+      JSON.parse(File.read(File.expand_path('../fixtures/layout.json', __dir__)))
+    end
+
+    def self.nav_class(item)
+      item['active'] ? 'nav-item active' : 'nav-item'
+    end
+
+    BUILDER = Berns::Builder.new do |page|
+      raw DOCTYPE
+
+      html(lang: 'en') do
+        head do
+          meta(charset: 'utf-8')
+          title { page['title'] }
+          meta(name: 'description', content: page['description'])
+          page['stylesheets'].each { |href| link(rel: 'stylesheet', href: href) }
+        end
+
+        body do
+          header(class: 'site-header') do
+            nav(class: 'site-nav', data: { controller: 'navigation', action: 'click->navigation#toggle' }) do
+              ul do
+                page['navigation'].each do |item|
+                  li(class: Layout.nav_class(item)) do
+                    a(href: item['href']) { item['label'] }
+
+                    unless item['children'].empty?
+                      ul(class: 'subnav') do
+                        item['children'].each do |child|
+                          li { a(href: child['href']) { child['label'] } }
+                        end
+                      end
+                    end
+                  end
+                end
+              end
+            end
+          end
+
+          main(class: 'content') do
+            article do
+              h1 { page['article']['heading'] }
+              page['article']['paragraphs'].each { |para| p { para } }
+            end
+
+            aside(class: 'sidebar') do
+              h2 { 'Related' }
+              ul do
+                page['sidebar'].each do |item|
+                  li { a(href: item['href']) { item['label'] } }
+                end
+              end
+            end
+          end
+
+          footer(class: 'site-footer') { p { page['footer'] } }
+        end
+      end
+    end
+
+    COMPILED = BUILDER.compile
+
+    def self.builder(page)
+      BUILDER.call(page)
+    end
+
+    def self.compiled(page)
+      COMPILED.call(page)
+    end
+
+    def self.berns(page)
+      head = Berns.head do
+        Berns.meta(charset: 'utf-8') +
+          Berns.title { Berns.escape_html(page['title']) } +
+          Berns.meta(name: 'description', content: page['description']) +
+          page['stylesheets'].map { |href| Berns.link(rel: 'stylesheet', href: href) }.join
+      end
+
+      navigation = Berns.nav(class: 'site-nav', data: { controller: 'navigation', action: 'click->navigation#toggle' }) do
+        Berns.ul do
+          page['navigation'].map do |item|
+            Berns.li(class: nav_class(item)) do
+              link = Berns.a(href: item['href']) { Berns.escape_html(item['label']) }
+
+              if item['children'].empty?
+                link
+              else
+                link + Berns.ul(class: 'subnav') do
+                  item['children'].map { |child| Berns.li { Berns.a(href: child['href']) { Berns.escape_html(child['label']) } } }.join
+                end
+              end
+            end
+          end.join
+        end
+      end
+
+      content = Berns.main(class: 'content') do
+        Berns.article do
+          Berns.h1 { Berns.escape_html(page['article']['heading']) } +
+            page['article']['paragraphs'].map { |para| Berns.p { Berns.escape_html(para) } }.join
+        end +
+          Berns.aside(class: 'sidebar') do
+            Berns.h2 { 'Related' } +
+              Berns.ul { page['sidebar'].map { |item| Berns.li { Berns.a(href: item['href']) { Berns.escape_html(item['label']) } } }.join }
+          end
+      end
+
+      body = Berns.body do
+        Berns.header(class: 'site-header') { navigation } +
+          content +
+          Berns.footer(class: 'site-footer') { Berns.p { Berns.escape_html(page['footer']) } }
+      end
+
+      DOCTYPE + Berns.html(lang: 'en') { head + body }
+    end
+
+    def self.cgi(page)
+      html = +DOCTYPE
+      html << '<html lang="en"><head><meta charset="utf-8">'
+      html << '<title>' << CGI.escapeHTML(page['title']) << '</title>'
+      html << '<meta name="description" content="' << CGI.escapeHTML(page['description']) << '">'
+      page['stylesheets'].each { |href| html << '<link rel="stylesheet" href="' << CGI.escapeHTML(href) << '">' }
+      html << '</head><body><header class="site-header">'
+      html << '<nav class="site-nav" data-controller="navigation" data-action="click-&gt;navigation#toggle"><ul>'
+
+      page['navigation'].each do |item|
+        html << '<li class="' << nav_class(item) << '"><a href="' << CGI.escapeHTML(item['href']) << '">' << CGI.escapeHTML(item['label']) << '</a>'
+
+        unless item['children'].empty?
+          html << '<ul class="subnav">'
+          item['children'].each do |child|
+            html << '<li><a href="' << CGI.escapeHTML(child['href']) << '">' << CGI.escapeHTML(child['label']) << '</a></li>'
+          end
+          html << '</ul>'
+        end
+
+        html << '</li>'
+      end
+
+      html << '</ul></nav></header><main class="content"><article>'
+      html << '<h1>' << CGI.escapeHTML(page['article']['heading']) << '</h1>'
+      page['article']['paragraphs'].each { |para| html << '<p>' << CGI.escapeHTML(para) << '</p>' }
+      html << '</article><aside class="sidebar"><h2>Related</h2><ul>'
+      page['sidebar'].each do |item|
+        html << '<li><a href="' << CGI.escapeHTML(item['href']) << '">' << CGI.escapeHTML(item['label']) << '</a></li>'
+      end
+      html << '</ul></aside></main>'
+      html << '<footer class="site-footer"><p>' << CGI.escapeHTML(page['footer']) << '</p></footer>'
+      html << '</body></html>'
+    end
+
+    ERB.new(File.read(File.expand_path('layout.erb', __dir__)), trim_mode: '-').def_method(singleton_class, 'erb(page)', 'layout.erb')
+
+    RENDERERS = {
+      'Berns::Builder' => method(:builder),
+      'Builder#compile' => method(:compiled),
+      'Berns' => method(:berns),
+      'ERB' => method(:erb),
+      'CGI' => method(:cgi)
+    }.freeze
+  end
+end
@@ -0,0 +1,101 @@
+# frozen_string_literal: true
+require 'berns'
+require 'cgi/escape'
+require 'erb'
+require 'json'
+
+module Pages
+  # A 10,000 row table of people.
+  module Table
+    HEADERS = %w[ID Name Email City Note].freeze
+
+    # @return [Array<Hash>]
+    def self.data
+      people = JSON.parse(File.read(File.expand_path('../fixtures/people.json', __dir__)))
+
+      Array.new(10_000) do |index|
+        people[index % people.size].merge('id' => (index + 1).to_s)
+      end
+    end
+
+    BUILDER = Berns::Builder.new do |rows|
+      table(class: 'people') do
+        thead do
+          tr do
+            HEADERS.each { |header| th { header } }
+          end
+        end
+
+        tbody do
+          rows.each_with_index do |row, index|
+            tr(id: "person-#{ row['id'] }", class: index.even? ? 'even' : 'odd') do
+              td { row['id'] }
+              td { row['name'] }
+              td { a(href: "mailto:#{ row['email'] }") { row['email'] } }
+              td { row['city'] }
+              td { row['note'] }
+            end
+          end
+        end
+      end
+    end
+
+    COMPILED = BUILDER.compile
+
+    def self.builder(rows)
+      BUILDER.call(rows)
+    end
+
+    def self.compiled(rows)
+      COMPILED.call(rows)
+    end
+
+    def self.berns(rows)
+      head = Berns.thead do
+        Berns.tr { HEADERS.map { |header| Berns.th { Berns.escape_html(header) } }.join }
+      end
+
+      body = Berns.tbody do
+        rows.each_with_index.map do |row, index|
+          Berns.tr(id: "person-#{ row['id'] }", class: index.even? ? 'even' : 'odd') do
+            Berns.td { Berns.escape_html(row['id']) } +
+              Berns.td { Berns.escape_html(row['name']) } +
+              Berns.td { Berns.a(href: "mailto:#{ row['email'] }") { Berns.escape_html(row['email']) } } +
+              Berns.td { Berns.escape_html(row['city']) } +
+              Berns.td { Berns.escape_html(row['note']) }
+          end
+        end.join
+      end
+
+      Berns.table(class: 'people') { head + body }
+    end
+
+    def self.cgi(rows)
+      html = +'<table class="people"><thead><tr>'
+      HEADERS.each { |header| html << '<th>' << CGI.escapeHTML(header) << '</th>' }
+      html << '</tr></thead><tbody>'
+
+      rows.each_with_index do |row, index|
+        html << '<tr id="person-' << CGI.escapeHTML(row['id']) << '" class="' << (index.even? ? 'even' : 'odd') << '">'
+        html << '<td>' << CGI.escapeHTML(row['id']) << '</td>'
+        html << '<td>' << CGI.escapeHTML(row['name']) << '</td>'
+        html << '<td><a href="mailto:' << CGI.escapeHTML(row['email']) << '">' << CGI.escapeHTML(row['email']) << '</a></td>'
+        html << '<td>' << CGI.escapeHTML(row['city']) << '</td>'
+        html << '<td>' << CGI.escapeHTML(row['note']) << '</td>'
+        html << '</tr>'
+      end
+
+      html << '</tbody></table>'
+    end
+
+    ERB.new(File.read(File.expand_path('table.erb', __dir__)), trim_mode: '-').def_method(singleton_class, 'erb(rows)', 'table.erb')
+
+    RENDERERS = {
+      'Berns::Builder' => method(:builder),
+      'Builder#compile' => method(:compiled),
+      'Berns' => method(:berns),
+      'ERB' => method(:erb),
+      'CGI' => method(:cgi)
+    }.freeze
+  end
+end
@@ -0,0 +1,77 @@
+# frozen_string_literal: true
+# The training workload for profile-guided builds, run by ext/berns/extconf.rb
+# with --enable-pgo against an instrumented copy of the extension. It can also
+# be run by hand to time the same mix of calls.
+#
+#   ruby -Ilib benchmarks/pgo.rb [iterations]
+#
+# The mix is meant to look like real pages: mostly String and Symbol attribute
+# values with some booleans, nils, nested data attributes, and JSON, text that
+# is usually clean, and the odd dirty string. Keep it free of dependencies
+# outside the standard library since it runs during gem installation.
+require 'berns'
+
+ITERATIONS = Integer(ARGV.first || 200)
+
+PEOPLE = Array.new(200) do |index|
+  {
+    id: index + 1,
+    name: index % 7 == 0 ? "Name <#{ index }> & \"Co\"" : "Person #{ index }",
+    email: "person#{ index }@example.com",
+    note: index.even? ? 'Clean note text for this row' : "It's a note with <b>markup</b> & entities",
+    admin: index % 5 == 0
+  }
+end.freeze
+
+ROW = Berns::Builder.new do |person|
+  tr(id: "person-#{ person[:id] }", class: person[:admin] ? 'admin' : 'member', data: { id: person[:id], controller: 'row' }) do
+    td { person[:id].to_s }
+    td { person[:name] }
+    td { a(href: "mailto:#{ person[:email] }", class: :email) { person[:email] } }
+    td { text person[:note] }
+    td { input(type: 'checkbox', checked: person[:admin], disabled: nil, name: "admin[#{ person[:id] }]") }
+  end
+end
+
+TABLE = Berns::Builder.new do |people|
+  table(class: 'people', role: :grid) do
+    thead { tr { %w[ID Name Email Note Admin].each { |header| th(scope: 'col') { header } } } }
+    tbody { people.each { |person| raw ROW.call(person) } }
+  end
+end.compile
+
+FORM = Berns::Builder.new do |fields|
+  form(action: '/people', method: 'post', 'accept-charset': 'UTF-8', novalidate: true) do
+    fields.each do |field|
+      div(class: 'field') do
+        label(for: field) { field.capitalize }
+        input(type: 'text', id: field, name: "person[#{ field }]", required: true, autocomplete: 'off', data: { validate: { presence: true, length: 255 } })
+      end
+    end
+
+    button(type: 'submit', class: %w[button primary].join(' ')) { 'Save' }
+  end
+end
+
+FIELDS = %w[name email phone street city state zip country].freeze
+TEXTS = PEOPLE.map { |person| person[:note] }.freeze
+DOCUMENT = ('<article><h1>Title</h1><p>Some "quoted" <em>text</em> &amp; more.</p></article>' * 200).freeze
+
+ITERATIONS.times do
+  TABLE.call(PEOPLE)
+  FORM.call(FIELDS)
+
+  PEOPLE.each do |person|
+    Berns.escape_html(person[:name])
+    Berns.sanitize(person[:note])
+    Berns.to_attributes(class: 'card', id: person[:id], hidden: false, title: person[:name])
+    Berns.div(class: 'avatar', data: { config: Berns.json(id: person[:id], tags: %w[a b]) }) { Berns.escape_html(person[:email]) }
+    Berns.img(src: "/avatars/#{ person[:id] }.png", alt: person[:name], width: 32, height: 32)
+  end
+
+  Berns.escape_html_all(TEXTS)
+  Berns.sanitize_all(TEXTS)
+  Berns.snippet(DOCUMENT, 200)
+  Berns.collapse_whitespace(DOCUMENT)
+  Berns::Sanitizer::DEFAULT.sanitize(DOCUMENT)
+end
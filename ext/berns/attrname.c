@@ -0,0 +1,71 @@
+#include <string.h>
+
+#include "attrname.h"
+#include "ruby/st.h"
+#include "strxnew.h"
+
+/*
+ * An upper bound on the number of cached names. Static symbols are never freed
+ * so without this the cache would grow with every symbol we're handed.
+ */
+#define ATTRNAME_CACHE_LIMIT 4096
+
+static st_table *cache = NULL;
+
+/*
+ * Bytes that can't appear in an attribute name, per the HTML spec, plus "<".
+ */
+static const char ATTRNAME_INVALID_TABLE[128] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+bool attrname_valid_p(const char *name, size_t len) {
+	for (size_t i = 0; i < len; i++) {
+		unsigned char c = name[i];
+
+		if (c < 128 && ATTRNAME_INVALID_TABLE[c]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const attrname * attrname_cached(VALUE symbol) {
+	st_data_t found;
+
+	if (!RB_STATIC_SYM_P(symbol)) {
+		return NULL;
+	}
+
+	if (cache == NULL) {
+		cache = st_init_numtable();
+	}
+
+	if (st_lookup(cache, (st_data_t) symbol, &found)) {
+		return (const attrname *) found;
+	}
+
+	VALUE string = rb_sym2str(symbol);
+	size_t len = RSTRING_LEN(string);
+
+	if (cache->num_entries >= ATTRNAME_CACHE_LIMIT || !attrname_valid_p(RSTRING_PTR(string), len)) {
+		return NULL;
+	}
+
+	attrname *name = (attrname *) strxnew(sizeof(attrname) + len + 3);
+	name->length = len;
+	memcpy(name->bytes, RSTRING_PTR(string), len);
+	memcpy(name->bytes + len, "=\"", 3);
+
+	st_insert(cache, (st_data_t) symbol, (st_data_t) name);
+
+	return name;
+}
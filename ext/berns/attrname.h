@@ -0,0 +1,31 @@
+#ifndef ATTRNAME_H
+#define ATTRNAME_H
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ruby.h"
+
+/*
+ * A validated attribute name. bytes holds the name followed by =" and a NUL so
+ * it can be copied as the start of an attribute with a value in one go.
+ */
+typedef struct {
+	size_t length;
+	char bytes[];
+} attrname;
+
+/*
+ * Whether name is safe to use as an HTML attribute name i.e. it contains no
+ * whitespace, control characters, quotes, ">", "<", "/", or "=".
+ */
+extern bool attrname_valid_p(const char *name, size_t len);
+
+/*
+ * Return the cached name for a static Symbol, validating and caching it on
+ * first use. Returns NULL for dynamic Symbols, which may be garbage collected,
+ * once the cache is full, or if the name is invalid; callers should fall back
+ * to validating the name themselves.
+ */
+extern const attrname * attrname_cached(VALUE symbol);
+
+#endif
@@ -1,13 +1,27 @@
 #include <stdbool.h>
 
+#include "attrname.h"
+#include "digest.h"
+#include "escapefile.h"
 #include "hescape.h"
+#include "histogram.h"
+#include "jsonattr.h"
 #include "ruby.h"
+#include "ruby/encoding.h"
+#include "ruby/thread.h"
+#include "probes.h"
+#include "safestring.h"
+#include "sanitizer.h"
+#include "stats.h"
 #include "strxcat.h"
 #include "strxcpy.h"
 #include "strxempty.h"
 #include "strxfree.h"
 #include "strxnew.h"
 #include "strxresize.h"
+#include "timing.h"
+#include "unescape.h"
+#include "whitespace.h"
 
 static const char *attr_close = "\"";
 static const size_t attr_clen = 1;
@@ -30,6 +44,55 @@ static const size_t tag_clen = 1;
 static const char *slash = "/";
 static const size_t sllen = 1;
 
+static VALUE json_value_class;
+
+/*
+ * Batches with at least this many bytes of input release the GVL while
+ * escaping or sanitizing unless told otherwise.
+ */
+static const size_t batch_nogvl_bytes = 1024 * 1024;
+
+/*
+ * The starting size of the buffer for a Hash of attributes, learned per hash
+ * shape (the number of keys, with everything past the last bucket sharing it)
+ * as a moving maximum of the sizes we've produced. Only ever a hint, so it's
+ * fine that concurrent renders might race to update it.
+ */
+#define ATTRIBUTE_SIZE_HINTS 16
+#define ATTRIBUTE_SIZE_DEFAULT 256
+
+static size_t attribute_size_hints[ATTRIBUTE_SIZE_HINTS];
+
+/*
+ * Hashes of attributes nest at most this many levels deep, counting the outer
+ * Hash, which is plenty for data attributes and stops a Hash that contains
+ * itself with an ArgumentError. The starting size of the buffer for the names
+ * of the Hashes we're nested in is ATTRIBUTE_PREFIX_DEFAULT.
+ */
+#define ATTRIBUTE_MAX_DEPTH 32
+#define ATTRIBUTE_PREFIX_DEFAULT 64
+
+/*
+ * A single string in a batch passed to Berns.escape_html_all or
+ * Berns.sanitize_all. src is NULL for nil entries. snapshot is the frozen copy
+ * src points into, or nil, and keeping it here in memory that GC marks
+ * conservatively pins it so compaction can't move it while src is in use.
+ */
+typedef struct {
+	const char *src;
+	size_t slen;
+	char *dest;
+	size_t dlen;
+	bool modified;
+	VALUE snapshot;
+} batch_item;
+
+typedef struct {
+	batch_item *items;
+	long count;
+	char *arena;
+} batch;
+
 
 /*
  * Macro to capture a block's content as a Ruby string into the local variable
@@ -60,13 +123,17 @@ static const size_t sllen = 1;
 		const char *tag = #element_name; \
 		char *string; \
 		\
+		PROBE2(element_start, tag, strlen(tag)); \
+		\
 		if (argc == 1) { \
 			string = void_element_with_attributes(tag, strlen(tag), argv[0]); \
 		} else { \
 			string = void_element_without_attributes(tag, strlen(tag)); \
 		} \
-		VALUE rstring = rb_utf8_str_new_cstr(string); \
+		VALUE rstring = safestring_new(string, strlen(string)); \
 		strxfree(string); \
+		STATS_RECORD(#element_name, 0, RSTRING_LEN(rstring)); \
+		PROBE4(element_done, tag, strlen(tag), 0, RSTRING_LEN(rstring)); \
 		\
 		return rstring; \
 	}
@@ -78,8 +145,10 @@ static const size_t sllen = 1;
 	static VALUE external_##element_name##_element(int argc, VALUE *argv, RB_UNUSED_VAR(VALUE self)) { \
 		rb_check_arity(argc, 0, 1); \
 		\
-		CONTENT_FROM_BLOCK \
 		const char *tag = #element_name; \
+		PROBE2(element_start, tag, strlen(tag)); \
+		\
+		CONTENT_FROM_BLOCK \
 		char *string; \
 		\
 		if (argc == 1) { \
@@ -87,47 +156,38 @@ static const size_t sllen = 1;
 		} else { \
 			string = element_without_attributes(tag, strlen(tag), RSTRING_PTR(content), RSTRING_LEN(content)); \
 		} \
-		VALUE rstring = rb_utf8_str_new_cstr(string); \
+		VALUE rstring = safestring_new(string, strlen(string)); \
 		strxfree(string); \
+		STATS_RECORD(#element_name, RSTRING_LEN(content), RSTRING_LEN(rstring)); \
+		PROBE4(element_done, tag, strlen(tag), RSTRING_LEN(content), RSTRING_LEN(rstring)); \
 		\
 		return rstring; \
 	}
 
 /*
- * The external API for Berns.sanitize
- *
- * string should be a string or nil, anything else will raise an error.
- *
+ * Strip tags and entities from str into dest, returning the length of the
+ * result. dest may be the same as str since we never write ahead of where we
+ * read. modified is set to true if anything was stripped.
  */
-static VALUE external_sanitize(RB_UNUSED_VAR(VALUE self), VALUE string) {
-	if (TYPE(string) == T_NIL) {
-		return Qnil;
-	}
-
-	Check_Type(string, T_STRING);
-
-	size_t slen = RSTRING_LEN(string);
-	char *str = RSTRING_PTR(string);
-
-	char dest[slen + 1];
-
+static size_t sanitize(char *dest, const char *str, const size_t slen, bool *modified) {
 	bool entity = false;
-	bool modified = false;
 	bool open = false;
-	unsigned int index = 0;
+	size_t index = 0;
 
-	for (unsigned int i = 0; i < slen; i++) {
+	*modified = false;
+
+	for (size_t i = 0; i < slen; i++) {
 		switch(str[i]) {
 			case '<':
 				open = true;
-				modified = true;
+				*modified = true;
 				break;
 			case '>':
 				open = false;
 				break;
 			case '&':
 				entity = true;
-				modified = true;
+				*modified = true;
 				break;
 			case ';':
 				entity = false;
@@ -141,7 +201,34 @@ static VALUE external_sanitize(RB_UNUSED_VAR(VALUE self), VALUE string) {
 		}
 	}
 
+	return index;
+}
+
+/*
+ * The external API for Berns.sanitize
+ *
+ * string should be a string or nil, anything else will raise an error.
+ *
+ */
+static VALUE external_sanitize(RB_UNUSED_VAR(VALUE self), VALUE string) {
+	if (TYPE(string) == T_NIL) {
+		return Qnil;
+	}
+
+	Check_Type(string, T_STRING);
+
+	size_t slen = RSTRING_LEN(string);
+	char *str = RSTRING_PTR(string);
+
+	PROBE1(sanitize_start, slen);
+
+	char dest[slen + 1];
+	bool modified;
+	size_t index = sanitize(dest, str, slen, &modified);
+
 	dest[index] = '\0';
+	STATS_RECORD("sanitize", slen, index);
+	PROBE2(sanitize_done, slen, index);
 
 	/*
 	 * If the string was never modified, return the original string, otherwise
@@ -155,30 +242,820 @@ static VALUE external_sanitize(RB_UNUSED_VAR(VALUE self), VALUE string) {
 }
 
 /*
- * The external API for Berns.escape_html.
+ * The external API for Berns.sanitize!
  *
- * Anything other than a string will raise an error.
+ * Like Berns.sanitize but strips the string in place, shrinking it. Returns
+ * nil if nothing was removed, like String#gsub!. Raises a FrozenError if the
+ * string is frozen.
  *
  */
-static VALUE external_escape_html(RB_UNUSED_VAR(VALUE self), VALUE string) {
+static VALUE external_sanitize_bang(RB_UNUSED_VAR(VALUE self), VALUE string) {
+	if (TYPE(string) == T_NIL) {
+		return Qnil;
+	}
+
 	Check_Type(string, T_STRING);
+	rb_str_modify(string);
+
+	char *str = RSTRING_PTR(string);
+	bool modified;
+	size_t index = sanitize(str, str, RSTRING_LEN(string), &modified);
+
+	STATS_RECORD("sanitize!", RSTRING_LEN(string), index);
 
+	if (!modified) {
+		return Qnil;
+	}
+
+	rb_str_set_len(string, index);
+
+	return string;
+}
+
+/*
+ * Escape a string that isn't safe, returning it as-is if it has nothing to
+ * escape.
+ */
+static VALUE escape_html(VALUE string) {
 	uint8_t *dest = NULL;
 	size_t slen = RSTRING_LEN(string);
+
+	PROBE1(escape_html_start, slen);
 	size_t esclen = hesc_escape_html(&dest, RSTRING_PTR(string), slen);
 
 	VALUE rstring;
 
+	STATS_RECORD("escape_html", slen, esclen);
+	PROBE2(escape_html_done, slen, esclen);
+
 	if (esclen > slen) {
-		rstring = rb_utf8_str_new_cstr(dest);
+		STATS_COUNT(escapes_modified, 1);
+		rstring = safestring_new((const char *) dest, esclen);
 		free(dest);
 	} else {
+		STATS_COUNT(escapes_clean, 1);
 		rstring = string;
 	}
 
 	return rstring;
 }
 
+/*
+ * Escape a string that isn't safe while validating it as UTF-8, replacing
+ * invalid sequences with U+FFFD or raising Encoding::InvalidByteSequenceError.
+ * The result is always UTF-8 with its coderange set, and is the string itself
+ * only if it was already UTF-8, or US-ASCII and all ASCII, and neither escaped
+ * nor scrubbed.
+ *
+ * Binary strings, and US-ASCII strings with bytes above 0x7F, are taken to be
+ * UTF-8 bytes, like those read from a socket, and copied before relabelling.
+ * Other ASCII-compatible encodings are transcoded to UTF-8 first, and the rest,
+ * like UTF-16, raise Encoding::CompatibilityError.
+ */
+static VALUE escape_html_utf8(VALUE string, bool replace) {
+	rb_encoding *encoding = rb_enc_get(string);
+	int encindex = ENCODING_GET(string);
+
+	if (!rb_enc_asciicompat(encoding)) {
+		rb_raise(rb_eEncCompatError, "Berns.escape_html invalid: needs an ASCII-compatible string, got %s.", rb_enc_name(encoding));
+	}
+
+	if (encindex != rb_utf8_encindex() && encindex != rb_usascii_encindex() && encindex != rb_ascii8bit_encindex()) {
+		int flags = replace ? ECONV_INVALID_REPLACE | ECONV_UNDEF_REPLACE : 0;
+
+		string = rb_str_encode(string, rb_enc_from_encoding(rb_utf8_encoding()), flags, Qnil);
+		encindex = ENCODING_GET(string);
+	}
+
+	int coderange = ENC_CODERANGE(string);
+	bool utf8 = encindex == rb_utf8_encindex();
+	bool usascii = encindex == rb_usascii_encindex();
+
+	/*
+	 * Ruby has already scanned this string and found it valid, so escaping it
+	 * as usual is enough.
+	 */
+	if ((utf8 || usascii) && (coderange == ENC_CODERANGE_7BIT || coderange == ENC_CODERANGE_VALID)) {
+		VALUE rstring = escape_html(string);
+
+		if (rstring != string) {
+			ENC_CODERANGE_SET(rstring, coderange);
+		}
+
+		return rstring;
+	}
+
+	const uint8_t *str = (const uint8_t *) RSTRING_PTR(string);
+	size_t slen = RSTRING_LEN(string);
+
+	PROBE1(escape_html_start, slen);
+
+	/*
+	 * Scan without writing anything until the first byte that needs escaping or
+	 * scrubbing, so clean strings aren't copied.
+	 */
+	int ascii;
+	size_t clean = hesc_utf8_clean_prefix(str, slen, &ascii);
+	VALUE rstring;
+
+	if (clean == slen) {
+		STATS_RECORD("escape_html", slen, slen);
+		STATS_COUNT(escapes_clean, 1);
+		PROBE2(escape_html_done, slen, slen);
+
+		/*
+		 * The argument's coderange is only set when it's right for its own
+		 * encoding, which isn't the case for US-ASCII with bytes above 0x7F.
+		 */
+		if (utf8 || (usascii && ascii)) {
+			ENC_CODERANGE_SET(string, ascii ? ENC_CODERANGE_7BIT : ENC_CODERANGE_VALID);
+			return string;
+		}
+
+		rstring = rb_utf8_str_new((const char *) str, slen);
+		ENC_CODERANGE_SET(rstring, ascii ? ENC_CODERANGE_7BIT : ENC_CODERANGE_VALID);
+
+		return rstring;
+	}
+
+	hesc_utf8_state state = { clean, clean, ascii, 0, 0 };
+	size_t capacity = slen + (slen >> 3) + HESC_UTF8_SLACK;
+
+	rstring = safestring_buffer(NULL, capacity);
+	memcpy(RSTRING_PTR(rstring), str, clean);
+
+	for (;;) {
+		hesc_escape_html_utf8((uint8_t *) RSTRING_PTR(rstring), capacity, str, slen, replace, &state);
+
+		if (state.invalid) {
+			rb_raise(rb_const_get(rb_cEncoding, rb_intern("InvalidByteSequenceError")), "Berns.escape_html found an invalid UTF-8 byte sequence starting with \\x%02X at byte %zu.", str[state.read], state.read);
+		}
+
+		if (state.read == slen) {
+			break;
+		}
+
+		/*
+		 * Grow by half again, or by enough for the worst case if that's less.
+		 */
+		size_t worst = state.written + (slen - state.read) * HESC_MAX_GROWTH + HESC_UTF8_SLACK;
+		capacity += capacity >> 1;
+		capacity = capacity < worst ? capacity : worst;
+		rb_str_resize(rstring, capacity);
+	}
+
+	RB_GC_GUARD(string);
+	STATS_RECORD("escape_html", slen, state.written);
+	STATS_COUNT(escapes_modified, 1);
+	PROBE2(escape_html_done, slen, state.written);
+
+	rb_str_set_len(rstring, state.written);
+	ENC_CODERANGE_SET(rstring, state.ascii ? ENC_CODERANGE_7BIT : ENC_CODERANGE_VALID);
+
+	return rb_obj_freeze(rstring);
+}
+
+/*
+ * The external API for Berns.escape_html.
+ *
+ * Anything other than a string will raise an error. Accepts an invalid:
+ * keyword of :replace or :raise to validate the string as UTF-8 in the same
+ * pass as escaping it.
+ *
+ * Only escaped output is a Berns::SafeString. A string with nothing to escape
+ * is returned as-is without allocating anything, so it isn't trusted and is
+ * scanned again the next time it's escaped.
+ *
+ */
+static VALUE external_escape_html(int argc, VALUE *argv, RB_UNUSED_VAR(VALUE self)) {
+	VALUE string;
+	VALUE opts = Qnil;
+	VALUE invalid = Qundef;
+	ID keywords[1];
+
+	if (RB_LIKELY(argc == 1)) {
+		string = argv[0];
+	} else {
+		rb_scan_args(argc, argv, "1:", &string, &opts);
+	}
+
+	if (!NIL_P(opts)) {
+		keywords[0] = rb_intern("invalid");
+		rb_get_kwargs(opts, keywords, 0, 1, &invalid);
+	}
+
+	Check_Type(string, T_STRING);
+
+	if (safestring_p(string)) {
+		return string;
+	}
+
+	if (invalid == Qundef || NIL_P(invalid)) {
+		return escape_html(string);
+	}
+
+	if (invalid == ID2SYM(rb_intern("replace"))) {
+		return escape_html_utf8(string, true);
+	}
+
+	if (invalid == ID2SYM(rb_intern("raise"))) {
+		return escape_html_utf8(string, false);
+	}
+
+	rb_raise(rb_eArgError, "Berns.escape_html invalid: must be :replace, :raise, or nil, got %+"PRIsVALUE".", invalid);
+}
+
+/*
+ * The external API for Berns.escape_html!
+ *
+ * Like Berns.escape_html but escapes the string in place, growing it once to
+ * its escaped size. Returns nil if there was nothing to escape, like
+ * String#gsub!. Raises a FrozenError if the string is frozen.
+ *
+ */
+static VALUE external_escape_html_bang(RB_UNUSED_VAR(VALUE self), VALUE string) {
+	Check_Type(string, T_STRING);
+
+	if (safestring_p(string)) {
+		return Qnil;
+	}
+
+	rb_str_modify(string);
+
+	size_t slen = RSTRING_LEN(string);
+	size_t esclen = hesc_escaped_size((const uint8_t *) RSTRING_PTR(string), slen);
+
+	STATS_RECORD("escape_html!", slen, esclen);
+
+	if (esclen == slen) {
+		STATS_COUNT(escapes_clean, 1);
+		return Qnil;
+	}
+
+	STATS_COUNT(escapes_modified, 1);
+
+	rb_str_modify_expand(string, esclen - slen);
+	hesc_escape_html_inplace((uint8_t *) RSTRING_PTR(string), slen, esclen);
+	rb_str_set_len(string, esclen);
+
+	return string;
+}
+
+/*
+ * Escape every item in a batch. Escaped items point to memory allocated by
+ * hesc_escape_html which must be freed. Safe to call without the GVL.
+ */
+static void * escape_batch(void *data) {
+	batch *b = data;
+
+	for (long i = 0; i < b->count; i++) {
+		batch_item *item = &b->items[i];
+		uint8_t *dest = NULL;
+
+		if (item->src == NULL) {
+			continue;
+		}
+
+		item->dlen = hesc_escape_html(&dest, (const uint8_t *) item->src, item->slen);
+		item->dest = (char *) dest;
+		item->modified = item->dlen > item->slen;
+	}
+
+	return NULL;
+}
+
+/*
+ * Sanitize every item in a batch into the batch's arena, which must be at least
+ * as large as the sum of the items' lengths. Safe to call without the GVL.
+ */
+static void * sanitize_batch(void *data) {
+	batch *b = data;
+	char *position = b->arena;
+
+	for (long i = 0; i < b->count; i++) {
+		batch_item *item = &b->items[i];
+
+		if (item->src == NULL) {
+			continue;
+		}
+
+		item->dest = position;
+		item->dlen = sanitize(position, item->src, item->slen, &item->modified);
+
+		if (item->modified) {
+			position += item->dlen;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * A batch and what batch_run needs to turn it into the result, kept together
+ * so batch_free can release its memory even if that raises.
+ */
+typedef struct {
+	batch b;
+	void *(*func)(void *);
+	VALUE strings;
+	VALUE snapshots;
+	bool nogvl;
+	bool sanitizing;
+	size_t total;
+} batch_state;
+
+/*
+ * Run a prepared batch and build the array of results. Unmodified items are
+ * the snapshots that were actually scanned, not whatever is in the caller's
+ * array now, and skipped items are the nils and trusted strings as they were.
+ */
+static VALUE batch_run(VALUE data) {
+	batch_state *state = (batch_state *) data;
+	batch *b = &state->b;
+
+	if (state->nogvl) {
+		rb_thread_call_without_gvl(state->func, b, RUBY_UBF_PROCESS, NULL);
+	} else {
+		state->func(b);
+	}
+
+	VALUE result = rb_ary_new_capa(b->count);
+	size_t written = 0;
+
+	for (long i = 0; i < b->count; i++) {
+		batch_item *item = &b->items[i];
+
+		if (item->src != NULL && !state->sanitizing) {
+			if (item->modified) {
+				STATS_COUNT(escapes_modified, 1);
+			} else {
+				STATS_COUNT(escapes_clean, 1);
+			}
+		}
+
+		if (item->modified) {
+			written += item->dlen;
+
+			if (state->sanitizing) {
+				rb_ary_push(result, rb_utf8_str_new(item->dest, item->dlen));
+			} else {
+				rb_ary_push(result, safestring_new(item->dest, item->dlen));
+				free(item->dest);
+				item->modified = false;
+			}
+		} else {
+			VALUE string = RARRAY_AREF(item->src == NULL ? state->strings : state->snapshots, i);
+
+			written += NIL_P(string) ? 0 : RSTRING_LEN(string);
+			rb_ary_push(result, string);
+		}
+	}
+
+	/* Counted here, with the GVL, since the batch may have run without it. */
+	if (state->sanitizing) {
+		STATS_RECORD("sanitize_all", state->total, written);
+	} else {
+		STATS_RECORD("escape_html_all", state->total, written);
+	}
+
+	return result;
+}
+
+/*
+ * Free the arena and any escaped items batch_run didn't get to.
+ */
+static VALUE batch_free(VALUE data) {
+	batch_state *state = (batch_state *) data;
+	batch *b = &state->b;
+
+	if (!state->sanitizing) {
+		for (long i = 0; i < b->count; i++) {
+			if (b->items[i].modified) {
+				free(b->items[i].dest);
+			}
+		}
+	}
+
+	ruby_xfree(b->arena);
+
+	return Qnil;
+}
+
+/*
+ * Shared implementation of Berns.escape_html_all and Berns.sanitize_all.
+ *
+ * Deciding whether a string is trusted can run Ruby code, and without the GVL
+ * other threads run too, either of which may modify the array or its strings.
+ * So we work from a copy of the array and frozen snapshots of its strings,
+ * taken before anything else, and copy embedded snapshots, whose bytes live
+ * inside the object itself and can be moved by GC, into the arena.
+ *
+ * Pointers into the snapshots are only taken once nothing else can run Ruby
+ * code or allocate, i.e. after every trust check and the arena's allocation.
+ */
+static VALUE batch_apply(VALUE array, VALUE without_gvl, bool allow_nil, void *(*func)(void *)) {
+	Check_Type(array, T_ARRAY);
+
+	VALUE strings = rb_ary_dup(array);
+	long count = RARRAY_LEN(strings);
+	VALUE snapshots = rb_ary_new_capa(count);
+	size_t total = 0;
+	size_t embedded = 0;
+
+	for (long i = 0; i < count; i++) {
+		VALUE string = RARRAY_AREF(strings, i);
+
+		if (allow_nil && NIL_P(string)) {
+			rb_ary_push(snapshots, Qnil);
+			continue;
+		}
+
+		Check_Type(string, T_STRING);
+		rb_ary_push(snapshots, rb_str_new_frozen(string));
+	}
+
+	bool sanitizing = func == sanitize_batch;
+	VALUE tmp;
+	batch_item *items = ALLOCV_N(batch_item, tmp, count);
+
+	/*
+	 * Trusted strings are returned as-is without escaping, just like nils. Ask
+	 * the original strings, since a snapshot doesn't keep their instance
+	 * variables, e.g. the flag behind ActiveSupport::SafeBuffer#html_safe?.
+	 * Items that aren't scanned are left without a snapshot.
+	 */
+	for (long i = 0; i < count; i++) {
+		VALUE string = RARRAY_AREF(strings, i);
+		batch_item *item = &items[i];
+
+		item->src = NULL;
+		item->modified = false;
+		item->snapshot = Qnil;
+
+		if (!NIL_P(string) && (sanitizing || !safestring_p(string))) {
+			item->snapshot = RARRAY_AREF(snapshots, i);
+		}
+	}
+
+	for (long i = 0; i < count; i++) {
+		VALUE snapshot = RARRAY_AREF(snapshots, i);
+
+		if (NIL_P(snapshot)) {
+			continue;
+		}
+
+		total += RSTRING_LEN(snapshot);
+
+		if (!NIL_P(items[i].snapshot) && !FL_TEST_RAW(snapshot, RSTRING_NOEMBED)) {
+			embedded += RSTRING_LEN(snapshot);
+		}
+	}
+
+	bool nogvl = NIL_P(without_gvl) ? total >= batch_nogvl_bytes : RTEST(without_gvl);
+
+	/* Sanitized output is written to the start of the arena, copies after it. */
+	size_t output = sanitizing ? total : 0;
+	size_t copies = nogvl ? embedded : 0;
+
+	char *arena = ruby_xmalloc(output + copies + 1);
+	char *copy = arena + output;
+
+	for (long i = 0; i < count; i++) {
+		batch_item *item = &items[i];
+		VALUE snapshot = item->snapshot;
+
+		if (NIL_P(snapshot)) {
+			continue;
+		}
+
+		item->src = RSTRING_PTR(snapshot);
+		item->slen = RSTRING_LEN(snapshot);
+
+		if (nogvl && !FL_TEST_RAW(snapshot, RSTRING_NOEMBED)) {
+			memcpy(copy, item->src, item->slen);
+			item->src = copy;
+			copy += item->slen;
+		}
+	}
+
+	batch_state state = { { items, count, arena }, func, strings, snapshots, nogvl, sanitizing, total };
+	VALUE result = rb_ensure(batch_run, (VALUE) &state, batch_free, (VALUE) &state);
+
+	ALLOCV_END(tmp);
+	RB_GC_GUARD(strings);
+	RB_GC_GUARD(snapshots);
+
+	return result;
+}
+
+/*
+ * Pull the without_gvl: keyword argument, if any, out of argv.
+ */
+static VALUE batch_arguments(int argc, VALUE *argv, VALUE *array) {
+	VALUE opts;
+	VALUE without_gvl = Qnil;
+	ID keywords[1];
+
+	rb_scan_args(argc, argv, "1:", array, &opts);
+
+	if (!NIL_P(opts)) {
+		keywords[0] = rb_intern("without_gvl");
+		rb_get_kwargs(opts, keywords, 0, 1, &without_gvl);
+
+		if (without_gvl == Qundef) {
+			without_gvl = Qnil;
+		}
+	}
+
+	return without_gvl;
+}
+
+/*
+ * The external API for Berns.escape_html_all.
+ *
+ * array should be an array of strings, otherwise an error is raised. Returns a
+ * new array of escaped strings, reusing frozen snapshots of any that didn't need
+ * escaping.
+ *
+ */
+static VALUE external_escape_html_all(int argc, VALUE *argv, RB_UNUSED_VAR(VALUE self)) {
+	VALUE array;
+	VALUE without_gvl = batch_arguments(argc, argv, &array);
+
+	return batch_apply(array, without_gvl, false, escape_batch);
+}
+
+/*
+ * The external API for Berns.sanitize_all.
+ *
+ * array should be an array of strings or nils, otherwise an error is raised.
+ * Returns a new array of sanitized strings, reusing frozen snapshots of any that
+ * were already clean.
+ *
+ */
+static VALUE external_sanitize_all(int argc, VALUE *argv, RB_UNUSED_VAR(VALUE self)) {
+	VALUE array;
+	VALUE without_gvl = batch_arguments(argc, argv, &array);
+
+	return batch_apply(array, without_gvl, true, sanitize_batch);
+}
+
+/*
+ * The external API for Berns.unescape_html.
+ *
+ * Anything other than a string will raise an error. Returns the string itself
+ * if it has no "&", and otherwise a new UTF-8 string.
+ *
+ */
+static VALUE external_unescape_html(RB_UNUSED_VAR(VALUE self), VALUE string) {
+	Check_Type(string, T_STRING);
+
+	const uint8_t *str = (const uint8_t *) RSTRING_PTR(string);
+	size_t slen = RSTRING_LEN(string);
+
+	if (unescape_find(str, 0, slen) == slen) {
+		STATS_RECORD("unescape_html", slen, slen);
+		return string;
+	}
+
+	bool modified;
+	VALUE rstring = rb_utf8_str_new(NULL, UNESCAPE_MAX_SIZE(slen));
+	size_t index = unescape_html((uint8_t *) RSTRING_PTR(rstring), str, slen, &modified);
+
+	RB_GC_GUARD(string);
+	STATS_RECORD("unescape_html", slen, index);
+
+	if (!modified) {
+		return string;
+	}
+
+	rb_str_resize(rstring, index);
+
+	return rstring;
+}
+
+/*
+ * The external API for Berns.collapse_whitespace.
+ *
+ * string should be a string or nil, anything else will raise an error. Returns
+ * the string itself if there was nothing to collapse.
+ *
+ */
+static VALUE external_collapse_whitespace(RB_UNUSED_VAR(VALUE self), VALUE string) {
+	if (TYPE(string) == T_NIL) {
+		return Qnil;
+	}
+
+	Check_Type(string, T_STRING);
+
+	const uint8_t *str = (const uint8_t *) RSTRING_PTR(string);
+	size_t slen = RSTRING_LEN(string);
+
+	if (ws_collapsible(str, slen) == slen) {
+		STATS_RECORD("collapse_whitespace", slen, slen);
+		return string;
+	}
+
+	bool modified;
+	VALUE rstring = rb_utf8_str_new(NULL, slen);
+	size_t index = ws_collapse((uint8_t *) RSTRING_PTR(rstring), str, slen, &modified);
+
+	RB_GC_GUARD(string);
+	STATS_RECORD("collapse_whitespace", slen, index);
+
+	if (!modified) {
+		return string;
+	}
+
+	rb_str_set_len(rstring, index);
+
+	return rstring;
+}
+
+/*
+ * The length of the UTF-8 codepoint starting at str, or 1 if it isn't valid so
+ * that invalid bytes are counted as single characters.
+ */
+static inline size_t utf8_codepoint_length(const uint8_t *str, const size_t len) {
+	size_t n;
+
+	if (str[0] < 0x80) {
+		return 1;
+	} else if ((str[0] & 0xE0) == 0xC0) {
+		n = 2;
+	} else if ((str[0] & 0xF0) == 0xE0) {
+		n = 3;
+	} else if ((str[0] & 0xF8) == 0xF0) {
+		n = 4;
+	} else {
+		return 1;
+	}
+
+	if (n > len) {
+		return 1;
+	}
+
+	for (size_t i = 1; i < n; i++) {
+		if ((str[i] & 0xC0) != 0x80) {
+			return 1;
+		}
+	}
+
+	return n;
+}
+
+/*
+ * Sanitize, truncate, and escape str into dest in a single pass, the same as
+ * escape_html(truncate(sanitize(str))) but stopping as soon as the text is
+ * known to be too long. limit is measured in characters, or in bytes if bytes
+ * is true, and includes the omission, which is appended escaped when the text
+ * is truncated. Truncation always happens on a codepoint boundary.
+ *
+ * dest must have room for 6 bytes per byte of str that could be kept plus the
+ * escaped omission. Returns the length written to dest.
+ */
+static size_t snippet(uint8_t *dest, const uint8_t *str, const size_t slen, const size_t limit, const uint8_t *omission, const size_t omitlen, const size_t omitunits, const bool bytes) {
+	const size_t keep = omitunits < limit ? limit - omitunits : 0;
+	bool entity = false;
+	bool open = false;
+	size_t units = 0;
+	size_t cut = 0;
+	size_t index = 0;
+
+	for (size_t i = 0; i < slen;) {
+		switch(str[i]) {
+			case '<':
+				open = true;
+				i++;
+				continue;
+			case '>':
+				open = false;
+				i++;
+				continue;
+			case '&':
+				entity = true;
+				i++;
+				continue;
+			case ';':
+				entity = false;
+				i++;
+				continue;
+		}
+
+		if (open || entity) {
+			i++;
+			continue;
+		}
+
+		size_t n = utf8_codepoint_length(str + i, slen - i);
+
+		units += bytes ? n : 1;
+
+		if (units > limit) {
+			size_t esclen = hesc_escaped_size(omission, omitlen);
+
+			memcpy(dest + cut, omission, omitlen);
+			hesc_escape_html_inplace(dest + cut, omitlen, esclen);
+
+			return cut + esclen;
+		}
+
+		/* Only quotes can survive sanitizing, so they're all we escape. */
+		for (size_t j = 0; j < n; j++, i++) {
+			if (str[i] == '"') {
+				memcpy(dest + index, "&quot;", 6);
+				index += 6;
+			} else if (str[i] == '\'') {
+				memcpy(dest + index, "&#39;", 5);
+				index += 5;
+			} else {
+				dest[index++] = str[i];
+			}
+		}
+
+		if (units <= keep) {
+			cut = index;
+		}
+	}
+
+	return index;
+}
+
+/*
+ * The external API for Berns.snippet.
+ *
+ * string should be a string or nil and length a non-negative integer, anything
+ * else will raise an error. Accepts omission: and bytes: keywords.
+ *
+ */
+static VALUE external_snippet(int argc, VALUE *argv, RB_UNUSED_VAR(VALUE self)) {
+	VALUE string;
+	VALUE length;
+	VALUE opts;
+	VALUE values[2] = { Qundef, Qundef };
+	ID keywords[2];
+
+	rb_scan_args(argc, argv, "2:", &string, &length, &opts);
+
+	if (!NIL_P(opts)) {
+		keywords[0] = rb_intern("omission");
+		keywords[1] = rb_intern("bytes");
+		rb_get_kwargs(opts, keywords, 0, 2, values);
+	}
+
+	if (TYPE(string) == T_NIL) {
+		return Qnil;
+	}
+
+	Check_Type(string, T_STRING);
+
+	long limit = NUM2LONG(length);
+
+	if (limit < 0) {
+		rb_raise(rb_eArgError, "Berns.snippet length must not be negative, got %ld.", limit);
+	}
+
+	VALUE omission = values[0] == Qundef ? Qnil : values[0];
+	bool bytes = values[1] != Qundef && RTEST(values[1]);
+
+	const uint8_t *omit = (const uint8_t *) "...";
+	size_t omitlen = 3;
+	size_t omitunits = 3;
+
+	if (!NIL_P(omission)) {
+		Check_Type(omission, T_STRING);
+
+		omit = (const uint8_t *) RSTRING_PTR(omission);
+		omitlen = RSTRING_LEN(omission);
+		omitunits = bytes ? omitlen : (size_t) rb_str_strlen(omission);
+	}
+
+	const uint8_t *str = (const uint8_t *) RSTRING_PTR(string);
+	size_t slen = RSTRING_LEN(string);
+
+	/*
+	 * At most limit characters of at most 4 bytes each are kept, and each kept
+	 * byte escapes to at most 6, so large inputs only need a small buffer.
+	 */
+	size_t perunit = bytes ? 1 : 4;
+	size_t kept = (size_t) limit < slen / perunit ? (size_t) limit * perunit : slen;
+	size_t capacity = (kept + omitlen) * 6;
+
+	VALUE rstring = safestring_buffer(NULL, 0);
+	rb_str_modify_expand(rstring, capacity);
+
+	size_t index = snippet((uint8_t *) RSTRING_PTR(rstring), str, slen, limit, omit, omitlen, omitunits, bytes);
+
+	/* Give back the worst-case room we didn't use. */
+	rb_str_set_len(rstring, index);
+	rb_str_resize(rstring, index);
+	RB_GC_GUARD(string);
+	RB_GC_GUARD(omission);
+	STATS_RECORD("snippet", slen, index);
+
+	return rb_obj_freeze(rstring);
+}
+
 /*
  * Return a freeable piece of memory with a copy of the attribute passed in it.
  * Why does this exist? So we can free the memory created by this without having
@@ -222,140 +1099,333 @@ static char * string_value_to_attribute(const char *attr, const size_t attrlen,
 	}
 }
 
-static char * hash_value_to_attribute(const char *attr, const size_t attrlen, VALUE value) {
-	Check_Type(value, T_HASH);
+/*
+ * One level of a Hash of attributes being serialized: the Hash, its keys, the
+ * index of the next key to write, and the length the prefix had before we
+ * pushed this level's key onto it.
+ */
+typedef struct {
+	VALUE hash;
+	VALUE keys;
+	long index;
+	long length;
+	size_t prefixlen;
+} attribute_frame;
 
-	if (RHASH_SIZE(value) == 0) {
-		return strxempty();
+/*
+ * The output of a Hash of attributes and the prefix shared by every attribute
+ * in the level being written, e.g. "data-user" while writing the pairs of
+ * data: { user: { id: 1, name: 'Name' } }.
+ */
+typedef struct {
+	VALUE hash;
+	char *buffer;
+	size_t length;
+	size_t capacity;
+	char *prefix;
+	size_t prefixlen;
+	size_t prefixcap;
+	int depth;
+	bool finished;
+} attribute_state;
+
+static inline void attribute_reserve(attribute_state *state, size_t size) {
+	size_t needed = state->length + size + 1;
+
+	if (needed > state->capacity) {
+		/* Grow geometrically so large hashes take a handful of reallocations. */
+		size_t capacity = state->capacity * 2;
+
+		if (capacity < needed) {
+			capacity = needed;
+		}
+
+		state->buffer = strxresize(state->buffer, capacity);
+		state->capacity = capacity;
+	}
+}
+
+static inline void attribute_append(attribute_state *state, const char *str, size_t len) {
+	attribute_reserve(state, len);
+	memcpy(state->buffer + state->length, str, len);
+	state->length += len;
+}
+
+/*
+ * Push a key onto the prefix, joined to whatever is already there by a dash.
+ * Popping it is a matter of restoring the old prefixlen.
+ */
+static void attribute_prefix_push(attribute_state *state, const char *key, size_t keylen) {
+	size_t needed = state->prefixlen + dlen + keylen + 1;
+
+	if (needed > state->prefixcap) {
+		size_t capacity = state->prefixcap * 2;
+
+		if (capacity < needed) {
+			capacity = needed;
+		}
+
+		state->prefix = strxresize(state->prefix, capacity);
+		state->prefixcap = capacity;
+	}
+
+	if (state->prefixlen > 0 && keylen > 0) {
+		memcpy(state->prefix + state->prefixlen, dash, dlen);
+		state->prefixlen += dlen;
+	}
+
+	memcpy(state->prefix + state->prefixlen, key, keylen);
+	state->prefixlen += keylen;
+	state->prefix[state->prefixlen] = '\0';
+}
+
+/*
+ * Write the full name of an attribute, the prefix and key joined by a dash.
+ */
+static inline void attribute_name(attribute_state *state, const char *key, size_t keylen) {
+	if (state->prefixlen > 0) {
+		attribute_append(state, state->prefix, state->prefixlen);
+
+		if (keylen > 0) {
+			attribute_append(state, dash, dlen);
+		}
+	}
+
+	attribute_append(state, key, keylen);
+}
+
+/*
+ * Write an attribute with a string value, escaping the value straight into the
+ * output. Top level attributes with a cached name copy it along with its =" in
+ * one go.
+ */
+static void attribute_string(attribute_state *state, const attrname *cached, const char *key, size_t keylen, const char *value, size_t vallen) {
+	if (vallen == 0) {
+		attribute_name(state, key, keylen);
+		return;
 	}
 
-	VALUE subkey;
-	VALUE subvalue;
+	if (cached != NULL && state->prefixlen == 0) {
+		attribute_append(state, cached->bytes, cached->length + attr_eqlen);
+	} else {
+		attribute_name(state, key, keylen);
+		attribute_append(state, attr_equals, attr_eqlen);
+	}
+
+	size_t esclen = hesc_escaped_size((const uint8_t *) value, vallen);
+	attribute_reserve(state, esclen + attr_clen);
+
+	uint8_t *dest = (uint8_t *) state->buffer + state->length;
+	memcpy(dest, value, vallen);
+
+	if (esclen > vallen) {
+		hesc_escape_html_inplace(dest, vallen, esclen);
+	}
+
+	state->length += esclen;
+	attribute_append(state, attr_close, attr_clen);
+}
 
-	const VALUE keys = rb_funcall(value, rb_intern("keys"), 0);
-	const VALUE length = RARRAY_LEN(keys);
+/*
+ * Serialize a Hash of attributes without recursing, keeping a stack of frames
+ * for the nested Hashes we're part way through. Nested Hashes only ever add to
+ * and remove from the end of the shared prefix, so each attribute is written
+ * directly into the output with no intermediate strings.
+ */
+static VALUE attribute_body(VALUE data) {
+	attribute_state *state = (attribute_state *) data;
+	attribute_frame frames[ATTRIBUTE_MAX_DEPTH];
+	int depth = 0;
+
+	frames[0].hash = state->hash;
+	frames[0].keys = rb_funcall(state->hash, rb_intern("keys"), 0);
+	frames[0].index = 0;
+	frames[0].length = RARRAY_LEN(frames[0].keys);
+	frames[0].prefixlen = state->prefixlen;
+
+	while (depth >= 0) {
+		attribute_frame *frame = &frames[depth];
+
+		if (frame->index >= frame->length) {
+			state->prefixlen = frame->prefixlen;
+			depth--;
+			continue;
+		}
 
-	size_t allocated = 256;
-	size_t occupied = 0;
+		const long i = frame->index++;
+		VALUE key = rb_ary_entry(frame->keys, i);
+		VALUE value = rb_hash_aref(frame->hash, key);
 
-	char *destination = strxnew(allocated);
-	char *position = destination;
+		if (i > 0) {
+			attribute_append(state, space, splen);
+		}
 
-	for (unsigned int i = 0; i < length; i++) {
-		subkey = rb_ary_entry(keys, i);
-		subvalue = rb_hash_aref(value, subkey);
+		const attrname *cached = NULL;
+		const char *keyptr = "";
+		size_t keylen = 0;
 
-		switch(TYPE(subkey)) {
+		switch(TYPE(key)) {
 			case T_STRING:
+				keyptr = RSTRING_PTR(key);
+				keylen = RSTRING_LEN(key);
 				break;
 			case T_NIL:
-				subkey = rb_utf8_str_new_cstr("");
 				break;
 			case T_SYMBOL:
-				subkey = rb_sym2str(subkey);
+				cached = attrname_cached(key);
+
+				if (cached != NULL) {
+					keyptr = cached->bytes;
+					keylen = cached->length;
+				} else {
+					VALUE keystr = rb_sym2str(key);
+					keyptr = RSTRING_PTR(keystr);
+					keylen = RSTRING_LEN(keystr);
+				}
+
 				break;
 			default:
-				strxfree(destination);
 				rb_raise(rb_eTypeError, "Berns.to_attribute value keys must be Strings, Symbols, or nil.");
 				break;
 		}
 
-		size_t subattr_len = attrlen;
-		size_t subkey_len = RSTRING_LEN(subkey);
-
-		if (attrlen > 0 && subkey_len > 0) {
-			subattr_len += dlen;
+		if (cached == NULL && !attrname_valid_p(keyptr, keylen)) {
+			rb_raise(rb_eArgError, "Berns.to_attribute value keys must be valid HTML attribute names, got %+"PRIsVALUE".", key);
 		}
 
-		if (subkey_len > 0) {
-			subattr_len += subkey_len;
-		}
-
-		char subattr[subattr_len + 1];
-		char *ptr = subattr;
-		char *subend = subattr + subattr_len + 1;
-
-		if (attrlen > 0) {
-			ptr = strxcat(ptr, attrlen + 1, attr);
-		}
-
-		if (attrlen > 0 && subkey_len > 0) {
-			ptr = strxcat(ptr, dlen + 1, dash);
-		}
-
-		strxcat(ptr, subkey_len + 1, RSTRING_PTR(subkey));
-
-		char *combined;
-
-		switch(TYPE(subvalue)) {
+		switch(TYPE(value)) {
 			case T_FALSE:
-				combined = strxempty();
 				break;
 
 			case T_NIL:
 				/* Fall through. */
 			case T_TRUE:
-				combined = empty_value_to_attribute(subattr, subattr_len);
+				attribute_name(state, keyptr, keylen);
 				break;
 
+			case T_SYMBOL:
+				value = rb_sym2str(value);
+				/* Fall through. */
 			case T_STRING:
-				combined = string_value_to_attribute(subattr, subattr_len, RSTRING_PTR(subvalue), RSTRING_LEN(subvalue));
+				attribute_string(state, cached, keyptr, keylen, RSTRING_PTR(value), RSTRING_LEN(value));
 				break;
 
-			case T_SYMBOL:
-				subvalue = rb_sym2str(subvalue);
-				combined = string_value_to_attribute(subattr, subattr_len, RSTRING_PTR(subvalue), RSTRING_LEN(subvalue));
-				break;
+			case T_HASH: {
+				if (RHASH_SIZE(value) == 0) {
+					break;
+				}
+
+				if (depth + 1 >= ATTRIBUTE_MAX_DEPTH) {
+					rb_raise(rb_eArgError, "Berns.to_attribute value nesting of %d is too deep", depth + 1);
+				}
 
-			case T_HASH:
-				combined = hash_value_to_attribute(subattr, subattr_len, subvalue);
+				attribute_frame *nested = &frames[++depth];
+
+				if (depth > state->depth) {
+					state->depth = depth;
+				}
+
+				nested->hash = value;
+				nested->prefixlen = state->prefixlen;
+				attribute_prefix_push(state, keyptr, keylen);
+				nested->keys = rb_funcall(value, rb_intern("keys"), 0);
+				nested->index = 0;
+				nested->length = RARRAY_LEN(nested->keys);
 				break;
+			}
 
 			default:
-				subvalue = rb_funcall(subvalue, rb_intern("to_s"), 0);
-				combined = string_value_to_attribute(subattr, subattr_len, RSTRING_PTR(subvalue), RSTRING_LEN(subvalue));
+				if (jsonattr_p(value)) {
+					size_t prefixlen = state->prefixlen;
+
+					attribute_prefix_push(state, keyptr, keylen);
+					char *json = jsonattr_to_attribute(state->prefix, state->prefixlen, value);
+					state->prefixlen = prefixlen;
+
+					attribute_append(state, json, strlen(json));
+					strxfree(json);
+					break;
+				}
+
+				value = rb_obj_as_string(value);
+				attribute_string(state, NULL, keyptr, keylen, RSTRING_PTR(value), RSTRING_LEN(value));
 				break;
 		}
 
-		size_t combined_len = strlen(combined);
-		size_t size_to_append = combined_len + 1;
+		RB_GC_GUARD(key);
+		RB_GC_GUARD(value);
+	}
 
-		if (i > 0) {
-			size_to_append += splen;
-		}
+	state->buffer[state->length] = '\0';
+	state->finished = true;
 
-		if ((size_to_append + occupied) > allocated) {
-			/* To avoid an abundance of reallocations, this is a multiple of 256. */
-			double multiple = (double) (size_to_append + occupied) / 256;
-			size_t new_size_to_allocate = (unsigned int) ceil(multiple) * 256;
+	return Qnil;
+}
 
-			char *tmp = strxresize(destination, new_size_to_allocate);
+/*
+ * Free the prefix, and the output too if serialization raised, e.g. from an
+ * invalid key, a #to_s, or a Hash nested too deeply.
+ */
+static VALUE attribute_cleanup(VALUE data) {
+	attribute_state *state = (attribute_state *) data;
 
-			allocated = new_size_to_allocate;
-			destination = tmp;
-			position = destination + occupied;
-		}
+	strxfree(state->prefix);
 
-		if (i > 0) {
-			position = strxcat(position, splen + 1, space);
-			occupied += splen;
-		}
+	if (!state->finished) {
+		strxfree(state->buffer);
+	}
+
+	return Qnil;
+}
 
-		position = strxcat(position, combined_len + 1, combined);
-		occupied += combined_len;
+/*
+ * Convert a Hash of attributes into a string, with the names of attributes in
+ * nested Hashes prefixed by attr and the keys of every Hash they're nested in,
+ * e.g. data: { user: { id: 1 } } becomes data-user-id="1".
+ */
+static char * hash_value_to_attribute(const char *attr, const size_t attrlen, VALUE value) {
+	Check_Type(value, T_HASH);
 
-		strxfree(combined);
+	if (RHASH_SIZE(value) == 0) {
+		return strxempty();
 	}
 
-	/*
-	 * Reallocate destination to final size. This is generally a reduction in the
-	 * allocated memory since we chunk allocations in 256 byte multiples.
-	 */
-	char *rightsizeddest = strxresize(destination, occupied + 1);
+	const size_t length = RHASH_SIZE(value);
+
+	PROBE1(attributes_start, length);
+
+	size_t *hint = &attribute_size_hints[length < ATTRIBUTE_SIZE_HINTS ? length : ATTRIBUTE_SIZE_HINTS - 1];
+
+	attribute_state state = {
+		.hash = value,
+		.length = 0,
+		.capacity = *hint > 0 ? *hint : ATTRIBUTE_SIZE_DEFAULT,
+		.prefixlen = attrlen,
+		.prefixcap = attrlen + ATTRIBUTE_PREFIX_DEFAULT,
+		.depth = 0,
+		.finished = false
+	};
+
+	state.prefix = strxnew(state.prefixcap);
+	state.buffer = strxnew(state.capacity);
+
+	memcpy(state.prefix, attr, attrlen);
+	state.prefix[attrlen] = '\0';
 
-	rightsizeddest[occupied] = '\0';
+	rb_ensure(attribute_body, (VALUE) &state, attribute_cleanup, (VALUE) &state);
 
-	return rightsizeddest;
+	/* Decay by an eighth so one unusually large hash doesn't stick around. */
+	size_t decayed = *hint - (*hint >> 3);
+	*hint = state.length + 1 > decayed ? state.length + 1 : decayed;
+
+	PROBE3(attributes_done, length, state.length, state.depth);
+
+	/*
+	 * Reallocate the buffer to its final size. This is generally a reduction in
+	 * the allocated memory since allocations are sized for the largest recent
+	 * hash.
+	 */
+	return strxresize(state.buffer, state.length + 1);
 }
 
 /*
@@ -372,6 +1442,10 @@ static char * to_attribute(VALUE attr, VALUE value) {
 
 	Check_Type(attr, T_STRING);
 
+	if (!attrname_valid_p(RSTRING_PTR(attr), RSTRING_LEN(attr))) {
+		rb_raise(rb_eArgError, "Berns.to_attribute attribute must be a valid HTML attribute name, got %+"PRIsVALUE".", attr);
+	}
+
 	char *val = NULL;
 	VALUE str;
 
@@ -395,6 +1469,11 @@ static char * to_attribute(VALUE attr, VALUE value) {
 			val = string_value_to_attribute(RSTRING_PTR(attr), RSTRING_LEN(attr), RSTRING_PTR(str), RSTRING_LEN(str));
 			break;
 		default:
+			if (jsonattr_p(value)) {
+				val = jsonattr_to_attribute(RSTRING_PTR(attr), RSTRING_LEN(attr), value);
+				break;
+			}
+
 			str = rb_funcall(value, rb_intern("to_s"), 0);
 			val = string_value_to_attribute(RSTRING_PTR(attr), RSTRING_LEN(attr), RSTRING_PTR(str), RSTRING_LEN(str));
 			break;
@@ -420,6 +1499,7 @@ static VALUE external_to_attribute(RB_UNUSED_VAR(VALUE self), VALUE attr, VALUE
 	char *val = to_attribute(attr, value);
 	VALUE rstring = rb_utf8_str_new_cstr(val);
 	strxfree(val);
+	STATS_RECORD("to_attribute", 0, RSTRING_LEN(rstring));
 
 	return rstring;
 }
@@ -434,12 +1514,14 @@ static VALUE external_to_attributes(RB_UNUSED_VAR(VALUE self), VALUE attributes)
 	Check_Type(attributes, T_HASH);
 
 	if (RHASH_SIZE(attributes) == 0) {
+		STATS_RECORD("to_attributes", 0, 0);
 		return rb_utf8_str_new_cstr("");
 	}
 
 	char *attrs = hash_value_to_attribute("", 0, attributes);
 	VALUE rstring = rb_utf8_str_new_cstr(attrs);
 	strxfree(attrs);
+	STATS_RECORD("to_attributes", 0, RSTRING_LEN(rstring));
 
 	return rstring;
 }
@@ -510,8 +1592,9 @@ static VALUE external_void_element(int argc, VALUE *arguments, RB_UNUSED_VAR(VAL
 		string = void_element_without_attributes(RSTRING_PTR(tag), RSTRING_LEN(tag));
 	}
 
-	VALUE rstring = rb_utf8_str_new_cstr(string);
+	VALUE rstring = safestring_new(string, strlen(string));
 	strxfree(string);
+	STATS_RECORD("void", 0, RSTRING_LEN(rstring));
 
 	return rstring;
 }
@@ -589,6 +1672,7 @@ static VALUE external_element(int argc, VALUE *arguments, RB_UNUSED_VAR(VALUE se
 	}
 
 	Check_Type(tag, T_STRING);
+	PROBE2(element_start, RSTRING_PTR(tag), RSTRING_LEN(tag));
 
 	CONTENT_FROM_BLOCK
 
@@ -600,8 +1684,11 @@ static VALUE external_element(int argc, VALUE *arguments, RB_UNUSED_VAR(VALUE se
 		string = element_without_attributes(RSTRING_PTR(tag), RSTRING_LEN(tag), RSTRING_PTR(content), RSTRING_LEN(content));
 	}
 
-	VALUE rstring = rb_utf8_str_new_cstr(string);
+	VALUE rstring = safestring_new(string, strlen(string));
 	strxfree(string);
+	STATS_RECORD("element", RSTRING_LEN(content), RSTRING_LEN(rstring));
+	PROBE4(element_done, RSTRING_PTR(tag), RSTRING_LEN(tag), RSTRING_LEN(content), RSTRING_LEN(rstring));
+	RB_GC_GUARD(tag);
 
 	return rstring;
 }
@@ -717,14 +1804,44 @@ STANDARD_ELEMENT(ul)
 STANDARD_ELEMENT(var)
 STANDARD_ELEMENT(video)
 
+/*
+ * The external API for Berns.json.
+ *
+ * Wraps value so that it's serialized as JSON when used as an attribute value.
+ *
+ */
+static VALUE external_json(RB_UNUSED_VAR(VALUE self), VALUE value) {
+	STATS_RECORD("json", 0, 0);
+
+	return rb_class_new_instance(1, &value, json_value_class);
+}
+
 void Init_berns() {
 	VALUE Berns = rb_define_module("Berns");
 
+	digest_define(Berns);
+	escapefile_define(Berns);
+	histogram_define(Berns);
+	json_value_class = jsonattr_define(Berns);
+	safestring_define(Berns);
+	sanitizer_define(Berns);
+	probes_define(Berns);
+	stats_define(Berns);
+	timing_define(Berns);
+
+	rb_define_singleton_method(Berns, "collapse_whitespace", external_collapse_whitespace, 1);
 	rb_define_singleton_method(Berns, "element", external_element, -1);
-	rb_define_singleton_method(Berns, "escape_html", external_escape_html, 1);
+	rb_define_singleton_method(Berns, "escape_html", external_escape_html, -1);
+	rb_define_singleton_method(Berns, "escape_html!", external_escape_html_bang, 1);
+	rb_define_singleton_method(Berns, "escape_html_all", external_escape_html_all, -1);
+	rb_define_singleton_method(Berns, "json", external_json, 1);
 	rb_define_singleton_method(Berns, "sanitize", external_sanitize, 1);
+	rb_define_singleton_method(Berns, "sanitize!", external_sanitize_bang, 1);
+	rb_define_singleton_method(Berns, "sanitize_all", external_sanitize_all, -1);
+	rb_define_singleton_method(Berns, "snippet", external_snippet, -1);
 	rb_define_singleton_method(Berns, "to_attribute", external_to_attribute, 2);
 	rb_define_singleton_method(Berns, "to_attributes", external_to_attributes, 1);
+	rb_define_singleton_method(Berns, "unescape_html", external_unescape_html, 1);
 	rb_define_singleton_method(Berns, "void", external_void_element, -1);
 
 	/*
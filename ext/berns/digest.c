@@ -0,0 +1,301 @@
+#include <string.h>
+
+#include "digest.h"
+
+/*
+ * XXH64 by Yann Collet - https://github.com/Cyan4973/xxHash
+ *
+ * A fast non-cryptographic hash, which is all an ETag needs. The seed is
+ * always 0.
+ */
+static const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+static const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+static inline uint64_t rotl(const uint64_t x, const int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t read64(const uint8_t *p) {
+	uint64_t value;
+	memcpy(&value, p, sizeof(value));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap64(value);
+#endif
+
+	return value;
+}
+
+static inline uint32_t read32(const uint8_t *p) {
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap32(value);
+#endif
+
+	return value;
+}
+
+static inline uint64_t round64(uint64_t acc, const uint64_t input) {
+	acc += input * PRIME2;
+	acc = rotl(acc, 31);
+
+	return acc * PRIME1;
+}
+
+static inline uint64_t merge64(uint64_t acc, const uint64_t value) {
+	acc ^= round64(0, value);
+
+	return acc * PRIME1 + PRIME4;
+}
+
+/*
+ * Consume as many whole 32 byte stripes of input as possible, returning the
+ * number of bytes consumed.
+ */
+static size_t consume(digest_state *state, const uint8_t *input, const size_t size) {
+	size_t i = 0;
+	uint64_t v0 = state->v[0], v1 = state->v[1], v2 = state->v[2], v3 = state->v[3];
+
+	for (; i + 32 <= size; i += 32) {
+		v0 = round64(v0, read64(input + i));
+		v1 = round64(v1, read64(input + i + 8));
+		v2 = round64(v2, read64(input + i + 16));
+		v3 = round64(v3, read64(input + i + 24));
+	}
+
+	state->v[0] = v0;
+	state->v[1] = v1;
+	state->v[2] = v2;
+	state->v[3] = v3;
+
+	return i;
+}
+
+void digest_reset(digest_state *state) {
+	state->total = 0;
+	state->v[0] = PRIME1 + PRIME2;
+	state->v[1] = PRIME2;
+	state->v[2] = 0;
+	state->v[3] = -PRIME1;
+	state->tailsize = 0;
+}
+
+void digest_update(digest_state *state, const uint8_t *input, size_t size) {
+	state->total += size;
+
+	/* Finish off a stripe started by a previous update first. */
+	if (state->tailsize > 0) {
+		size_t fill = 32 - state->tailsize;
+
+		if (size < fill) {
+			memcpy(state->tail + state->tailsize, input, size);
+			state->tailsize += size;
+
+			return;
+		}
+
+		memcpy(state->tail + state->tailsize, input, fill);
+		consume(state, state->tail, 32);
+		state->tailsize = 0;
+
+		input += fill;
+		size -= fill;
+	}
+
+	size_t consumed = consume(state, input, size);
+
+	memcpy(state->tail, input + consumed, size - consumed);
+	state->tailsize = size - consumed;
+}
+
+uint64_t digest_final(const digest_state *state) {
+	uint64_t hash;
+
+	if (state->total >= 32) {
+		hash = rotl(state->v[0], 1) + rotl(state->v[1], 7) + rotl(state->v[2], 12) + rotl(state->v[3], 18);
+
+		for (int i = 0; i < 4; i++) {
+			hash = merge64(hash, state->v[i]);
+		}
+	} else {
+		hash = state->v[2] + PRIME5;
+	}
+
+	hash += state->total;
+
+	const uint8_t *p = state->tail;
+	const uint8_t *end = p + state->tailsize;
+
+	for (; p + 8 <= end; p += 8) {
+		hash ^= round64(0, read64(p));
+		hash = rotl(hash, 27) * PRIME1 + PRIME4;
+	}
+
+	if (p + 4 <= end) {
+		hash ^= (uint64_t) read32(p) * PRIME1;
+		hash = rotl(hash, 23) * PRIME2 + PRIME3;
+		p += 4;
+	}
+
+	for (; p < end; p++) {
+		hash ^= (*p) * PRIME5;
+		hash = rotl(hash, 11) * PRIME1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= PRIME2;
+	hash ^= hash >> 29;
+	hash *= PRIME3;
+	hash ^= hash >> 32;
+
+	return hash;
+}
+
+static const rb_data_type_t digest_type = {
+	"Berns::Digest",
+	{ NULL, RUBY_TYPED_DEFAULT_FREE, NULL },
+	0, 0,
+	RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+static VALUE digest_alloc(VALUE klass) {
+	digest_state *state;
+	VALUE self = TypedData_Make_Struct(klass, digest_state, &digest_type, state);
+
+	digest_reset(state);
+
+	return self;
+}
+
+static digest_state * digest_get(VALUE self) {
+	digest_state *state;
+	TypedData_Get_Struct(self, digest_state, &digest_type, state);
+
+	return state;
+}
+
+/*
+ * Berns::Digest#update
+ *
+ * Hash string from offset, which defaults to 0, to the end. Returns self.
+ */
+static VALUE digest_update_external(int argc, VALUE *argv, VALUE self) {
+	VALUE string;
+	VALUE offset;
+
+	rb_scan_args(argc, argv, "11", &string, &offset);
+	Check_Type(string, T_STRING);
+	rb_check_frozen(self);
+
+	long start = NIL_P(offset) ? 0 : NUM2LONG(offset);
+	long len = RSTRING_LEN(string);
+
+	if (start < 0 || start > len) {
+		rb_raise(rb_eIndexError, "Berns::Digest#update offset %ld is outside of a string of %ld bytes.", start, len);
+	}
+
+	digest_update(digest_get(self), (const uint8_t *) RSTRING_PTR(string) + start, len - start);
+	RB_GC_GUARD(string);
+
+	return self;
+}
+
+/*
+ * Berns::Digest#<<
+ */
+static VALUE digest_append(VALUE self, VALUE string) {
+	return digest_update_external(1, &string, self);
+}
+
+/*
+ * Berns::Digest#reset
+ */
+static VALUE digest_reset_external(VALUE self) {
+	rb_check_frozen(self);
+	digest_reset(digest_get(self));
+
+	return self;
+}
+
+/*
+ * Berns::Digest#to_i
+ */
+static VALUE digest_to_i(VALUE self) {
+	return ULL2NUM(digest_final(digest_get(self)));
+}
+
+/*
+ * Berns::Digest#hexdigest
+ *
+ * The digest as 16 lowercase hex characters.
+ */
+static VALUE digest_hexdigest(VALUE self) {
+	char hex[17];
+	uint64_t hash = digest_final(digest_get(self));
+
+	for (int i = 15; i >= 0; i--) {
+		hex[i] = "0123456789abcdef"[hash & 0xF];
+		hash >>= 4;
+	}
+
+	return rb_usascii_str_new(hex, 16);
+}
+
+/*
+ * Berns::Digest#etag
+ *
+ * The hex digest quoted for use as a strong ETag header value.
+ */
+static VALUE digest_etag(VALUE self) {
+	VALUE hex = digest_hexdigest(self);
+	VALUE etag = rb_usascii_str_new("\"", 1);
+
+	rb_str_buf_append(etag, hex);
+	rb_str_buf_cat(etag, "\"", 1);
+
+	return etag;
+}
+
+/*
+ * Berns::Digest#initialize_copy
+ */
+static VALUE digest_initialize_copy(VALUE self, VALUE other) {
+	if (self != other) {
+		*digest_get(self) = *digest_get(other);
+	}
+
+	return self;
+}
+
+/*
+ * Berns::Digest.hexdigest
+ *
+ * Hash a whole string at once.
+ */
+static VALUE digest_s_hexdigest(VALUE klass, VALUE string) {
+	VALUE digest = digest_alloc(klass);
+
+	return digest_hexdigest(digest_update_external(1, &string, digest));
+}
+
+VALUE digest_define(VALUE module) {
+	VALUE klass = rb_define_class_under(module, "Digest", rb_cObject);
+
+	rb_define_alloc_func(klass, digest_alloc);
+	rb_define_singleton_method(klass, "hexdigest", digest_s_hexdigest, 1);
+	rb_define_method(klass, "<<", digest_append, 1);
+	rb_define_method(klass, "etag", digest_etag, 0);
+	rb_define_method(klass, "hexdigest", digest_hexdigest, 0);
+	rb_define_method(klass, "initialize_copy", digest_initialize_copy, 1);
+	rb_define_method(klass, "reset", digest_reset_external, 0);
+	rb_define_method(klass, "to_i", digest_to_i, 0);
+	rb_define_method(klass, "update", digest_update_external, -1);
+	rb_define_alias(klass, "to_s", "hexdigest");
+
+	return klass;
+}
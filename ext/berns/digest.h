@@ -0,0 +1,30 @@
+#ifndef DIGEST_H
+#define DIGEST_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ruby.h"
+
+/*
+ * Streaming XXH64 state, so output can be hashed as it's produced in pieces
+ * and still give the same digest as hashing it all at once.
+ */
+typedef struct {
+	uint64_t total;
+	uint64_t v[4];
+	uint8_t tail[32];
+	size_t tailsize;
+} digest_state;
+
+extern void digest_reset(digest_state *state);
+extern void digest_update(digest_state *state, const uint8_t *input, size_t size);
+extern uint64_t digest_final(const digest_state *state);
+
+/*
+ * Define the Berns::Digest class under the given module and return it.
+ * Instances wrap a digest_state and can be updated with strings as they're
+ * rendered or written out in chunks.
+ */
+extern VALUE digest_define(VALUE module);
+
+#endif
@@ -0,0 +1,2819 @@
+/*
+ * Generated by `rake entities` from entities.json, do not edit.
+ *
+ * Every HTML named character reference, including the legacy ones that don't
+ * need a trailing semicolon, in a perfect hash table. See unescape.c.
+ */
+#ifndef ENTITIES_H
+#define ENTITIES_H
+#include <stdint.h>
+
+#define ENTITY_BUCKETS 558
+#define ENTITY_SLOTS 2509
+#define ENTITY_MAX_LENGTH 32
+#define ENTITY_LEGACY_MAX_LENGTH 6
+
+typedef struct {
+	uint16_t name;
+	uint8_t length;
+	uint8_t size;
+	uint8_t value[6];
+} entity;
+
+static const uint16_t entity_displacements[ENTITY_BUCKETS] = {
+	12, 164, 3, 67, 1, 5, 24, 13, 37, 3, 3, 1,
+	6, 20, 5, 3, 62, 10, 1, 19, 17, 4, 8, 49,
+	10, 58, 19, 99, 6, 63, 10, 88, 18, 1, 30, 172,
+	9, 29, 48, 77, 21, 5, 13, 8, 4, 1, 3, 11,
+	8, 14, 47, 4, 2, 50, 52, 4, 3, 29, 14, 8,
+	2, 12, 1, 15, 4, 1, 3, 22, 3, 15, 29, 27,
+	3, 10, 7, 0, 13, 4, 1, 59, 23, 0, 36, 38,
+	2, 2, 128, 1, 62, 1, 42, 4, 41, 89, 5, 8,
+	9, 1, 5, 91, 30, 53, 0, 1, 79, 46, 1, 40,
+	42, 13, 10, 8, 3, 21, 142, 5, 52, 10, 7, 120,
+	7, 8, 11, 14, 22, 16, 2, 7, 8, 132, 14, 45,
+	156, 11, 6, 22, 2, 7, 31, 8, 42, 1, 4, 38,
+	29, 1, 70, 4, 54, 2, 6, 1, 1, 1, 74, 31,
+	3, 14, 5, 80, 0, 36, 68, 20, 38, 7, 84, 67,
+	3, 72, 1, 15, 1, 1, 13, 3, 9, 15, 21, 3,
+	32, 6, 0, 13, 125, 31, 39, 16, 51, 9, 121, 0,
+	72, 2, 1, 14, 19, 87, 0, 53, 3, 5, 77, 5,
+	2, 74, 2, 4, 0, 15, 33, 1, 1, 170, 57, 2,
+	39, 24, 18, 4, 1, 115, 56, 1, 70, 26, 165, 1,
+	88, 88, 64, 7, 1, 24, 1, 93, 75, 68, 1, 71,
+	21, 15, 7, 110, 13, 1, 34, 2, 3, 2, 28, 1,
+	1, 9, 86, 2, 4, 13, 34, 46, 6, 45, 66, 2,
+	1, 1, 4, 23, 64, 11, 28, 2, 72, 37, 1, 3,
+	139, 2, 1, 76, 12, 1, 6, 9, 13, 5, 16, 1,
+	86, 11, 23, 41, 26, 32, 19, 8, 18, 76, 3, 108,
+	101, 4, 7, 21, 8, 14, 31, 59, 48, 2, 1, 109,
+	2, 1, 20, 1, 8, 55, 5, 77, 236, 4, 5, 41,
+	2, 33, 199, 21, 7, 3, 4, 23, 62, 2, 19, 27,
+	168, 5, 33, 14, 141, 45, 23, 45, 1, 4, 86, 70,
+	9, 25, 7, 352, 10, 114, 32, 51, 75, 1, 249, 4,
+	8, 16, 13, 8, 139, 4, 12, 21, 1, 40, 15, 171,
+	27, 10, 1, 55, 43, 17, 292, 79, 65, 74, 22, 9,
+	8, 25, 2, 118, 29, 31, 9, 2, 30, 88, 14, 38,
+	16, 110, 2, 176, 1, 7, 71, 8, 28, 7, 82, 69,
+	8, 17, 20, 7, 149, 114, 2, 8, 2, 18, 28, 94,
+	2, 34, 10, 5, 68, 45, 50, 1, 8, 70, 159, 4,
+	1, 13, 1, 1, 1, 5, 7, 70, 52, 76, 1, 82,
+	146, 63, 136, 42, 239, 45, 16, 40, 4, 1, 25, 4,
+	71, 58, 22, 35, 70, 12, 5, 60, 20, 3, 56, 271,
+	284, 133, 1, 8, 4, 5, 4, 54, 10, 36, 2, 40,
+	166, 82, 303, 11, 8, 15, 10, 26, 3, 4, 61, 90,
+	0, 67, 12, 23, 134, 112, 101, 7, 305, 1, 92, 111,
+	229, 42, 166, 12, 8, 64, 29, 35, 9, 12, 35, 77,
+	9, 297, 230, 67, 48, 1, 140, 12, 378, 14, 1, 107,
+	4, 45, 48, 85, 1, 41, 3, 115, 3, 428, 10, 2,
+	11, 292, 1, 98, 7, 11, 188, 18, 5, 12, 26, 13,
+	335, 128, 182, 69, 72, 79,
+};
+
+static const char entity_names[] =
+	"AEligAElig;AMPAMP;AacuteAacute;Abreve;AcircAcirc;Acy;Afr;AgraveAgrave;Al"
+	"pha;Amacr;And;Aogon;Aopf;ApplyFunction;AringAring;Ascr;Assign;AtildeAtil"
+	"de;AumlAuml;Backslash;Barv;Barwed;Bcy;Because;Bernoullis;Beta;Bfr;Bopf;B"
+	"reve;Bscr;Bumpeq;CHcy;COPYCOPY;Cacute;Cap;CapitalDifferentialD;Cayleys;C"
+	"caron;CcedilCcedil;Ccirc;Cconint;Cdot;Cedilla;CenterDot;Cfr;Chi;CircleDo"
+	"t;CircleMinus;CirclePlus;CircleTimes;ClockwiseContourIntegral;CloseCurly"
+	"DoubleQuote;CloseCurlyQuote;Colon;Colone;Congruent;Conint;ContourIntegra"
+	"l;Copf;Coproduct;CounterClockwiseContourIntegral;Cross;Cscr;Cup;CupCap;D"
+	"D;DDotrahd;DJcy;DScy;DZcy;Dagger;Darr;Dashv;Dcaron;Dcy;Del;Delta;Dfr;Dia"
+	"criticalAcute;DiacriticalDot;DiacriticalDoubleAcute;DiacriticalGrave;Dia"
+	"criticalTilde;Diamond;DifferentialD;Dopf;Dot;DotDot;DotEqual;DoubleConto"
+	"urIntegral;DoubleDot;DoubleDownArrow;DoubleLeftArrow;DoubleLeftRightArro"
+	"w;DoubleLeftTee;DoubleLongLeftArrow;DoubleLongLeftRightArrow;DoubleLongR"
+	"ightArrow;DoubleRightArrow;DoubleRightTee;DoubleUpArrow;DoubleUpDownArro"
+	"w;DoubleVerticalBar;DownArrow;DownArrowBar;DownArrowUpArrow;DownBreve;Do"
+	"wnLeftRightVector;DownLeftTeeVector;DownLeftVector;DownLeftVectorBar;Dow"
+	"nRightTeeVector;DownRightVector;DownRightVectorBar;DownTee;DownTeeArrow;"
+	"Downarrow;Dscr;Dstrok;ENG;ETHETH;EacuteEacute;Ecaron;EcircEcirc;Ecy;Edot"
+	";Efr;EgraveEgrave;Element;Emacr;EmptySmallSquare;EmptyVerySmallSquare;Eo"
+	"gon;Eopf;Epsilon;Equal;EqualTilde;Equilibrium;Escr;Esim;Eta;EumlEuml;Exi"
+	"sts;ExponentialE;Fcy;Ffr;FilledSmallSquare;FilledVerySmallSquare;Fopf;Fo"
+	"rAll;Fouriertrf;Fscr;GJcy;GTGT;Gamma;Gammad;Gbreve;Gcedil;Gcirc;Gcy;Gdot"
+	";Gfr;Gg;Gopf;GreaterEqual;GreaterEqualLess;GreaterFullEqual;GreaterGreat"
+	"er;GreaterLess;GreaterSlantEqual;GreaterTilde;Gscr;Gt;HARDcy;Hacek;Hat;H"
+	"circ;Hfr;HilbertSpace;Hopf;HorizontalLine;Hscr;Hstrok;HumpDownHump;HumpE"
+	"qual;IEcy;IJlig;IOcy;IacuteIacute;IcircIcirc;Icy;Idot;Ifr;IgraveIgrave;I"
+	"m;Imacr;ImaginaryI;Implies;Int;Integral;Intersection;InvisibleComma;Invi"
+	"sibleTimes;Iogon;Iopf;Iota;Iscr;Itilde;Iukcy;IumlIuml;Jcirc;Jcy;Jfr;Jopf"
+	";Jscr;Jsercy;Jukcy;KHcy;KJcy;Kappa;Kcedil;Kcy;Kfr;Kopf;Kscr;LJcy;LTLT;La"
+	"cute;Lambda;Lang;Laplacetrf;Larr;Lcaron;Lcedil;Lcy;LeftAngleBracket;Left"
+	"Arrow;LeftArrowBar;LeftArrowRightArrow;LeftCeiling;LeftDoubleBracket;Lef"
+	"tDownTeeVector;LeftDownVector;LeftDownVectorBar;LeftFloor;LeftRightArrow"
+	";LeftRightVector;LeftTee;LeftTeeArrow;LeftTeeVector;LeftTriangle;LeftTri"
+	"angleBar;LeftTriangleEqual;LeftUpDownVector;LeftUpTeeVector;LeftUpVector"
+	";LeftUpVectorBar;LeftVector;LeftVectorBar;Leftarrow;Leftrightarrow;LessE"
+	"qualGreater;LessFullEqual;LessGreater;LessLess;LessSlantEqual;LessTilde;"
+	"Lfr;Ll;Lleftarrow;Lmidot;LongLeftArrow;LongLeftRightArrow;LongRightArrow"
+	";Longleftarrow;Longleftrightarrow;Longrightarrow;Lopf;LowerLeftArrow;Low"
+	"erRightArrow;Lscr;Lsh;Lstrok;Lt;Map;Mcy;MediumSpace;Mellintrf;Mfr;MinusP"
+	"lus;Mopf;Mscr;Mu;NJcy;Nacute;Ncaron;Ncedil;Ncy;NegativeMediumSpace;Negat"
+	"iveThickSpace;NegativeThinSpace;NegativeVeryThinSpace;NestedGreaterGreat"
+	"er;NestedLessLess;NewLine;Nfr;NoBreak;NonBreakingSpace;Nopf;Not;NotCongr"
+	"uent;NotCupCap;NotDoubleVerticalBar;NotElement;NotEqual;NotEqualTilde;No"
+	"tExists;NotGreater;NotGreaterEqual;NotGreaterFullEqual;NotGreaterGreater"
+	";NotGreaterLess;NotGreaterSlantEqual;NotGreaterTilde;NotHumpDownHump;Not"
+	"HumpEqual;NotLeftTriangle;NotLeftTriangleBar;NotLeftTriangleEqual;NotLes"
+	"s;NotLessEqual;NotLessGreater;NotLessLess;NotLessSlantEqual;NotLessTilde"
+	";NotNestedGreaterGreater;NotNestedLessLess;NotPrecedes;NotPrecedesEqual;"
+	"NotPrecedesSlantEqual;NotReverseElement;NotRightTriangle;NotRightTriangl"
+	"eBar;NotRightTriangleEqual;NotSquareSubset;NotSquareSubsetEqual;NotSquar"
+	"eSuperset;NotSquareSupersetEqual;NotSubset;NotSubsetEqual;NotSucceeds;No"
+	"tSucceedsEqual;NotSucceedsSlantEqual;NotSucceedsTilde;NotSuperset;NotSup"
+	"ersetEqual;NotTilde;NotTildeEqual;NotTildeFullEqual;NotTildeTilde;NotVer"
+	"ticalBar;Nscr;NtildeNtilde;Nu;OElig;OacuteOacute;OcircOcirc;Ocy;Odblac;O"
+	"fr;OgraveOgrave;Omacr;Omega;Omicron;Oopf;OpenCurlyDoubleQuote;OpenCurlyQ"
+	"uote;Or;Oscr;OslashOslash;OtildeOtilde;Otimes;OumlOuml;OverBar;OverBrace"
+	";OverBracket;OverParenthesis;PartialD;Pcy;Pfr;Phi;Pi;PlusMinus;Poincarep"
+	"lane;Popf;Pr;Precedes;PrecedesEqual;PrecedesSlantEqual;PrecedesTilde;Pri"
+	"me;Product;Proportion;Proportional;Pscr;Psi;QUOTQUOT;Qfr;Qopf;Qscr;RBarr"
+	";REGREG;Racute;Rang;Rarr;Rarrtl;Rcaron;Rcedil;Rcy;Re;ReverseElement;Reve"
+	"rseEquilibrium;ReverseUpEquilibrium;Rfr;Rho;RightAngleBracket;RightArrow"
+	";RightArrowBar;RightArrowLeftArrow;RightCeiling;RightDoubleBracket;Right"
+	"DownTeeVector;RightDownVector;RightDownVectorBar;RightFloor;RightTee;Rig"
+	"htTeeArrow;RightTeeVector;RightTriangle;RightTriangleBar;RightTriangleEq"
+	"ual;RightUpDownVector;RightUpTeeVector;RightUpVector;RightUpVectorBar;Ri"
+	"ghtVector;RightVectorBar;Rightarrow;Ropf;RoundImplies;Rrightarrow;Rscr;R"
+	"sh;RuleDelayed;SHCHcy;SHcy;SOFTcy;Sacute;Sc;Scaron;Scedil;Scirc;Scy;Sfr;"
+	"ShortDownArrow;ShortLeftArrow;ShortRightArrow;ShortUpArrow;Sigma;SmallCi"
+	"rcle;Sopf;Sqrt;Square;SquareIntersection;SquareSubset;SquareSubsetEqual;"
+	"SquareSuperset;SquareSupersetEqual;SquareUnion;Sscr;Star;Sub;Subset;Subs"
+	"etEqual;Succeeds;SucceedsEqual;SucceedsSlantEqual;SucceedsTilde;SuchThat"
+	";Sum;Sup;Superset;SupersetEqual;Supset;THORNTHORN;TRADE;TSHcy;TScy;Tab;T"
+	"au;Tcaron;Tcedil;Tcy;Tfr;Therefore;Theta;ThickSpace;ThinSpace;Tilde;Tild"
+	"eEqual;TildeFullEqual;TildeTilde;Topf;TripleDot;Tscr;Tstrok;UacuteUacute"
+	";Uarr;Uarrocir;Ubrcy;Ubreve;UcircUcirc;Ucy;Udblac;Ufr;UgraveUgrave;Umacr"
+	";UnderBar;UnderBrace;UnderBracket;UnderParenthesis;Union;UnionPlus;Uogon"
+	";Uopf;UpArrow;UpArrowBar;UpArrowDownArrow;UpDownArrow;UpEquilibrium;UpTe"
+	"e;UpTeeArrow;Uparrow;Updownarrow;UpperLeftArrow;UpperRightArrow;Upsi;Ups"
+	"ilon;Uring;Uscr;Utilde;UumlUuml;VDash;Vbar;Vcy;Vdash;Vdashl;Vee;Verbar;V"
+	"ert;VerticalBar;VerticalLine;VerticalSeparator;VerticalTilde;VeryThinSpa"
+	"ce;Vfr;Vopf;Vscr;Vvdash;Wcirc;Wedge;Wfr;Wopf;Wscr;Xfr;Xi;Xopf;Xscr;YAcy;"
+	"YIcy;YUcy;YacuteYacute;Ycirc;Ycy;Yfr;Yopf;Yscr;Yuml;ZHcy;Zacute;Zcaron;Z"
+	"cy;Zdot;ZeroWidthSpace;Zeta;Zfr;Zopf;Zscr;aacuteaacute;abreve;ac;acE;acd"
+	";acircacirc;acuteacute;acy;aeligaelig;af;afr;agraveagrave;alefsym;aleph;"
+	"alpha;amacr;amalg;ampamp;and;andand;andd;andslope;andv;ang;ange;angle;an"
+	"gmsd;angmsdaa;angmsdab;angmsdac;angmsdad;angmsdae;angmsdaf;angmsdag;angm"
+	"sdah;angrt;angrtvb;angrtvbd;angsph;angst;angzarr;aogon;aopf;ap;apE;apaci"
+	"r;ape;apid;apos;approx;approxeq;aringaring;ascr;ast;asymp;asympeq;atilde"
+	"atilde;aumlauml;awconint;awint;bNot;backcong;backepsilon;backprime;backs"
+	"im;backsimeq;barvee;barwed;barwedge;bbrk;bbrktbrk;bcong;bcy;bdquo;becaus"
+	";because;bemptyv;bepsi;bernou;beta;beth;between;bfr;bigcap;bigcirc;bigcu"
+	"p;bigodot;bigoplus;bigotimes;bigsqcup;bigstar;bigtriangledown;bigtriangl"
+	"eup;biguplus;bigvee;bigwedge;bkarow;blacklozenge;blacksquare;blacktriang"
+	"le;blacktriangledown;blacktriangleleft;blacktriangleright;blank;blk12;bl"
+	"k14;blk34;block;bne;bnequiv;bnot;bopf;bot;bottom;bowtie;boxDL;boxDR;boxD"
+	"l;boxDr;boxH;boxHD;boxHU;boxHd;boxHu;boxUL;boxUR;boxUl;boxUr;boxV;boxVH;"
+	"boxVL;boxVR;boxVh;boxVl;boxVr;boxbox;boxdL;boxdR;boxdl;boxdr;boxh;boxhD;"
+	"boxhU;boxhd;boxhu;boxminus;boxplus;boxtimes;boxuL;boxuR;boxul;boxur;boxv"
+	";boxvH;boxvL;boxvR;boxvh;boxvl;boxvr;bprime;breve;brvbarbrvbar;bscr;bsem"
+	"i;bsim;bsime;bsol;bsolb;bsolhsub;bull;bullet;bump;bumpE;bumpe;bumpeq;cac"
+	"ute;cap;capand;capbrcup;capcap;capcup;capdot;caps;caret;caron;ccaps;ccar"
+	"on;ccedilccedil;ccirc;ccups;ccupssm;cdot;cedilcedil;cemptyv;centcent;cen"
+	"terdot;cfr;chcy;check;checkmark;chi;cir;cirE;circ;circeq;circlearrowleft"
+	";circlearrowright;circledR;circledS;circledast;circledcirc;circleddash;c"
+	"ire;cirfnint;cirmid;cirscir;clubs;clubsuit;colon;colone;coloneq;comma;co"
+	"mmat;comp;compfn;complement;complexes;cong;congdot;conint;copf;coprod;co"
+	"pycopy;copysr;crarr;cross;cscr;csub;csube;csup;csupe;ctdot;cudarrl;cudar"
+	"rr;cuepr;cuesc;cularr;cularrp;cup;cupbrcap;cupcap;cupcup;cupdot;cupor;cu"
+	"ps;curarr;curarrm;curlyeqprec;curlyeqsucc;curlyvee;curlywedge;currencurr"
+	"en;curvearrowleft;curvearrowright;cuvee;cuwed;cwconint;cwint;cylcty;dArr"
+	";dHar;dagger;daleth;darr;dash;dashv;dbkarow;dblac;dcaron;dcy;dd;ddagger;"
+	"ddarr;ddotseq;degdeg;delta;demptyv;dfisht;dfr;dharl;dharr;diam;diamond;d"
+	"iamondsuit;diams;die;digamma;disin;div;dividedivide;divideontimes;divonx"
+	";djcy;dlcorn;dlcrop;dollar;dopf;dot;doteq;doteqdot;dotminus;dotplus;dots"
+	"quare;doublebarwedge;downarrow;downdownarrows;downharpoonleft;downharpoo"
+	"nright;drbkarow;drcorn;drcrop;dscr;dscy;dsol;dstrok;dtdot;dtri;dtrif;dua"
+	"rr;duhar;dwangle;dzcy;dzigrarr;eDDot;eDot;eacuteeacute;easter;ecaron;eci"
+	"r;ecircecirc;ecolon;ecy;edot;ee;efDot;efr;eg;egraveegrave;egs;egsdot;el;"
+	"elinters;ell;els;elsdot;emacr;empty;emptyset;emptyv;emsp13;emsp14;emsp;e"
+	"ng;ensp;eogon;eopf;epar;eparsl;eplus;epsi;epsilon;epsiv;eqcirc;eqcolon;e"
+	"qsim;eqslantgtr;eqslantless;equals;equest;equiv;equivDD;eqvparsl;erDot;e"
+	"rarr;escr;esdot;esim;eta;etheth;eumleuml;euro;excl;exist;expectation;exp"
+	"onentiale;fallingdotseq;fcy;female;ffilig;fflig;ffllig;ffr;filig;fjlig;f"
+	"lat;fllig;fltns;fnof;fopf;forall;fork;forkv;fpartint;frac12frac12;frac13"
+	";frac14frac14;frac15;frac16;frac18;frac23;frac25;frac34frac34;frac35;fra"
+	"c38;frac45;frac56;frac58;frac78;frasl;frown;fscr;gE;gEl;gacute;gamma;gam"
+	"mad;gap;gbreve;gcirc;gcy;gdot;ge;gel;geq;geqq;geqslant;ges;gescc;gesdot;"
+	"gesdoto;gesdotol;gesl;gesles;gfr;gg;ggg;gimel;gjcy;gl;glE;gla;glj;gnE;gn"
+	"ap;gnapprox;gne;gneq;gneqq;gnsim;gopf;grave;gscr;gsim;gsime;gsiml;gtgt;g"
+	"tcc;gtcir;gtdot;gtlPar;gtquest;gtrapprox;gtrarr;gtrdot;gtreqless;gtreqql"
+	"ess;gtrless;gtrsim;gvertneqq;gvnE;hArr;hairsp;half;hamilt;hardcy;harr;ha"
+	"rrcir;harrw;hbar;hcirc;hearts;heartsuit;hellip;hercon;hfr;hksearow;hkswa"
+	"row;hoarr;homtht;hookleftarrow;hookrightarrow;hopf;horbar;hscr;hslash;hs"
+	"trok;hybull;hyphen;iacuteiacute;ic;icircicirc;icy;iecy;iexcliexcl;iff;if"
+	"r;igraveigrave;ii;iiiint;iiint;iinfin;iiota;ijlig;imacr;image;imagline;i"
+	"magpart;imath;imof;imped;in;incare;infin;infintie;inodot;int;intcal;inte"
+	"gers;intercal;intlarhk;intprod;iocy;iogon;iopf;iota;iprod;iquestiquest;i"
+	"scr;isin;isinE;isindot;isins;isinsv;isinv;it;itilde;iukcy;iumliuml;jcirc"
+	";jcy;jfr;jmath;jopf;jscr;jsercy;jukcy;kappa;kappav;kcedil;kcy;kfr;kgreen"
+	";khcy;kjcy;kopf;kscr;lAarr;lArr;lAtail;lBarr;lE;lEg;lHar;lacute;laemptyv"
+	";lagran;lambda;lang;langd;langle;lap;laquolaquo;larr;larrb;larrbfs;larrf"
+	"s;larrhk;larrlp;larrpl;larrsim;larrtl;lat;latail;late;lates;lbarr;lbbrk;"
+	"lbrace;lbrack;lbrke;lbrksld;lbrkslu;lcaron;lcedil;lceil;lcub;lcy;ldca;ld"
+	"quo;ldquor;ldrdhar;ldrushar;ldsh;le;leftarrow;leftarrowtail;leftharpoond"
+	"own;leftharpoonup;leftleftarrows;leftrightarrow;leftrightarrows;leftrigh"
+	"tharpoons;leftrightsquigarrow;leftthreetimes;leg;leq;leqq;leqslant;les;l"
+	"escc;lesdot;lesdoto;lesdotor;lesg;lesges;lessapprox;lessdot;lesseqgtr;le"
+	"sseqqgtr;lessgtr;lesssim;lfisht;lfloor;lfr;lg;lgE;lhard;lharu;lharul;lhb"
+	"lk;ljcy;ll;llarr;llcorner;llhard;lltri;lmidot;lmoust;lmoustache;lnE;lnap"
+	";lnapprox;lne;lneq;lneqq;lnsim;loang;loarr;lobrk;longleftarrow;longleftr"
+	"ightarrow;longmapsto;longrightarrow;looparrowleft;looparrowright;lopar;l"
+	"opf;loplus;lotimes;lowast;lowbar;loz;lozenge;lozf;lpar;lparlt;lrarr;lrco"
+	"rner;lrhar;lrhard;lrm;lrtri;lsaquo;lscr;lsh;lsim;lsime;lsimg;lsqb;lsquo;"
+	"lsquor;lstrok;ltlt;ltcc;ltcir;ltdot;lthree;ltimes;ltlarr;ltquest;ltrPar;"
+	"ltri;ltrie;ltrif;lurdshar;luruhar;lvertneqq;lvnE;mDDot;macrmacr;male;mal"
+	"t;maltese;map;mapsto;mapstodown;mapstoleft;mapstoup;marker;mcomma;mcy;md"
+	"ash;measuredangle;mfr;mho;micromicro;mid;midast;midcir;middotmiddot;minu"
+	"s;minusb;minusd;minusdu;mlcp;mldr;mnplus;models;mopf;mp;mscr;mstpos;mu;m"
+	"ultimap;mumap;nGg;nGt;nGtv;nLeftarrow;nLeftrightarrow;nLl;nLt;nLtv;nRigh"
+	"tarrow;nVDash;nVdash;nabla;nacute;nang;nap;napE;napid;napos;napprox;natu"
+	"r;natural;naturals;nbspnbsp;nbump;nbumpe;ncap;ncaron;ncedil;ncong;ncongd"
+	"ot;ncup;ncy;ndash;ne;neArr;nearhk;nearr;nearrow;nedot;nequiv;nesear;nesi"
+	"m;nexist;nexists;nfr;ngE;nge;ngeq;ngeqq;ngeqslant;nges;ngsim;ngt;ngtr;nh"
+	"Arr;nharr;nhpar;ni;nis;nisd;niv;njcy;nlArr;nlE;nlarr;nldr;nle;nleftarrow"
+	";nleftrightarrow;nleq;nleqq;nleqslant;nles;nless;nlsim;nlt;nltri;nltrie;"
+	"nmid;nopf;notnot;notin;notinE;notindot;notinva;notinvb;notinvc;notni;not"
+	"niva;notnivb;notnivc;npar;nparallel;nparsl;npart;npolint;npr;nprcue;npre"
+	";nprec;npreceq;nrArr;nrarr;nrarrc;nrarrw;nrightarrow;nrtri;nrtrie;nsc;ns"
+	"ccue;nsce;nscr;nshortmid;nshortparallel;nsim;nsime;nsimeq;nsmid;nspar;ns"
+	"qsube;nsqsupe;nsub;nsubE;nsube;nsubset;nsubseteq;nsubseteqq;nsucc;nsucce"
+	"q;nsup;nsupE;nsupe;nsupset;nsupseteq;nsupseteqq;ntgl;ntildentilde;ntlg;n"
+	"triangleleft;ntrianglelefteq;ntriangleright;ntrianglerighteq;nu;num;nume"
+	"ro;numsp;nvDash;nvHarr;nvap;nvdash;nvge;nvgt;nvinfin;nvlArr;nvle;nvlt;nv"
+	"ltrie;nvrArr;nvrtrie;nvsim;nwArr;nwarhk;nwarr;nwarrow;nwnear;oS;oacuteoa"
+	"cute;oast;ocir;ocircocirc;ocy;odash;odblac;odiv;odot;odsold;oelig;ofcir;"
+	"ofr;ogon;ograveograve;ogt;ohbar;ohm;oint;olarr;olcir;olcross;oline;olt;o"
+	"macr;omega;omicron;omid;ominus;oopf;opar;operp;oplus;or;orarr;ord;order;"
+	"orderof;ordfordf;ordmordm;origof;oror;orslope;orv;oscr;oslashoslash;osol"
+	";otildeotilde;otimes;otimesas;oumlouml;ovbar;par;parapara;parallel;parsi"
+	"m;parsl;part;pcy;percnt;period;permil;perp;pertenk;pfr;phi;phiv;phmmat;p"
+	"hone;pi;pitchfork;piv;planck;planckh;plankv;plus;plusacir;plusb;pluscir;"
+	"plusdo;plusdu;pluse;plusmnplusmn;plussim;plustwo;pm;pointint;popf;poundp"
+	"ound;pr;prE;prap;prcue;pre;prec;precapprox;preccurlyeq;preceq;precnappro"
+	"x;precneqq;precnsim;precsim;prime;primes;prnE;prnap;prnsim;prod;profalar"
+	";profline;profsurf;prop;propto;prsim;prurel;pscr;psi;puncsp;qfr;qint;qop"
+	"f;qprime;qscr;quaternions;quatint;quest;questeq;quotquot;rAarr;rArr;rAta"
+	"il;rBarr;rHar;race;racute;radic;raemptyv;rang;rangd;range;rangle;raquora"
+	"quo;rarr;rarrap;rarrb;rarrbfs;rarrc;rarrfs;rarrhk;rarrlp;rarrpl;rarrsim;"
+	"rarrtl;rarrw;ratail;ratio;rationals;rbarr;rbbrk;rbrace;rbrack;rbrke;rbrk"
+	"sld;rbrkslu;rcaron;rcedil;rceil;rcub;rcy;rdca;rdldhar;rdquo;rdquor;rdsh;"
+	"real;realine;realpart;reals;rect;regreg;rfisht;rfloor;rfr;rhard;rharu;rh"
+	"arul;rho;rhov;rightarrow;rightarrowtail;rightharpoondown;rightharpoonup;"
+	"rightleftarrows;rightleftharpoons;rightrightarrows;rightsquigarrow;right"
+	"threetimes;ring;risingdotseq;rlarr;rlhar;rlm;rmoust;rmoustache;rnmid;roa"
+	"ng;roarr;robrk;ropar;ropf;roplus;rotimes;rpar;rpargt;rppolint;rrarr;rsaq"
+	"uo;rscr;rsh;rsqb;rsquo;rsquor;rthree;rtimes;rtri;rtrie;rtrif;rtriltri;ru"
+	"luhar;rx;sacute;sbquo;sc;scE;scap;scaron;sccue;sce;scedil;scirc;scnE;scn"
+	"ap;scnsim;scpolint;scsim;scy;sdot;sdotb;sdote;seArr;searhk;searr;searrow"
+	";sectsect;semi;seswar;setminus;setmn;sext;sfr;sfrown;sharp;shchcy;shcy;s"
+	"hortmid;shortparallel;shyshy;sigma;sigmaf;sigmav;sim;simdot;sime;simeq;s"
+	"img;simgE;siml;simlE;simne;simplus;simrarr;slarr;smallsetminus;smashp;sm"
+	"eparsl;smid;smile;smt;smte;smtes;softcy;sol;solb;solbar;sopf;spades;spad"
+	"esuit;spar;sqcap;sqcaps;sqcup;sqcups;sqsub;sqsube;sqsubset;sqsubseteq;sq"
+	"sup;sqsupe;sqsupset;sqsupseteq;squ;square;squarf;squf;srarr;sscr;ssetmn;"
+	"ssmile;sstarf;star;starf;straightepsilon;straightphi;strns;sub;subE;subd"
+	"ot;sube;subedot;submult;subnE;subne;subplus;subrarr;subset;subseteq;subs"
+	"eteqq;subsetneq;subsetneqq;subsim;subsub;subsup;succ;succapprox;succcurl"
+	"yeq;succeq;succnapprox;succneqq;succnsim;succsim;sum;sung;sup1sup1;sup2s"
+	"up2;sup3sup3;sup;supE;supdot;supdsub;supe;supedot;suphsol;suphsub;suplar"
+	"r;supmult;supnE;supne;supplus;supset;supseteq;supseteqq;supsetneq;supset"
+	"neqq;supsim;supsub;supsup;swArr;swarhk;swarr;swarrow;swnwar;szligszlig;t"
+	"arget;tau;tbrk;tcaron;tcedil;tcy;tdot;telrec;tfr;there4;therefore;theta;"
+	"thetasym;thetav;thickapprox;thicksim;thinsp;thkap;thksim;thornthorn;tild"
+	"e;timestimes;timesb;timesbar;timesd;tint;toea;top;topbot;topcir;topf;top"
+	"fork;tosa;tprime;trade;triangle;triangledown;triangleleft;trianglelefteq"
+	";triangleq;triangleright;trianglerighteq;tridot;trie;triminus;triplus;tr"
+	"isb;tritime;trpezium;tscr;tscy;tshcy;tstrok;twixt;twoheadleftarrow;twohe"
+	"adrightarrow;uArr;uHar;uacuteuacute;uarr;ubrcy;ubreve;ucircucirc;ucy;uda"
+	"rr;udblac;udhar;ufisht;ufr;ugraveugrave;uharl;uharr;uhblk;ulcorn;ulcorne"
+	"r;ulcrop;ultri;umacr;umluml;uogon;uopf;uparrow;updownarrow;upharpoonleft"
+	";upharpoonright;uplus;upsi;upsih;upsilon;upuparrows;urcorn;urcorner;urcr"
+	"op;uring;urtri;uscr;utdot;utilde;utri;utrif;uuarr;uumluuml;uwangle;vArr;"
+	"vBar;vBarv;vDash;vangrt;varepsilon;varkappa;varnothing;varphi;varpi;varp"
+	"ropto;varr;varrho;varsigma;varsubsetneq;varsubsetneqq;varsupsetneq;varsu"
+	"psetneqq;vartheta;vartriangleleft;vartriangleright;vcy;vdash;vee;veebar;"
+	"veeeq;vellip;verbar;vert;vfr;vltri;vnsub;vnsup;vopf;vprop;vrtri;vscr;vsu"
+	"bnE;vsubne;vsupnE;vsupne;vzigzag;wcirc;wedbar;wedge;wedgeq;weierp;wfr;wo"
+	"pf;wp;wr;wreath;wscr;xcap;xcirc;xcup;xdtri;xfr;xhArr;xharr;xi;xlArr;xlar"
+	"r;xmap;xnis;xodot;xopf;xoplus;xotime;xrArr;xrarr;xscr;xsqcup;xuplus;xutr"
+	"i;xvee;xwedge;yacuteyacute;yacy;ycirc;ycy;yenyen;yfr;yicy;yopf;yscr;yucy"
+	";yumlyuml;zacute;zcaron;zcy;zdot;zeetrf;zeta;zfr;zhcy;zigrarr;zopf;zscr;"
+	"zwj;zwnj;";
+
+static const entity entity_table[ENTITY_SLOTS] = {
+	{ 63, 7, 2, { 0xc3, 0x80 } }, /* Agrave; */
+	{ 13685, 8, 3, { 0xe2, 0x84, 0x9b } }, /* realine; */
+	{ 3266, 19, 5, { 0xe2, 0xa7, 0x8f, 0xcc, 0xb8 } }, /* NotLeftTriangleBar; */
+	{ 2990, 17, 2, { 0xc2, 0xa0 } }, /* NonBreakingSpace; */
+	{ 8332, 6, 3, { 0xe2, 0x8b, 0xb1 } }, /* dtdot; */
+	{ 16533, 4, 2, { 0xc2, 0xa5 } }, /* yen; */
+	{ 5174, 5, 2, { 0xd0, 0xa6 } }, /* TScy; */
+	{ 9444, 5, 3, { 0xe2, 0x84, 0x8f } }, /* hbar; */
+	{ 6227, 6, 2, { 0xc3, 0x85 } }, /* angst; */
+	{ 5434, 17, 3, { 0xe2, 0x8f, 0x9d } }, /* UnderParenthesis; */
+	{ 12483, 6, 3, { 0xe2, 0x87, 0x96 } }, /* nwArr; */
+	{ 11157, 5, 3, { 0xe2, 0x9c, 0xa0 } }, /* malt; */
+	{ 15418, 7, 3, { 0xe2, 0x80, 0xb4 } }, /* tprime; */
+	{ 13297, 4, 2, { 0xcf, 0x88 } }, /* psi; */
+	{ 9319, 10, 3, { 0xe2, 0xaa, 0x86 } }, /* gtrapprox; */
+	{ 16338, 4, 4, { 0xf0, 0x9d, 0x94, 0xb4 } }, /* wfr; */
+	{ 8006, 3, 2, { 0xc2, 0xb0 } }, /* deg */
+	{ 16146, 16, 3, { 0xe2, 0x8a, 0xb2 } }, /* vartriangleleft; */
+	{ 13372, 5, 1, { 0x22 } }, /* quot; */
+	{ 11073, 8, 3, { 0xe2, 0xa9, 0xbb } }, /* ltquest; */
+	{ 0, 0, 0, { 0 } },
+	{ 13702, 6, 3, { 0xe2, 0x84, 0x9d } }, /* reals; */
+	{ 8877, 5, 4, { 0xf0, 0x9d, 0x95, 0x97 } }, /* fopf; */
+	{ 16446, 7, 3, { 0xe2, 0xa8, 0x82 } }, /* xotime; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 10307, 8, 3, { 0xe2, 0xa5, 0xa7 } }, /* ldrdhar; */
+	{ 12407, 5, 6, { 0xe2, 0x89, 0x8d, 0xe2, 0x83, 0x92 } }, /* nvap; */
+	{ 12581, 7, 3, { 0xe2, 0xa6, 0xbc } }, /* odsold; */
+	{ 3778, 18, 3, { 0xe2, 0x89, 0x87 } }, /* NotTildeFullEqual; */
+	{ 2420, 16, 3, { 0xe2, 0xa5, 0xa0 } }, /* LeftUpTeeVector; */
+	{ 602, 7, 3, { 0xe2, 0x80, 0xa1 } }, /* Dagger; */
+	{ 4082, 3, 2, { 0xce, 0xa0 } }, /* Pi; */
+	{ 13494, 6, 3, { 0xe2, 0xa4, 0xb3 } }, /* rarrc; */
+	{ 0, 0, 0, { 0 } },
+	{ 11798, 11, 3, { 0xe2, 0x86, 0x9a } }, /* nleftarrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 10168, 7, 3, { 0xe2, 0xa4, 0xb9 } }, /* larrpl; */
+	{ 4937, 13, 3, { 0xe2, 0x8a, 0x8f } }, /* SquareSubset; */
+	{ 2617, 14, 3, { 0xe2, 0x9f, 0xb5 } }, /* LongLeftArrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 16484, 6, 3, { 0xe2, 0x96, 0xb3 } }, /* xutri; */
+	{ 43, 6, 2, { 0xc3, 0x82 } }, /* Acirc; */
+	{ 2798, 4, 4, { 0xf0, 0x9d, 0x94, 0x90 } }, /* Mfr; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 14101, 9, 3, { 0xe2, 0xa7, 0x8e } }, /* rtriltri; */
+	{ 14163, 7, 2, { 0xc5, 0x9f } }, /* scedil; */
+	{ 0, 0, 0, { 0 } },
+	{ 12306, 5, 3, { 0xe2, 0x89, 0xb8 } }, /* ntlg; */
+	{ 8645, 11, 3, { 0xe2, 0xaa, 0x96 } }, /* eqslantgtr; */
+	{ 0, 0, 0, { 0 } },
+	{ 511, 10, 3, { 0xe2, 0x88, 0x90 } }, /* Coproduct; */
+	{ 4316, 19, 3, { 0xe2, 0x87, 0x8b } }, /* ReverseEquilibrium; */
+	{ 15796, 6, 2, { 0xc5, 0xb3 } }, /* uogon; */
+	{ 734, 8, 3, { 0xe2, 0x8b, 0x84 } }, /* Diamond; */
+	{ 14989, 4, 3, { 0xe2, 0x8a, 0x83 } }, /* sup; */
+	{ 14528, 5, 4, { 0xf0, 0x9d, 0x95, 0xa4 } }, /* sopf; */
+	{ 9748, 7, 3, { 0xe2, 0x84, 0x85 } }, /* incare; */
+	{ 3029, 10, 3, { 0xe2, 0x89, 0xad } }, /* NotCupCap; */
+	{ 15862, 5, 2, { 0xcf, 0x85 } }, /* upsi; */
+	{ 9113, 5, 3, { 0xe2, 0x89, 0xa7 } }, /* geqq; */
+	{ 0, 0, 0, { 0 } },
+	{ 11773, 6, 3, { 0xe2, 0x87, 0x8d } }, /* nlArr; */
+	{ 0, 0, 0, { 0 } },
+	{ 9472, 7, 3, { 0xe2, 0x80, 0xa6 } }, /* hellip; */
+	{ 16062, 5, 3, { 0xe2, 0x86, 0x95 } }, /* varr; */
+	{ 0, 0, 0, { 0 } },
+	{ 7389, 5, 2, { 0xcb, 0x86 } }, /* circ; */
+	{ 11203, 9, 3, { 0xe2, 0x86, 0xa5 } }, /* mapstoup; */
+	{ 16365, 5, 3, { 0xe2, 0x8b, 0x82 } }, /* xcap; */
+	{ 6468, 6, 3, { 0xe2, 0x80, 0x9e } }, /* bdquo; */
+	{ 2105, 11, 3, { 0xe2, 0x84, 0x92 } }, /* Laplacetrf; */
+	{ 0, 0, 0, { 0 } },
+	{ 9379, 10, 6, { 0xe2, 0x89, 0xa9, 0xef, 0xb8, 0x80 } }, /* gvertneqq; */
+	{ 4816, 4, 2, { 0xd0, 0xa1 } }, /* Scy; */
+	{ 4911, 7, 3, { 0xe2, 0x96, 0xa1 } }, /* Square; */
+	{ 7531, 6, 1, { 0x3a } }, /* colon; */
+	{ 1292, 5, 2, { 0xc4, 0x96 } }, /* Edot; */
+	{ 12713, 6, 3, { 0xe2, 0xa6, 0xb9 } }, /* operp; */
+	{ 14838, 10, 3, { 0xe2, 0x8a, 0x8a } }, /* subsetneq; */
+	{ 14377, 4, 3, { 0xe2, 0x88, 0xbc } }, /* sim; */
+	{ 6598, 16, 3, { 0xe2, 0x96, 0xbd } }, /* bigtriangledown; */
+	{ 1131, 18, 3, { 0xe2, 0xa5, 0x96 } }, /* DownLeftVectorBar; */
+	{ 5669, 7, 3, { 0xe2, 0xab, 0xa6 } }, /* Vdashl; */
+	{ 14915, 12, 3, { 0xe2, 0xaa, 0xba } }, /* succnapprox; */
+	{ 15078, 7, 3, { 0xe2, 0x8a, 0x83 } }, /* supset; */
+	{ 0, 0, 0, { 0 } },
+	{ 6788, 8, 6, { 0xe2, 0x89, 0xa1, 0xe2, 0x83, 0xa5 } }, /* bnequiv; */
+	{ 11610, 3, 3, { 0xe2, 0x89, 0xa0 } }, /* ne; */
+	{ 11595, 5, 3, { 0xe2, 0xa9, 0x82 } }, /* ncup; */
+	{ 1816, 5, 2, { 0xd0, 0x81 } }, /* IOcy; */
+	{ 8239, 15, 3, { 0xe2, 0x87, 0x8a } }, /* downdownarrows; */
+	{ 4187, 11, 3, { 0xe2, 0x88, 0xb7 } }, /* Proportion; */
+	{ 6280, 7, 3, { 0xe2, 0x89, 0x88 } }, /* approx; */
+	{ 0, 0, 0, { 0 } },
+	{ 12968, 10, 3, { 0xe2, 0x8b, 0x94 } }, /* pitchfork; */
+	{ 9195, 3, 3, { 0xe2, 0x89, 0xb7 } }, /* gl; */
+	{ 14804, 8, 3, { 0xe2, 0xa5, 0xb9 } }, /* subrarr; */
+	{ 11040, 6, 3, { 0xe2, 0xa9, 0xb9 } }, /* ltcir; */
+	{ 7537, 7, 3, { 0xe2, 0x89, 0x94 } }, /* colone; */
+	{ 14505, 7, 2, { 0xd1, 0x8c } }, /* softcy; */
+	{ 15382, 4, 3, { 0xe2, 0x8a, 0xa4 } }, /* top; */
+	{ 2665, 14, 3, { 0xe2, 0x9f, 0xb8 } }, /* Longleftarrow; */
+	{ 12160, 6, 3, { 0xe2, 0x88, 0xa6 } }, /* nspar; */
+	{ 5121, 9, 3, { 0xe2, 0x8a, 0x83 } }, /* Superset; */
+	{ 0, 0, 0, { 0 } },
+	{ 3571, 21, 3, { 0xe2, 0x8b, 0xa2 } }, /* NotSquareSubsetEqual; */
+	{ 8826, 6, 3, { 0xef, 0xac, 0x80 } }, /* fflig; */
+	{ 5225, 11, 6, { 0xe2, 0x81, 0x9f, 0xe2, 0x80, 0x8a } }, /* ThickSpace; */
+	{ 0, 0, 0, { 0 } },
+	{ 15719, 4, 4, { 0xf0, 0x9d, 0x94, 0xb2 } }, /* ufr; */
+	{ 6685, 14, 3, { 0xe2, 0x96, 0xb4 } }, /* blacktriangle; */
+	{ 13500, 7, 3, { 0xe2, 0xa4, 0x9e } }, /* rarrfs; */
+	{ 221, 5, 3, { 0xe2, 0x84, 0xac } }, /* Bscr; */
+	{ 5003, 12, 3, { 0xe2, 0x8a, 0x94 } }, /* SquareUnion; */
+	{ 3755, 9, 3, { 0xe2, 0x89, 0x81 } }, /* NotTilde; */
+	{ 5988, 5, 2, { 0xc2, 0xb4 } }, /* acute */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 8027, 7, 3, { 0xe2, 0xa5, 0xbf } }, /* dfisht; */
+	{ 0, 0, 0, { 0 } },
+	{ 14410, 5, 3, { 0xe2, 0xaa, 0x9d } }, /* siml; */
+	{ 9260, 5, 3, { 0xe2, 0x84, 0x8a } }, /* gscr; */
+	{ 16600, 5, 2, { 0xce, 0xb6 } }, /* zeta; */
+	{ 3865, 5, 2, { 0xc3, 0x94 } }, /* Ocirc */
+	{ 16001, 7, 3, { 0xe2, 0xa6, 0x9c } }, /* vangrt; */
+	{ 7040, 6, 3, { 0xe2, 0x94, 0x98 } }, /* boxul; */
+	{ 9265, 5, 3, { 0xe2, 0x89, 0xb3 } }, /* gsim; */
+	{ 14908, 7, 3, { 0xe2, 0xaa, 0xb0 } }, /* succeq; */
+	{ 0, 0, 0, { 0 } },
+	{ 13584, 7, 1, { 0x7d } }, /* rbrace; */
+	{ 13514, 7, 3, { 0xe2, 0x86, 0xac } }, /* rarrlp; */
+	{ 57, 6, 2, { 0xc3, 0x80 } }, /* Agrave */
+	{ 8099, 4, 2, { 0xc3, 0xb7 } }, /* div; */
+	{ 8453, 3, 3, { 0xe2, 0x85, 0x87 } }, /* ee; */
+	{ 6073, 4, 3, { 0xe2, 0x88, 0xa7 } }, /* and; */
+	{ 5627, 5, 4, { 0xf0, 0x9d, 0x92, 0xb0 } }, /* Uscr; */
+	{ 8509, 4, 3, { 0xe2, 0xaa, 0x95 } }, /* els; */
+	{ 0, 0, 0, { 0 } },
+	{ 15042, 8, 3, { 0xe2, 0xa5, 0xbb } }, /* suplarr; */
+	{ 15308, 6, 3, { 0xe2, 0x89, 0x88 } }, /* thkap; */
+	{ 0, 0, 0, { 0 } },
+	{ 8526, 6, 3, { 0xe2, 0x88, 0x85 } }, /* empty; */
+	{ 7197, 7, 2, { 0xc4, 0x87 } }, /* cacute; */
+	{ 5179, 4, 1, { 0x09 } }, /* Tab; */
+	{ 11698, 6, 5, { 0xe2, 0x89, 0xa7, 0xcc, 0xb8 } }, /* ngeqq; */
+	{ 7281, 7, 2, { 0xc3, 0xa7 } }, /* ccedil; */
+	{ 11059, 7, 3, { 0xe2, 0x8b, 0x89 } }, /* ltimes; */
+	{ 12939, 4, 4, { 0xf0, 0x9d, 0x94, 0xad } }, /* pfr; */
+	{ 385, 12, 3, { 0xe2, 0x8a, 0x97 } }, /* CircleTimes; */
+	{ 16546, 5, 4, { 0xf0, 0x9d, 0x95, 0xaa } }, /* yopf; */
+	{ 15070, 8, 3, { 0xe2, 0xab, 0x80 } }, /* supplus; */
+	{ 16200, 6, 3, { 0xe2, 0x89, 0x9a } }, /* veeeq; */
+	{ 12077, 6, 3, { 0xe2, 0x8b, 0xab } }, /* nrtri; */
+	{ 9574, 7, 2, { 0xc4, 0xa7 } }, /* hstrok; */
+	{ 1203, 8, 3, { 0xe2, 0x8a, 0xa4 } }, /* DownTee; */
+	{ 14550, 5, 3, { 0xe2, 0x88, 0xa5 } }, /* spar; */
+	{ 12554, 4, 2, { 0xd0, 0xbe } }, /* ocy; */
+	{ 2776, 12, 3, { 0xe2, 0x81, 0x9f } }, /* MediumSpace; */
+	{ 13018, 6, 3, { 0xe2, 0x8a, 0x9e } }, /* plusb; */
+	{ 7844, 7, 2, { 0xc2, 0xa4 } }, /* curren; */
+	{ 1585, 4, 4, { 0xf0, 0x9d, 0x94, 0x8a } }, /* Gfr; */
+	{ 3846, 6, 2, { 0xc5, 0x92 } }, /* OElig; */
+	{ 0, 0, 0, { 0 } },
+	{ 12799, 6, 2, { 0xc3, 0xb8 } }, /* oslash */
+	{ 4173, 6, 3, { 0xe2, 0x80, 0xb3 } }, /* Prime; */
+	{ 12728, 6, 3, { 0xe2, 0x86, 0xbb } }, /* orarr; */
+	{ 0, 0, 0, { 0 } },
+	{ 14043, 5, 4, { 0xf0, 0x9d, 0x93, 0x87 } }, /* rscr; */
+	{ 7238, 7, 3, { 0xe2, 0xa9, 0x80 } }, /* capdot; */
+	{ 7475, 12, 3, { 0xe2, 0x8a, 0x9d } }, /* circleddash; */
+	{ 9922, 4, 2, { 0xc3, 0xaf } }, /* iuml */
+	{ 5540, 6, 3, { 0xe2, 0x8a, 0xa5 } }, /* UpTee; */
+	{ 16305, 6, 2, { 0xc5, 0xb5 } }, /* wcirc; */
+	{ 11269, 4, 3, { 0xe2, 0x88, 0xa3 } }, /* mid; */
+	{ 6125, 9, 3, { 0xe2, 0xa6, 0xa8 } }, /* angmsdaa; */
+	{ 10891, 7, 3, { 0xe2, 0x88, 0x97 } }, /* lowast; */
+	{ 8983, 7, 2, { 0xc2, 0xbe } }, /* frac34; */
+	{ 13009, 9, 3, { 0xe2, 0xa8, 0xa3 } }, /* plusacir; */
+	{ 11328, 5, 3, { 0xe2, 0xab, 0x9b } }, /* mlcp; */
+	{ 14516, 5, 3, { 0xe2, 0xa7, 0x84 } }, /* solb; */
+	{ 12182, 5, 3, { 0xe2, 0x8a, 0x84 } }, /* nsub; */
+	{ 9728, 6, 2, { 0xc4, 0xb1 } }, /* imath; */
+	{ 9232, 5, 3, { 0xe2, 0xaa, 0x88 } }, /* gneq; */
+	{ 9298, 6, 3, { 0xe2, 0x8b, 0x97 } }, /* gtdot; */
+	{ 0, 5, 2, { 0xc3, 0x86 } }, /* AElig */
+	{ 9616, 6, 2, { 0xc3, 0xae } }, /* icirc; */
+	{ 4533, 14, 3, { 0xe2, 0x86, 0xa6 } }, /* RightTeeArrow; */
+	{ 1307, 7, 2, { 0xc3, 0x88 } }, /* Egrave; */
+	{ 8137, 5, 2, { 0xd1, 0x92 } }, /* djcy; */
+	{ 2894, 18, 3, { 0xe2, 0x80, 0x8b } }, /* NegativeThinSpace; */
+	{ 14077, 7, 3, { 0xe2, 0x8b, 0x8a } }, /* rtimes; */
+	{ 16110, 13, 6, { 0xe2, 0x8a, 0x8b, 0xef, 0xb8, 0x80 } }, /* varsupsetneq; */
+	{ 14512, 4, 1, { 0x2f } }, /* sol; */
+	{ 14146, 7, 2, { 0xc5, 0xa1 } }, /* scaron; */
+	{ 7754, 7, 3, { 0xe2, 0xa9, 0x8a } }, /* cupcup; */
+	{ 9004, 7, 3, { 0xe2, 0x85, 0x98 } }, /* frac45; */
+	{ 14271, 7, 3, { 0xe2, 0xa4, 0xa9 } }, /* seswar; */
+	{ 2045, 6, 2, { 0xce, 0x9a } }, /* Kappa; */
+	{ 1610, 17, 3, { 0xe2, 0x8b, 0x9b } }, /* GreaterEqualLess; */
+	{ 13634, 6, 3, { 0xe2, 0x8c, 0x89 } }, /* rceil; */
+	{ 9781, 7, 3, { 0xe2, 0x8a, 0xba } }, /* intcal; */
+	{ 16123, 14, 6, { 0xe2, 0xab, 0x8c, 0xef, 0xb8, 0x80 } }, /* varsupsetneqq; */
+	{ 13468, 5, 3, { 0xe2, 0x86, 0x92 } }, /* rarr; */
+	{ 4298, 3, 3, { 0xe2, 0x84, 0x9c } }, /* Re; */
+	{ 0, 0, 0, { 0 } },
+	{ 12242, 5, 3, { 0xe2, 0x8a, 0x85 } }, /* nsup; */
+	{ 16074, 9, 2, { 0xcf, 0x82 } }, /* varsigma; */
+	{ 5130, 14, 3, { 0xe2, 0x8a, 0x87 } }, /* SupersetEqual; */
+	{ 9806, 9, 3, { 0xe2, 0xa8, 0x97 } }, /* intlarhk; */
+	{ 14681, 7, 3, { 0xe2, 0x88, 0x96 } }, /* ssetmn; */
+	{ 8482, 4, 3, { 0xe2, 0xaa, 0x96 } }, /* egs; */
+	{ 14533, 7, 3, { 0xe2, 0x99, 0xa0 } }, /* spades; */
+	{ 12111, 10, 3, { 0xe2, 0x88, 0xa4 } }, /* nshortmid; */
+	{ 2040, 5, 2, { 0xd0, 0x8c } }, /* KJcy; */
+	{ 10955, 7, 3, { 0xe2, 0xa5, 0xad } }, /* lrhard; */
+	{ 5486, 11, 3, { 0xe2, 0xa4, 0x92 } }, /* UpArrowBar; */
+	{ 5015, 5, 4, { 0xf0, 0x9d, 0x92, 0xae } }, /* Sscr; */
+	{ 9304, 7, 3, { 0xe2, 0xa6, 0x95 } }, /* gtlPar; */
+	{ 8013, 6, 2, { 0xce, 0xb4 } }, /* delta; */
+	{ 0, 0, 0, { 0 } },
+	{ 97, 14, 3, { 0xe2, 0x81, 0xa1 } }, /* ApplyFunction; */
+	{ 8675, 7, 3, { 0xe2, 0x89, 0x9f } }, /* equest; */
+	{ 9916, 6, 2, { 0xd1, 0x96 } }, /* iukcy; */
+	{ 15556, 8, 3, { 0xe2, 0xa8, 0xbb } }, /* tritime; */
+	{ 14614, 6, 3, { 0xe2, 0x8a, 0x90 } }, /* sqsup; */
+	{ 7623, 7, 3, { 0xe2, 0x88, 0x90 } }, /* coprod; */
+	{ 6211, 9, 3, { 0xe2, 0xa6, 0x9d } }, /* angrtvbd; */
+	{ 9353, 11, 3, { 0xe2, 0xaa, 0x8c } }, /* gtreqqless; */
+	{ 6571, 10, 3, { 0xe2, 0xa8, 0x82 } }, /* bigotimes; */
+	{ 12259, 8, 6, { 0xe2, 0x8a, 0x83, 0xe2, 0x83, 0x92 } }, /* nsupset; */
+	{ 1277, 5, 2, { 0xc3, 0x8a } }, /* Ecirc */
+	{ 13562, 10, 3, { 0xe2, 0x84, 0x9a } }, /* rationals; */
+	{ 8085, 8, 2, { 0xcf, 0x9d } }, /* digamma; */
+	{ 0, 0, 0, { 0 } },
+	{ 11660, 6, 5, { 0xe2, 0x89, 0x82, 0xcc, 0xb8 } }, /* nesim; */
+	{ 9455, 7, 3, { 0xe2, 0x99, 0xa5 } }, /* hearts; */
+	{ 14095, 6, 3, { 0xe2, 0x96, 0xb8 } }, /* rtrif; */
+	{ 12094, 7, 3, { 0xe2, 0x8b, 0xa1 } }, /* nsccue; */
+	{ 9906, 3, 3, { 0xe2, 0x81, 0xa2 } }, /* it; */
+	{ 15338, 5, 2, { 0xc3, 0x97 } }, /* times */
+	{ 7794, 12, 3, { 0xe2, 0x8b, 0x9e } }, /* curlyeqprec; */
+	{ 0, 0, 0, { 0 } },
+	{ 756, 5, 4, { 0xf0, 0x9d, 0x94, 0xbb } }, /* Dopf; */
+	{ 1971, 5, 3, { 0xe2, 0x84, 0x90 } }, /* Iscr; */
+	{ 6098, 5, 3, { 0xe2, 0xa9, 0x9a } }, /* andv; */
+	{ 11372, 3, 2, { 0xce, 0xbc } }, /* mu; */
+	{ 12752, 4, 2, { 0xc2, 0xaa } }, /* ordf */
+	{ 7984, 8, 3, { 0xe2, 0x80, 0xa1 } }, /* ddagger; */
+	{ 166, 5, 3, { 0xe2, 0xab, 0xa7 } }, /* Barv; */
+	{ 13081, 3, 2, { 0xc2, 0xb1 } }, /* pm; */
+	{ 8349, 6, 3, { 0xe2, 0x87, 0xb5 } }, /* duarr; */
+	{ 4767, 7, 2, { 0xd0, 0xa9 } }, /* SHCHcy; */
+	{ 6275, 5, 1, { 0x27 } }, /* apos; */
+	{ 7135, 6, 3, { 0xe2, 0x8b, 0x8d } }, /* bsime; */
+	{ 5451, 6, 3, { 0xe2, 0x8b, 0x83 } }, /* Union; */
+	{ 10056, 4, 3, { 0xe2, 0xaa, 0x8b } }, /* lEg; */
+	{ 8571, 5, 3, { 0xe2, 0x80, 0x82 } }, /* ensp; */
+	{ 8997, 7, 3, { 0xe2, 0x85, 0x9c } }, /* frac38; */
+	{ 12837, 9, 3, { 0xe2, 0xa8, 0xb6 } }, /* otimesas; */
+	{ 5025, 4, 3, { 0xe2, 0x8b, 0x90 } }, /* Sub; */
+	{ 8103, 6, 2, { 0xc3, 0xb7 } }, /* divide */
+	{ 2733, 16, 3, { 0xe2, 0x86, 0x98 } }, /* LowerRightArrow; */
+	{ 1570, 6, 2, { 0xc4, 0x9c } }, /* Gcirc; */
+	{ 7184, 6, 3, { 0xe2, 0x89, 0x8f } }, /* bumpe; */
+	{ 1505, 5, 4, { 0xf0, 0x9d, 0x94, 0xbd } }, /* Fopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 4755, 12, 3, { 0xe2, 0xa7, 0xb4 } }, /* RuleDelayed; */
+	{ 6996, 6, 3, { 0xe2, 0x94, 0xb4 } }, /* boxhu; */
+	{ 215, 6, 2, { 0xcb, 0x98 } }, /* Breve; */
+	{ 6367, 5, 3, { 0xe2, 0xab, 0xad } }, /* bNot; */
+	{ 6381, 12, 2, { 0xcf, 0xb6 } }, /* backepsilon; */
+	{ 9856, 7, 2, { 0xc2, 0xbf } }, /* iquest; */
+	{ 16225, 4, 4, { 0xf0, 0x9d, 0x94, 0xb3 } }, /* vfr; */
+	{ 8389, 5, 3, { 0xe2, 0x89, 0x91 } }, /* eDot; */
+	{ 11530, 9, 3, { 0xe2, 0x84, 0x95 } }, /* naturals; */
+	{ 6936, 6, 3, { 0xe2, 0x95, 0x9f } }, /* boxVr; */
+	{ 14848, 11, 3, { 0xe2, 0xab, 0x8b } }, /* subsetneqq; */
+	{ 0, 0, 0, { 0 } },
+	{ 16605, 4, 4, { 0xf0, 0x9d, 0x94, 0xb7 } }, /* zfr; */
+	{ 4918, 19, 3, { 0xe2, 0x8a, 0x93 } }, /* SquareIntersection; */
+	{ 5367, 4, 2, { 0xd0, 0xa3 } }, /* Ucy; */
+	{ 5322, 7, 2, { 0xc3, 0x9a } }, /* Uacute; */
+	{ 0, 0, 0, { 0 } },
+	{ 12671, 6, 2, { 0xc5, 0x8d } }, /* omacr; */
+	{ 11099, 6, 3, { 0xe2, 0x97, 0x82 } }, /* ltrif; */
+	{ 15321, 5, 2, { 0xc3, 0xbe } }, /* thorn */
+	{ 6628, 9, 3, { 0xe2, 0xa8, 0x84 } }, /* biguplus; */
+	{ 14574, 7, 6, { 0xe2, 0x8a, 0x94, 0xef, 0xb8, 0x80 } }, /* sqcups; */
+	{ 10014, 5, 2, { 0xd1, 0x9c } }, /* kjcy; */
+	{ 15693, 6, 3, { 0xe2, 0x87, 0x85 } }, /* udarr; */
+	{ 9945, 6, 2, { 0xc8, 0xb7 } }, /* jmath; */
+	{ 12817, 6, 2, { 0xc3, 0xb5 } }, /* otilde */
+	{ 10984, 4, 3, { 0xe2, 0x86, 0xb0 } }, /* lsh; */
+	{ 10876, 7, 3, { 0xe2, 0xa8, 0xad } }, /* loplus; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 3513, 20, 5, { 0xe2, 0xa7, 0x90, 0xcc, 0xb8 } }, /* NotRightTriangleBar; */
+	{ 15273, 7, 2, { 0xcf, 0x91 } }, /* thetav; */
+	{ 3726, 12, 6, { 0xe2, 0x8a, 0x83, 0xe2, 0x83, 0x92 } }, /* NotSuperset; */
+	{ 12896, 5, 3, { 0xe2, 0x88, 0x82 } }, /* part; */
+	{ 0, 0, 0, { 0 } },
+	{ 5162, 6, 3, { 0xe2, 0x84, 0xa2 } }, /* TRADE; */
+	{ 2321, 8, 3, { 0xe2, 0x8a, 0xa3 } }, /* LeftTee; */
+	{ 5209, 10, 3, { 0xe2, 0x88, 0xb4 } }, /* Therefore; */
+	{ 10342, 14, 3, { 0xe2, 0x86, 0xa2 } }, /* leftarrowtail; */
+	{ 0, 0, 0, { 0 } },
+	{ 15165, 8, 3, { 0xe2, 0x86, 0x99 } }, /* swarrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 1297, 4, 4, { 0xf0, 0x9d, 0x94, 0x88 } }, /* Efr; */
+	{ 1366, 6, 2, { 0xc4, 0x98 } }, /* Eogon; */
+	{ 11893, 4, 2, { 0xc2, 0xac } }, /* not; */
+	{ 6990, 6, 3, { 0xe2, 0x94, 0xac } }, /* boxhd; */
+	{ 16264, 5, 4, { 0xf0, 0x9d, 0x93, 0x8b } }, /* vscr; */
+	{ 14141, 5, 3, { 0xe2, 0xaa, 0xb8 } }, /* scap; */
+	{ 15712, 7, 3, { 0xe2, 0xa5, 0xbe } }, /* ufisht; */
+	{ 14118, 3, 3, { 0xe2, 0x84, 0x9e } }, /* rx; */
+	{ 2567, 15, 3, { 0xe2, 0xa9, 0xbd } }, /* LessSlantEqual; */
+	{ 11052, 7, 3, { 0xe2, 0x8b, 0x8b } }, /* lthree; */
+	{ 7028, 6, 3, { 0xe2, 0x95, 0x9b } }, /* boxuL; */
+	{ 3929, 21, 3, { 0xe2, 0x80, 0x9c } }, /* OpenCurlyDoubleQuote; */
+	{ 5514, 12, 3, { 0xe2, 0x86, 0x95 } }, /* UpDownArrow; */
+	{ 12982, 7, 3, { 0xe2, 0x84, 0x8f } }, /* planck; */
+	{ 9025, 7, 3, { 0xe2, 0x85, 0x9e } }, /* frac78; */
+	{ 8303, 7, 3, { 0xe2, 0x8c, 0x8c } }, /* drcrop; */
+	{ 14336, 14, 3, { 0xe2, 0x88, 0xa5 } }, /* shortparallel; */
+	{ 16434, 5, 4, { 0xf0, 0x9d, 0x95, 0xa9 } }, /* xopf; */
+	{ 5800, 5, 4, { 0xf0, 0x9d, 0x95, 0x8e } }, /* Wopf; */
+	{ 10285, 4, 2, { 0xd0, 0xbb } }, /* lcy; */
+	{ 15792, 4, 2, { 0xc2, 0xa8 } }, /* uml; */
+	{ 0, 0, 0, { 0 } },
+	{ 9994, 4, 2, { 0xd0, 0xba } }, /* kcy; */
+	{ 3039, 21, 3, { 0xe2, 0x88, 0xa6 } }, /* NotDoubleVerticalBar; */
+	{ 9998, 4, 4, { 0xf0, 0x9d, 0x94, 0xa8 } }, /* kfr; */
+	{ 8325, 7, 2, { 0xc4, 0x91 } }, /* dstrok; */
+	{ 0, 0, 0, { 0 } },
+	{ 2758, 7, 2, { 0xc5, 0x81 } }, /* Lstrok; */
+	{ 12604, 5, 2, { 0xcb, 0x9b } }, /* ogon; */
+	{ 7152, 9, 3, { 0xe2, 0x9f, 0x88 } }, /* bsolhsub; */
+	{ 11685, 4, 5, { 0xe2, 0x89, 0xa7, 0xcc, 0xb8 } }, /* ngE; */
+	{ 10709, 11, 3, { 0xe2, 0x8e, 0xb0 } }, /* lmoustache; */
+	{ 4793, 3, 3, { 0xe2, 0xaa, 0xbc } }, /* Sc; */
+	{ 1592, 5, 4, { 0xf0, 0x9d, 0x94, 0xbe } }, /* Gopf; */
+	{ 2970, 8, 1, { 0x0a } }, /* NewLine; */
+	{ 8682, 6, 3, { 0xe2, 0x89, 0xa1 } }, /* equiv; */
+	{ 15815, 12, 3, { 0xe2, 0x86, 0x95 } }, /* updownarrow; */
+	{ 3633, 10, 6, { 0xe2, 0x8a, 0x82, 0xe2, 0x83, 0x92 } }, /* NotSubset; */
+	{ 8576, 6, 2, { 0xc4, 0x99 } }, /* eogon; */
+	{ 12997, 7, 3, { 0xe2, 0x84, 0x8f } }, /* plankv; */
+	{ 9974, 6, 2, { 0xce, 0xba } }, /* kappa; */
+	{ 13556, 6, 3, { 0xe2, 0x88, 0xb6 } }, /* ratio; */
+	{ 8728, 5, 3, { 0xe2, 0x89, 0x82 } }, /* esim; */
+	{ 0, 0, 0, { 0 } },
+	{ 5643, 5, 2, { 0xc3, 0x9c } }, /* Uuml; */
+	{ 12677, 6, 2, { 0xcf, 0x89 } }, /* omega; */
+	{ 0, 0, 0, { 0 } },
+	{ 11957, 8, 3, { 0xe2, 0x8b, 0xbe } }, /* notnivb; */
+	{ 13116, 5, 3, { 0xe2, 0xaa, 0xb7 } }, /* prap; */
+	{ 38, 5, 2, { 0xc3, 0x82 } }, /* Acirc */
+	{ 11809, 16, 3, { 0xe2, 0x86, 0xae } }, /* nleftrightarrow; */
+	{ 12517, 3, 3, { 0xe2, 0x93, 0x88 } }, /* oS; */
+	{ 10850, 15, 3, { 0xe2, 0x86, 0xac } }, /* looparrowright; */
+	{ 1253, 4, 2, { 0xc3, 0x90 } }, /* ETH; */
+	{ 9710, 9, 3, { 0xe2, 0x84, 0x90 } }, /* imagline; */
+	{ 10122, 6, 2, { 0xc2, 0xab } }, /* laquo; */
+	{ 11539, 4, 2, { 0xc2, 0xa0 } }, /* nbsp */
+	{ 8178, 9, 3, { 0xe2, 0x89, 0x91 } }, /* doteqdot; */
+	{ 5304, 5, 4, { 0xf0, 0x9d, 0x92, 0xaf } }, /* Tscr; */
+	{ 14309, 6, 3, { 0xe2, 0x99, 0xaf } }, /* sharp; */
+	{ 6859, 6, 3, { 0xe2, 0x95, 0xa9 } }, /* boxHU; */
+	{ 12083, 7, 3, { 0xe2, 0x8b, 0xad } }, /* nrtrie; */
+	{ 16515, 5, 2, { 0xd1, 0x8f } }, /* yacy; */
+	{ 7522, 9, 3, { 0xe2, 0x99, 0xa3 } }, /* clubsuit; */
+	{ 14756, 7, 3, { 0xe2, 0xaa, 0xbd } }, /* subdot; */
+	{ 13217, 5, 3, { 0xe2, 0xaa, 0xb5 } }, /* prnE; */
+	{ 15683, 6, 2, { 0xc3, 0xbb } }, /* ucirc; */
+	{ 12199, 8, 6, { 0xe2, 0x8a, 0x82, 0xe2, 0x83, 0x92 } }, /* nsubset; */
+	{ 11873, 7, 3, { 0xe2, 0x8b, 0xac } }, /* nltrie; */
+	{ 13301, 7, 3, { 0xe2, 0x80, 0x88 } }, /* puncsp; */
+	{ 10979, 5, 4, { 0xf0, 0x9d, 0x93, 0x81 } }, /* lscr; */
+	{ 7558, 7, 1, { 0x40 } }, /* commat; */
+	{ 6930, 6, 3, { 0xe2, 0x95, 0xa2 } }, /* boxVl; */
+	{ 6458, 6, 3, { 0xe2, 0x89, 0x8c } }, /* bcong; */
+	{ 0, 0, 0, { 0 } },
+	{ 11443, 12, 3, { 0xe2, 0x87, 0x8f } }, /* nRightarrow; */
+	{ 16403, 3, 2, { 0xce, 0xbe } }, /* xi; */
+	{ 6372, 9, 3, { 0xe2, 0x89, 0x8c } }, /* backcong; */
+	{ 11273, 7, 1, { 0x2a } }, /* midast; */
+	{ 13612, 8, 3, { 0xe2, 0xa6, 0x90 } }, /* rbrkslu; */
+	{ 15146, 6, 3, { 0xe2, 0x87, 0x99 } }, /* swArr; */
+	{ 0, 0, 0, { 0 } },
+	{ 140, 7, 2, { 0xc3, 0x83 } }, /* Atilde; */
+	{ 10765, 6, 3, { 0xe2, 0x87, 0xbd } }, /* loarr; */
+	{ 8421, 5, 3, { 0xe2, 0x89, 0x96 } }, /* ecir; */
+	{ 8315, 5, 2, { 0xd1, 0x95 } }, /* dscy; */
+	{ 10274, 6, 3, { 0xe2, 0x8c, 0x88 } }, /* lceil; */
+	{ 12636, 5, 3, { 0xe2, 0x88, 0xae } }, /* oint; */
+	{ 15761, 9, 3, { 0xe2, 0x8c, 0x9c } }, /* ulcorner; */
+	{ 10332, 10, 3, { 0xe2, 0x86, 0x90 } }, /* leftarrow; */
+	{ 15596, 6, 3, { 0xe2, 0x89, 0xac } }, /* twixt; */
+	{ 11586, 9, 5, { 0xe2, 0xa9, 0xad, 0xcc, 0xb8 } }, /* ncongdot; */
+	{ 6973, 5, 3, { 0xe2, 0x94, 0x80 } }, /* boxh; */
+	{ 0, 0, 0, { 0 } },
+	{ 3478, 18, 3, { 0xe2, 0x88, 0x8c } }, /* NotReverseElement; */
+	{ 8705, 6, 3, { 0xe2, 0x89, 0x93 } }, /* erDot; */
+	{ 1955, 6, 2, { 0xc4, 0xae } }, /* Iogon; */
+	{ 10300, 7, 3, { 0xe2, 0x80, 0x9e } }, /* ldquor; */
+	{ 1864, 7, 2, { 0xc3, 0x8c } }, /* Igrave; */
+	{ 2017, 5, 4, { 0xf0, 0x9d, 0x92, 0xa5 } }, /* Jscr; */
+	{ 10836, 14, 3, { 0xe2, 0x86, 0xab } }, /* looparrowleft; */
+	{ 2768, 4, 3, { 0xe2, 0xa4, 0x85 } }, /* Map; */
+	{ 13891, 16, 3, { 0xe2, 0x8b, 0x8c } }, /* rightthreetimes; */
+	{ 4513, 11, 3, { 0xe2, 0x8c, 0x8b } }, /* RightFloor; */
+	{ 15094, 10, 3, { 0xe2, 0xab, 0x86 } }, /* supseteqq; */
+	{ 8369, 5, 2, { 0xd1, 0x9f } }, /* dzcy; */
+	{ 2546, 12, 3, { 0xe2, 0x89, 0xb6 } }, /* LessGreater; */
+	{ 11105, 9, 3, { 0xe2, 0xa5, 0x8a } }, /* lurdshar; */
+	{ 829, 16, 3, { 0xe2, 0x87, 0x90 } }, /* DoubleLeftArrow; */
+	{ 6220, 7, 3, { 0xe2, 0x88, 0xa2 } }, /* angsph; */
+	{ 11430, 4, 5, { 0xe2, 0x8b, 0x98, 0xcc, 0xb8 } }, /* nLl; */
+	{ 11910, 9, 5, { 0xe2, 0x8b, 0xb5, 0xcc, 0xb8 } }, /* notindot; */
+	{ 9184, 6, 3, { 0xe2, 0x84, 0xb7 } }, /* gimel; */
+	{ 7204, 4, 3, { 0xe2, 0x88, 0xa9 } }, /* cap; */
+	{ 9093, 4, 2, { 0xd0, 0xb3 } }, /* gcy; */
+	{ 4950, 18, 3, { 0xe2, 0x8a, 0x91 } }, /* SquareSubsetEqual; */
+	{ 13649, 5, 3, { 0xe2, 0xa4, 0xb7 } }, /* rdca; */
+	{ 16556, 5, 2, { 0xd1, 0x8e } }, /* yucy; */
+	{ 1750, 5, 3, { 0xe2, 0x84, 0x8d } }, /* Hopf; */
+	{ 11293, 7, 2, { 0xc2, 0xb7 } }, /* middot; */
+	{ 10493, 5, 3, { 0xe2, 0x89, 0xa6 } }, /* leqq; */
+	{ 116, 6, 2, { 0xc3, 0x85 } }, /* Aring; */
+	{ 0, 0, 0, { 0 } },
+	{ 3825, 5, 4, { 0xf0, 0x9d, 0x92, 0xa9 } }, /* Nscr; */
+	{ 8361, 8, 3, { 0xe2, 0xa6, 0xa6 } }, /* dwangle; */
+	{ 597, 5, 2, { 0xd0, 0x8f } }, /* DZcy; */
+	{ 578, 9, 3, { 0xe2, 0xa4, 0x91 } }, /* DDotrahd; */
+	{ 1483, 22, 3, { 0xe2, 0x96, 0xaa } }, /* FilledVerySmallSquare; */
+	{ 10898, 7, 1, { 0x5f } }, /* lowbar; */
+	{ 10201, 5, 3, { 0xe2, 0xaa, 0xad } }, /* late; */
+	{ 4126, 14, 3, { 0xe2, 0xaa, 0xaf } }, /* PrecedesEqual; */
+	{ 16096, 14, 6, { 0xe2, 0xab, 0x8b, 0xef, 0xb8, 0x80 } }, /* varsubsetneqq; */
+	{ 0, 0, 0, { 0 } },
+	{ 16183, 6, 3, { 0xe2, 0x8a, 0xa2 } }, /* vdash; */
+	{ 15754, 7, 3, { 0xe2, 0x8c, 0x9c } }, /* ulcorn; */
+	{ 620, 7, 2, { 0xc4, 0x8e } }, /* Dcaron; */
+	{ 16046, 6, 2, { 0xcf, 0x96 } }, /* varpi; */
+	{ 700, 17, 1, { 0x60 } }, /* DiacriticalGrave; */
+	{ 6203, 8, 3, { 0xe2, 0x8a, 0xbe } }, /* angrtvb; */
+	{ 13383, 5, 3, { 0xe2, 0x87, 0x92 } }, /* rArr; */
+	{ 8819, 7, 3, { 0xef, 0xac, 0x83 } }, /* ffilig; */
+	{ 15034, 8, 3, { 0xe2, 0xab, 0x97 } }, /* suphsub; */
+	{ 9287, 5, 3, { 0xe2, 0xaa, 0xa7 } }, /* gtcc; */
+	{ 9797, 9, 3, { 0xe2, 0x8a, 0xba } }, /* intercal; */
+	{ 1854, 4, 3, { 0xe2, 0x84, 0x91 } }, /* Ifr; */
+	{ 6817, 7, 3, { 0xe2, 0x8b, 0x88 } }, /* bowtie; */
+	{ 5048, 9, 3, { 0xe2, 0x89, 0xbb } }, /* Succeeds; */
+	{ 13285, 7, 3, { 0xe2, 0x8a, 0xb0 } }, /* prurel; */
+	{ 7178, 6, 3, { 0xe2, 0xaa, 0xae } }, /* bumpE; */
+	{ 1671, 18, 3, { 0xe2, 0xa9, 0xbe } }, /* GreaterSlantEqual; */
+	{ 9508, 6, 3, { 0xe2, 0x87, 0xbf } }, /* hoarr; */
+	{ 0, 0, 0, { 0 } },
+	{ 16561, 4, 2, { 0xc3, 0xbf } }, /* yuml */
+	{ 0, 0, 0, { 0 } },
+	{ 6871, 6, 3, { 0xe2, 0x95, 0xa7 } }, /* boxHu; */
+	{ 2280, 10, 3, { 0xe2, 0x8c, 0x8a } }, /* LeftFloor; */
+	{ 9514, 7, 3, { 0xe2, 0x88, 0xbb } }, /* homtht; */
+	{ 16206, 7, 3, { 0xe2, 0x8b, 0xae } }, /* vellip; */
+	{ 10821, 15, 3, { 0xe2, 0x9f, 0xb6 } }, /* longrightarrow; */
+	{ 16039, 7, 2, { 0xcf, 0x95 } }, /* varphi; */
+	{ 11066, 7, 3, { 0xe2, 0xa5, 0xb6 } }, /* ltlarr; */
+	{ 2558, 9, 3, { 0xe2, 0xaa, 0xa1 } }, /* LessLess; */
+	{ 0, 0, 0, { 0 } },
+	{ 10865, 6, 3, { 0xe2, 0xa6, 0x85 } }, /* lopar; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 7069, 6, 3, { 0xe2, 0x95, 0x9e } }, /* boxvR; */
+	{ 12761, 4, 2, { 0xc2, 0xba } }, /* ordm */
+	{ 14729, 12, 2, { 0xcf, 0x95 } }, /* straightphi; */
+	{ 2465, 11, 3, { 0xe2, 0x86, 0xbc } }, /* LeftVector; */
+	{ 8872, 5, 2, { 0xc6, 0x92 } }, /* fnof; */
+	{ 11300, 6, 3, { 0xe2, 0x88, 0x92 } }, /* minus; */
+	{ 2093, 7, 2, { 0xce, 0x9b } }, /* Lambda; */
+	{ 4716, 5, 3, { 0xe2, 0x84, 0x9d } }, /* Ropf; */
+	{ 0, 0, 0, { 0 } },
+	{ 3968, 5, 4, { 0xf0, 0x9d, 0x92, 0xaa } }, /* Oscr; */
+	{ 7699, 8, 3, { 0xe2, 0xa4, 0xb5 } }, /* cudarrr; */
+	{ 5029, 7, 3, { 0xe2, 0x8b, 0x90 } }, /* Subset; */
+	{ 4901, 5, 4, { 0xf0, 0x9d, 0x95, 0x8a } }, /* Sopf; */
+	{ 1849, 5, 2, { 0xc4, 0xb0 } }, /* Idot; */
+	{ 7141, 5, 1, { 0x5c } }, /* bsol; */
+	{ 16290, 7, 6, { 0xe2, 0x8a, 0x8b, 0xef, 0xb8, 0x80 } }, /* vsupne; */
+	{ 4751, 4, 3, { 0xe2, 0x86, 0xb1 } }, /* Rsh; */
+	{ 12477, 6, 6, { 0xe2, 0x88, 0xbc, 0xe2, 0x83, 0x92 } }, /* nvsim; */
+	{ 12247, 6, 5, { 0xe2, 0xab, 0x86, 0xcc, 0xb8 } }, /* nsupE; */
+	{ 16614, 8, 3, { 0xe2, 0x87, 0x9d } }, /* zigrarr; */
+	{ 10009, 5, 2, { 0xd1, 0x85 } }, /* khcy; */
+	{ 1437, 7, 3, { 0xe2, 0x88, 0x83 } }, /* Exists; */
+	{ 10356, 16, 3, { 0xe2, 0x86, 0xbd } }, /* leftharpoondown; */
+	{ 7380, 4, 3, { 0xe2, 0x97, 0x8b } }, /* cir; */
+	{ 614, 6, 3, { 0xe2, 0xab, 0xa4 } }, /* Dashv; */
+	{ 2403, 17, 3, { 0xe2, 0xa5, 0x91 } }, /* LeftUpDownVector; */
+	{ 7208, 7, 3, { 0xe2, 0xa9, 0x84 } }, /* capand; */
+	{ 9394, 5, 3, { 0xe2, 0x87, 0x94 } }, /* hArr; */
+	{ 10791, 19, 3, { 0xe2, 0x9f, 0xb7 } }, /* longleftrightarrow; */
+	{ 14278, 9, 3, { 0xe2, 0x88, 0x96 } }, /* setminus; */
+	{ 11580, 6, 3, { 0xe2, 0x89, 0x87 } }, /* ncong; */
+	{ 15945, 5, 3, { 0xe2, 0x96, 0xb5 } }, /* utri; */
+	{ 1723, 4, 1, { 0x5e } }, /* Hat; */
+	{ 15292, 9, 3, { 0xe2, 0x88, 0xbc } }, /* thicksim; */
+	{ 2772, 4, 2, { 0xd0, 0x9c } }, /* Mcy; */
+	{ 15230, 7, 3, { 0xe2, 0x8c, 0x95 } }, /* telrec; */
+	{ 7100, 6, 2, { 0xcb, 0x98 } }, /* breve; */
+	{ 4562, 14, 3, { 0xe2, 0x8a, 0xb3 } }, /* RightTriangle; */
+	{ 12667, 4, 3, { 0xe2, 0xa7, 0x80 } }, /* olt; */
+	{ 1983, 6, 2, { 0xd0, 0x86 } }, /* Iukcy; */
+	{ 70, 6, 2, { 0xce, 0x91 } }, /* Alpha; */
+	{ 6233, 8, 3, { 0xe2, 0x8d, 0xbc } }, /* angzarr; */
+	{ 521, 32, 3, { 0xe2, 0x88, 0xb3 } }, /* CounterClockwiseContourIntegral; */
+	{ 12311, 14, 3, { 0xe2, 0x8b, 0xaa } }, /* ntriangleleft; */
+	{ 5020, 5, 3, { 0xe2, 0x8b, 0x86 } }, /* Star; */
+	{ 9228, 4, 3, { 0xe2, 0xaa, 0x88 } }, /* gne; */
+	{ 5371, 7, 2, { 0xc5, 0xb0 } }, /* Udblac; */
+	{ 15602, 17, 3, { 0xe2, 0x86, 0x9e } }, /* twoheadleftarrow; */
+	{ 15995, 6, 3, { 0xe2, 0x8a, 0xa8 } }, /* vDash; */
+	{ 5810, 4, 4, { 0xf0, 0x9d, 0x94, 0x9b } }, /* Xfr; */
+	{ 0, 0, 0, { 0 } },
+	{ 10450, 20, 3, { 0xe2, 0x86, 0xad } }, /* leftrightsquigarrow; */
+	{ 3094, 10, 3, { 0xe2, 0x88, 0x84 } }, /* NotExists; */
+	{ 14194, 9, 3, { 0xe2, 0xa8, 0x93 } }, /* scpolint; */
+	{ 4061, 9, 3, { 0xe2, 0x88, 0x82 } }, /* PartialD; */
+	{ 9739, 6, 2, { 0xc6, 0xb5 } }, /* imped; */
+	{ 9679, 7, 3, { 0xe2, 0xa7, 0x9c } }, /* iinfin; */
+	{ 11846, 5, 5, { 0xe2, 0xa9, 0xbd, 0xcc, 0xb8 } }, /* nles; */
+	{ 11746, 6, 3, { 0xe2, 0xab, 0xb2 } }, /* nhpar; */
+	{ 9438, 6, 3, { 0xe2, 0x86, 0xad } }, /* harrw; */
+	{ 0, 0, 0, { 0 } },
+	{ 13662, 6, 3, { 0xe2, 0x80, 0x9d } }, /* rdquo; */
+	{ 14203, 6, 3, { 0xe2, 0x89, 0xbf } }, /* scsim; */
+	{ 1827, 7, 2, { 0xc3, 0x8d } }, /* Iacute; */
+	{ 10630, 4, 3, { 0xe2, 0xaa, 0x91 } }, /* lgE; */
+	{ 16331, 7, 3, { 0xe2, 0x84, 0x98 } }, /* weierp; */
+	{ 11995, 6, 5, { 0xe2, 0x88, 0x82, 0xcc, 0xb8 } }, /* npart; */
+	{ 14962, 4, 2, { 0xc2, 0xb9 } }, /* sup1 */
+	{ 247, 7, 2, { 0xc4, 0x86 } }, /* Cacute; */
+	{ 14381, 7, 3, { 0xe2, 0xa9, 0xaa } }, /* simdot; */
+	{ 15827, 14, 3, { 0xe2, 0x86, 0xbf } }, /* upharpoonleft; */
+	{ 8038, 6, 3, { 0xe2, 0x87, 0x83 } }, /* dharl; */
+	{ 13166, 12, 3, { 0xe2, 0xaa, 0xb9 } }, /* precnapprox; */
+	{ 14057, 6, 3, { 0xe2, 0x80, 0x99 } }, /* rsquo; */
+	{ 7173, 5, 3, { 0xe2, 0x89, 0x8e } }, /* bump; */
+	{ 5767, 5, 4, { 0xf0, 0x9d, 0x95, 0x8d } }, /* Vopf; */
+	{ 14261, 5, 2, { 0xc2, 0xa7 } }, /* sect; */
+	{ 1993, 5, 2, { 0xc3, 0x8f } }, /* Iuml; */
+	{ 14499, 6, 6, { 0xe2, 0xaa, 0xac, 0xef, 0xb8, 0x80 } }, /* smtes; */
+	{ 16453, 6, 3, { 0xe2, 0x9f, 0xb9 } }, /* xrArr; */
+	{ 4238, 5, 4, { 0xf0, 0x9d, 0x92, 0xac } }, /* Qscr; */
+	{ 0, 0, 0, { 0 } },
+	{ 348, 4, 2, { 0xce, 0xa7 } }, /* Chi; */
+	{ 6637, 7, 3, { 0xe2, 0x8b, 0x81 } }, /* bigvee; */
+	{ 1010, 18, 3, { 0xe2, 0x88, 0xa5 } }, /* DoubleVerticalBar; */
+	{ 0, 0, 0, { 0 } },
+	{ 9777, 4, 3, { 0xe2, 0x88, 0xab } }, /* int; */
+	{ 1874, 6, 2, { 0xc4, 0xaa } }, /* Imacr; */
+	{ 0, 0, 0, { 0 } },
+	{ 9815, 8, 3, { 0xe2, 0xa8, 0xbc } }, /* intprod; */
+	{ 13645, 4, 2, { 0xd1, 0x80 } }, /* rcy; */
+	{ 11338, 7, 3, { 0xe2, 0x88, 0x93 } }, /* mnplus; */
+	{ 2599, 11, 3, { 0xe2, 0x87, 0x9a } }, /* Lleftarrow; */
+	{ 11522, 8, 3, { 0xe2, 0x99, 0xae } }, /* natural; */
+	{ 8717, 5, 3, { 0xe2, 0x84, 0xaf } }, /* escr; */
+	{ 13032, 7, 3, { 0xe2, 0x88, 0x94 } }, /* plusdo; */
+	{ 8109, 7, 2, { 0xc3, 0xb7 } }, /* divide; */
+	{ 16350, 3, 3, { 0xe2, 0x89, 0x80 } }, /* wr; */
+	{ 13858, 17, 3, { 0xe2, 0x87, 0x89 } }, /* rightrightarrows; */
+	{ 0, 0, 0, { 0 } },
+	{ 7376, 4, 2, { 0xcf, 0x87 } }, /* chi; */
+	{ 8949, 7, 3, { 0xe2, 0x85, 0x99 } }, /* frac16; */
+	{ 9900, 6, 3, { 0xe2, 0x88, 0x88 } }, /* isinv; */
+	{ 16193, 7, 3, { 0xe2, 0x8a, 0xbb } }, /* veebar; */
+	{ 13103, 6, 2, { 0xc2, 0xa3 } }, /* pound; */
+	{ 4774, 5, 2, { 0xd0, 0xa8 } }, /* SHcy; */
+	{ 2650, 15, 3, { 0xe2, 0x9f, 0xb6 } }, /* LongRightArrow; */
+	{ 1402, 12, 3, { 0xe2, 0x87, 0x8c } }, /* Equilibrium; */
+	{ 6089, 9, 3, { 0xe2, 0xa9, 0x98 } }, /* andslope; */
+	{ 7119, 5, 4, { 0xf0, 0x9d, 0x92, 0xb7 } }, /* bscr; */
+	{ 3830, 6, 2, { 0xc3, 0x91 } }, /* Ntilde */
+	{ 1912, 13, 3, { 0xe2, 0x8b, 0x82 } }, /* Intersection; */
+	{ 13322, 7, 3, { 0xe2, 0x81, 0x97 } }, /* qprime; */
+	{ 1821, 6, 2, { 0xc3, 0x8d } }, /* Iacute */
+	{ 0, 0, 0, { 0 } },
+	{ 13258, 9, 3, { 0xe2, 0x8c, 0x93 } }, /* profsurf; */
+	{ 7964, 6, 2, { 0xcb, 0x9d } }, /* dblac; */
+	{ 4478, 16, 3, { 0xe2, 0x87, 0x82 } }, /* RightDownVector; */
+	{ 10289, 5, 3, { 0xe2, 0xa4, 0xb6 } }, /* ldca; */
+	{ 5316, 6, 2, { 0xc3, 0x9a } }, /* Uacute */
+	{ 7262, 6, 3, { 0xe2, 0xa9, 0x8d } }, /* ccaps; */
+	{ 13210, 7, 3, { 0xe2, 0x84, 0x99 } }, /* primes; */
+	{ 3924, 5, 4, { 0xf0, 0x9d, 0x95, 0x86 } }, /* Oopf; */
+	{ 5763, 4, 4, { 0xf0, 0x9d, 0x94, 0x99 } }, /* Vfr; */
+	{ 15966, 5, 2, { 0xc3, 0xbc } }, /* uuml; */
+	{ 8496, 9, 3, { 0xe2, 0x8f, 0xa7 } }, /* elinters; */
+	{ 13713, 3, 2, { 0xc2, 0xae } }, /* reg */
+	{ 10917, 5, 3, { 0xe2, 0xa7, 0xab } }, /* lozf; */
+	{ 2051, 7, 2, { 0xc4, 0xb6 } }, /* Kcedil; */
+	{ 9198, 4, 3, { 0xe2, 0xaa, 0x92 } }, /* glE; */
+	{ 7300, 8, 3, { 0xe2, 0xa9, 0x90 } }, /* ccupssm; */
+	{ 7663, 5, 3, { 0xe2, 0xab, 0x8f } }, /* csub; */
+	{ 12013, 7, 3, { 0xe2, 0x8b, 0xa0 } }, /* nprcue; */
+	{ 12444, 5, 6, { 0xe2, 0x89, 0xa4, 0xe2, 0x83, 0x92 } }, /* nvle; */
+	{ 13240, 9, 3, { 0xe2, 0x8c, 0xae } }, /* profalar; */
+	{ 6877, 6, 3, { 0xe2, 0x95, 0x9d } }, /* boxUL; */
+	{ 0, 0, 0, { 0 } },
+	{ 352, 10, 3, { 0xe2, 0x8a, 0x99 } }, /* CircleDot; */
+	{ 12626, 6, 3, { 0xe2, 0xa6, 0xb5 } }, /* ohbar; */
+	{ 12744, 8, 3, { 0xe2, 0x84, 0xb4 } }, /* orderof; */
+	{ 5912, 15, 3, { 0xe2, 0x80, 0x8b } }, /* ZeroWidthSpace; */
+	{ 13433, 5, 3, { 0xe2, 0x9f, 0xa9 } }, /* rang; */
+	{ 14555, 6, 3, { 0xe2, 0x8a, 0x93 } }, /* sqcap; */
+	{ 11543, 5, 2, { 0xc2, 0xa0 } }, /* nbsp; */
+	{ 0, 0, 0, { 0 } },
+	{ 9329, 7, 3, { 0xe2, 0xa5, 0xb8 } }, /* gtrarr; */
+	{ 575, 3, 3, { 0xe2, 0x85, 0x85 } }, /* DD; */
+	{ 12959, 6, 3, { 0xe2, 0x98, 0x8e } }, /* phone; */
+	{ 8894, 6, 3, { 0xe2, 0xab, 0x99 } }, /* forkv; */
+	{ 10972, 7, 3, { 0xe2, 0x80, 0xb9 } }, /* lsaquo; */
+	{ 6784, 4, 4, { 0x3d, 0xe2, 0x83, 0xa5 } }, /* bne; */
+	{ 6836, 6, 3, { 0xe2, 0x95, 0x96 } }, /* boxDl; */
+	{ 15642, 5, 3, { 0xe2, 0xa5, 0xa3 } }, /* uHar; */
+	{ 13098, 5, 2, { 0xc2, 0xa3 } }, /* pound */
+	{ 2008, 4, 4, { 0xf0, 0x9d, 0x94, 0x8d } }, /* Jfr; */
+	{ 4407, 20, 3, { 0xe2, 0x87, 0x84 } }, /* RightArrowLeftArrow; */
+	{ 13360, 8, 3, { 0xe2, 0x89, 0x9f } }, /* questeq; */
+	{ 8592, 7, 3, { 0xe2, 0xa7, 0xa3 } }, /* eparsl; */
+	{ 7063, 6, 3, { 0xe2, 0x95, 0xa1 } }, /* boxvL; */
+	{ 10133, 6, 3, { 0xe2, 0x87, 0xa4 } }, /* larrb; */
+	{ 1414, 5, 3, { 0xe2, 0x84, 0xb0 } }, /* Escr; */
+	{ 9550, 5, 4, { 0xf0, 0x9d, 0x95, 0x99 } }, /* hopf; */
+	{ 16565, 5, 2, { 0xc3, 0xbf } }, /* yuml; */
+	{ 5187, 7, 2, { 0xc5, 0xa4 } }, /* Tcaron; */
+	{ 8149, 7, 3, { 0xe2, 0x8c, 0x8d } }, /* dlcrop; */
+	{ 0, 0, 0, { 0 } },
+	{ 5973, 4, 3, { 0xe2, 0x88, 0xbf } }, /* acd; */
+	{ 5071, 19, 3, { 0xe2, 0x89, 0xbd } }, /* SucceedsSlantEqual; */
+	{ 3071, 9, 3, { 0xe2, 0x89, 0xa0 } }, /* NotEqual; */
+	{ 11394, 4, 6, { 0xe2, 0x89, 0xab, 0xe2, 0x83, 0x92 } }, /* nGt; */
+	{ 6347, 5, 2, { 0xc3, 0xa4 } }, /* auml; */
+	{ 10667, 6, 3, { 0xe2, 0x87, 0x87 } }, /* llarr; */
+	{ 12520, 6, 2, { 0xc3, 0xb3 } }, /* oacute */
+	{ 9399, 7, 3, { 0xe2, 0x80, 0x8a } }, /* hairsp; */
+	{ 11640, 6, 5, { 0xe2, 0x89, 0x90, 0xcc, 0xb8 } }, /* nedot; */
+	{ 9118, 9, 3, { 0xe2, 0xa9, 0xbe } }, /* geqslant; */
+	{ 6444, 5, 3, { 0xe2, 0x8e, 0xb5 } }, /* bbrk; */
+	{ 16537, 4, 4, { 0xf0, 0x9d, 0x94, 0xb6 } }, /* yfr; */
+	{ 15583, 6, 2, { 0xd1, 0x9b } }, /* tshcy; */
+	{ 1263, 7, 2, { 0xc3, 0x89 } }, /* Eacute; */
+	{ 0, 0, 0, { 0 } },
+	{ 10546, 7, 3, { 0xe2, 0xaa, 0x93 } }, /* lesges; */
+	{ 10682, 7, 3, { 0xe2, 0xa5, 0xab } }, /* llhard; */
+	{ 1051, 17, 3, { 0xe2, 0x87, 0xb5 } }, /* DownArrowUpArrow; */
+	{ 1891, 8, 3, { 0xe2, 0x87, 0x92 } }, /* Implies; */
+	{ 15258, 6, 2, { 0xce, 0xb8 } }, /* theta; */
+	{ 10949, 6, 3, { 0xe2, 0x87, 0x8b } }, /* lrhar; */
+	{ 14873, 7, 3, { 0xe2, 0xab, 0x93 } }, /* subsup; */
+	{ 7215, 9, 3, { 0xe2, 0xa9, 0x89 } }, /* capbrcup; */
+	{ 12576, 5, 3, { 0xe2, 0x8a, 0x99 } }, /* odot; */
+	{ 151, 5, 2, { 0xc3, 0x84 } }, /* Auml; */
+	{ 0, 0, 0, { 0 } },
+	{ 8541, 7, 3, { 0xe2, 0x88, 0x85 } }, /* emptyv; */
+	{ 11455, 7, 3, { 0xe2, 0x8a, 0xaf } }, /* nVDash; */
+	{ 4023, 10, 3, { 0xe2, 0x8f, 0x9e } }, /* OverBrace; */
+	{ 2825, 5, 2, { 0xd0, 0x8a } }, /* NJcy; */
+	{ 3709, 17, 5, { 0xe2, 0x89, 0xbf, 0xcc, 0xb8 } }, /* NotSucceedsTilde; */
+	{ 16593, 7, 3, { 0xe2, 0x84, 0xa8 } }, /* zeetrf; */
+	{ 0, 0, 0, { 0 } },
+	{ 5263, 15, 3, { 0xe2, 0x89, 0x85 } }, /* TildeFullEqual; */
+	{ 11137, 6, 3, { 0xe2, 0x88, 0xba } }, /* mDDot; */
+	{ 92, 5, 4, { 0xf0, 0x9d, 0x94, 0xb8 } }, /* Aopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 13989, 5, 4, { 0xf0, 0x9d, 0x95, 0xa3 } }, /* ropf; */
+	{ 11779, 4, 5, { 0xe2, 0x89, 0xa6, 0xcc, 0xb8 } }, /* nlE; */
+	{ 8763, 6, 3, { 0xe2, 0x88, 0x83 } }, /* exist; */
+	{ 1385, 6, 3, { 0xe2, 0xa9, 0xb5 } }, /* Equal; */
+	{ 6069, 4, 1, { 0x26 } }, /* amp; */
+	{ 5526, 14, 3, { 0xe2, 0xa5, 0xae } }, /* UpEquilibrium; */
+	{ 3184, 21, 5, { 0xe2, 0xa9, 0xbe, 0xcc, 0xb8 } }, /* NotGreaterSlantEqual; */
+	{ 10218, 6, 3, { 0xe2, 0x9d, 0xb2 } }, /* lbbrk; */
+	{ 5252, 11, 3, { 0xe2, 0x89, 0x83 } }, /* TildeEqual; */
+	{ 14713, 16, 2, { 0xcf, 0xb5 } }, /* straightepsilon; */
+	{ 11174, 7, 3, { 0xe2, 0x86, 0xa6 } }, /* mapsto; */
+	{ 16541, 5, 2, { 0xd1, 0x97 } }, /* yicy; */
+	{ 9011, 7, 3, { 0xe2, 0x85, 0x9a } }, /* frac56; */
+	{ 11927, 8, 3, { 0xe2, 0x8b, 0xb7 } }, /* notinvb; */
+	{ 7081, 6, 3, { 0xe2, 0x94, 0xa4 } }, /* boxvl; */
+	{ 1038, 13, 3, { 0xe2, 0xa4, 0x93 } }, /* DownArrowBar; */
+	{ 6717, 18, 3, { 0xe2, 0x97, 0x82 } }, /* blacktriangleleft; */
+	{ 11132, 5, 6, { 0xe2, 0x89, 0xa8, 0xef, 0xb8, 0x80 } }, /* lvnE; */
+	{ 7034, 6, 3, { 0xe2, 0x95, 0x98 } }, /* boxuR; */
+	{ 8781, 13, 3, { 0xe2, 0x85, 0x87 } }, /* exponentiale; */
+	{ 10019, 5, 4, { 0xf0, 0x9d, 0x95, 0x9c } }, /* kopf; */
+	{ 5168, 6, 2, { 0xd0, 0x8b } }, /* TSHcy; */
+	{ 5343, 6, 2, { 0xd0, 0x8e } }, /* Ubrcy; */
+	{ 182, 8, 3, { 0xe2, 0x88, 0xb5 } }, /* Because; */
+	{ 9646, 4, 4, { 0xf0, 0x9d, 0x94, 0xa6 } }, /* ifr; */
+	{ 3080, 14, 5, { 0xe2, 0x89, 0x82, 0xcc, 0xb8 } }, /* NotEqualTilde; */
+	{ 0, 0, 0, { 0 } },
+	{ 2610, 7, 2, { 0xc4, 0xbf } }, /* Lmidot; */
+	{ 9430, 8, 3, { 0xe2, 0xa5, 0x88 } }, /* harrcir; */
+	{ 0, 0, 0, { 0 } },
+	{ 12454, 8, 6, { 0xe2, 0x8a, 0xb4, 0xe2, 0x83, 0x92 } }, /* nvltrie; */
+	{ 5941, 5, 4, { 0xf0, 0x9d, 0x92, 0xb5 } }, /* Zscr; */
+	{ 6474, 7, 3, { 0xe2, 0x88, 0xb5 } }, /* becaus; */
+	{ 7019, 9, 3, { 0xe2, 0x8a, 0xa0 } }, /* boxtimes; */
+	{ 1533, 5, 2, { 0xd0, 0x83 } }, /* GJcy; */
+	{ 4220, 4, 1, { 0x22 } }, /* QUOT */
+	{ 1234, 5, 4, { 0xf0, 0x9d, 0x92, 0x9f } }, /* Dscr; */
+	{ 0, 0, 0, { 0 } },
+	{ 12009, 4, 3, { 0xe2, 0x8a, 0x80 } }, /* npr; */
+	{ 14561, 7, 6, { 0xe2, 0x8a, 0x93, 0xef, 0xb8, 0x80 } }, /* sqcaps; */
+	{ 9788, 9, 3, { 0xe2, 0x84, 0xa4 } }, /* integers; */
+	{ 12703, 5, 4, { 0xf0, 0x9d, 0x95, 0xa0 } }, /* oopf; */
+	{ 13159, 7, 3, { 0xe2, 0xaa, 0xaf } }, /* preceq; */
+	{ 12696, 7, 3, { 0xe2, 0x8a, 0x96 } }, /* ominus; */
+	{ 1314, 8, 3, { 0xe2, 0x88, 0x88 } }, /* Element; */
+	{ 7685, 6, 3, { 0xe2, 0x8b, 0xaf } }, /* ctdot; */
+	{ 344, 4, 3, { 0xe2, 0x84, 0xad } }, /* Cfr; */
+	{ 5608, 5, 2, { 0xcf, 0x92 } }, /* Upsi; */
+	{ 13591, 7, 1, { 0x5d } }, /* rbrack; */
+	{ 10871, 5, 4, { 0xf0, 0x9d, 0x95, 0x9d } }, /* lopf; */
+	{ 7324, 8, 3, { 0xe2, 0xa6, 0xb2 } }, /* cemptyv; */
+	{ 11230, 6, 3, { 0xe2, 0x80, 0x94 } }, /* mdash; */
+	{ 4382, 11, 3, { 0xe2, 0x86, 0x92 } }, /* RightArrow; */
+	{ 11890, 3, 2, { 0xc2, 0xac } }, /* not */
+	{ 1540, 3, 1, { 0x3e } }, /* GT; */
+	{ 3205, 16, 3, { 0xe2, 0x89, 0xb5 } }, /* NotGreaterTilde; */
+	{ 4459, 19, 3, { 0xe2, 0xa5, 0x9d } }, /* RightDownTeeVector; */
+	{ 781, 22, 3, { 0xe2, 0x88, 0xaf } }, /* DoubleContourIntegral; */
+	{ 6179, 9, 3, { 0xe2, 0xa6, 0xae } }, /* angmsdag; */
+	{ 5654, 5, 3, { 0xe2, 0xab, 0xab } }, /* Vbar; */
+	{ 5194, 7, 2, { 0xc5, 0xa2 } }, /* Tcedil; */
+	{ 2713, 5, 4, { 0xf0, 0x9d, 0x95, 0x83 } }, /* Lopf; */
+	{ 564, 4, 3, { 0xe2, 0x8b, 0x93 } }, /* Cup; */
+	{ 9961, 7, 2, { 0xd1, 0x98 } }, /* jsercy; */
+	{ 2875, 19, 3, { 0xe2, 0x80, 0x8b } }, /* NegativeThickSpace; */
+	{ 7652, 6, 3, { 0xe2, 0x9c, 0x97 } }, /* cross; */
+	{ 13572, 6, 3, { 0xe2, 0xa4, 0x8d } }, /* rbarr; */
+	{ 6906, 6, 3, { 0xe2, 0x95, 0xac } }, /* boxVH; */
+	{ 11764, 4, 3, { 0xe2, 0x88, 0x8b } }, /* niv; */
+	{ 1880, 11, 3, { 0xe2, 0x85, 0x88 } }, /* ImaginaryI; */
+	{ 7487, 5, 3, { 0xe2, 0x89, 0x97 } }, /* cire; */
+	{ 13994, 7, 3, { 0xe2, 0xa8, 0xae } }, /* roplus; */
+	{ 4140, 19, 3, { 0xe2, 0x89, 0xbc } }, /* PrecedesSlantEqual; */
+	{ 6107, 5, 3, { 0xe2, 0xa6, 0xa4 } }, /* ange; */
+	{ 0, 0, 0, { 0 } },
+	{ 10720, 4, 3, { 0xe2, 0x89, 0xa8 } }, /* lnE; */
+	{ 9202, 4, 3, { 0xe2, 0xaa, 0xa5 } }, /* gla; */
+	{ 10489, 4, 3, { 0xe2, 0x89, 0xa4 } }, /* leq; */
+	{ 8287, 9, 3, { 0xe2, 0xa4, 0x90 } }, /* drbkarow; */
+	{ 11365, 7, 3, { 0xe2, 0x88, 0xbe } }, /* mstpos; */
+	{ 7774, 5, 6, { 0xe2, 0x88, 0xaa, 0xef, 0xb8, 0x80 } }, /* cups; */
+	{ 13187, 9, 3, { 0xe2, 0x8b, 0xa8 } }, /* precnsim; */
+	{ 11226, 4, 2, { 0xd0, 0xbc } }, /* mcy; */
+	{ 5378, 4, 4, { 0xf0, 0x9d, 0x94, 0x98 } }, /* Ufr; */
+	{ 10294, 6, 3, { 0xe2, 0x80, 0x9c } }, /* ldquo; */
+	{ 9166, 7, 3, { 0xe2, 0xaa, 0x94 } }, /* gesles; */
+	{ 14187, 7, 3, { 0xe2, 0x8b, 0xa9 } }, /* scnsim; */
+	{ 0, 0, 0, { 0 } },
+	{ 2490, 10, 3, { 0xe2, 0x87, 0x90 } }, /* Leftarrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 1250, 3, 2, { 0xc3, 0x90 } }, /* ETH */
+	{ 8469, 6, 2, { 0xc3, 0xa8 } }, /* egrave */
+	{ 2532, 14, 3, { 0xe2, 0x89, 0xa6 } }, /* LessFullEqual; */
+	{ 15431, 9, 3, { 0xe2, 0x96, 0xb5 } }, /* triangle; */
+	{ 0, 0, 0, { 0 } },
+	{ 7894, 9, 3, { 0xe2, 0x88, 0xb2 } }, /* cwconint; */
+	{ 15770, 7, 3, { 0xe2, 0x8c, 0x8f } }, /* ulcrop; */
+	{ 0, 0, 0, { 0 } },
+	{ 5784, 6, 2, { 0xc5, 0xb4 } }, /* Wcirc; */
+	{ 5621, 6, 2, { 0xc5, 0xae } }, /* Uring; */
+	{ 6528, 4, 4, { 0xf0, 0x9d, 0x94, 0x9f } }, /* bfr; */
+	{ 15386, 7, 3, { 0xe2, 0x8c, 0xb6 } }, /* topbot; */
+	{ 14363, 7, 2, { 0xcf, 0x82 } }, /* sigmaf; */
+	{ 0, 0, 0, { 0 } },
+	{ 3555, 16, 5, { 0xe2, 0x8a, 0x8f, 0xcc, 0xb8 } }, /* NotSquareSubset; */
+	{ 11719, 6, 3, { 0xe2, 0x89, 0xb5 } }, /* ngsim; */
+	{ 3342, 12, 5, { 0xe2, 0x89, 0xaa, 0xcc, 0xb8 } }, /* NotLessLess; */
+	{ 8977, 6, 2, { 0xc2, 0xbe } }, /* frac34 */
+	{ 11147, 5, 2, { 0xc2, 0xaf } }, /* macr; */
+	{ 0, 0, 0, { 0 } },
+	{ 171, 7, 3, { 0xe2, 0x8c, 0x86 } }, /* Barwed; */
+	{ 0, 0, 0, { 0 } },
+	{ 12890, 6, 3, { 0xe2, 0xab, 0xbd } }, /* parsl; */
+	{ 10095, 5, 3, { 0xe2, 0x9f, 0xa8 } }, /* lang; */
+	{ 0, 0, 0, { 0 } },
+	{ 10194, 7, 3, { 0xe2, 0xa4, 0x99 } }, /* latail; */
+	{ 3104, 11, 3, { 0xe2, 0x89, 0xaf } }, /* NotGreater; */
+	{ 4280, 7, 2, { 0xc5, 0x98 } }, /* Rcaron; */
+	{ 6778, 6, 3, { 0xe2, 0x96, 0x88 } }, /* block; */
+	{ 8832, 7, 3, { 0xef, 0xac, 0x84 } }, /* ffllig; */
+	{ 5932, 4, 3, { 0xe2, 0x84, 0xa8 } }, /* Zfr; */
+	{ 0, 0, 0, { 0 } },
+	{ 9411, 7, 3, { 0xe2, 0x84, 0x8b } }, /* hamilt; */
+	{ 8587, 5, 3, { 0xe2, 0x8b, 0x95 } }, /* epar; */
+	{ 11755, 4, 3, { 0xe2, 0x8b, 0xbc } }, /* nis; */
+	{ 8172, 6, 3, { 0xe2, 0x89, 0x90 } }, /* doteq; */
+	{ 6118, 7, 3, { 0xe2, 0x88, 0xa1 } }, /* angmsd; */
+	{ 12571, 5, 3, { 0xe2, 0xa8, 0xb8 } }, /* odiv; */
+	{ 14052, 5, 1, { 0x5d } }, /* rsqb; */
+	{ 7940, 5, 3, { 0xe2, 0x86, 0x93 } }, /* darr; */
+	{ 12193, 6, 3, { 0xe2, 0x8a, 0x88 } }, /* nsube; */
+	{ 9956, 5, 4, { 0xf0, 0x9d, 0x92, 0xbf } }, /* jscr; */
+	{ 10470, 15, 3, { 0xe2, 0x8b, 0x8b } }, /* leftthreetimes; */
+	{ 8196, 8, 3, { 0xe2, 0x88, 0x94 } }, /* dotplus; */
+	{ 15619, 18, 3, { 0xe2, 0x86, 0xa0 } }, /* twoheadrightarrow; */
+	{ 1432, 5, 2, { 0xc3, 0x8b } }, /* Euml; */
+	{ 7146, 6, 3, { 0xe2, 0xa7, 0x85 } }, /* bsolb; */
+	{ 14581, 6, 3, { 0xe2, 0x8a, 0x8f } }, /* sqsub; */
+	{ 12277, 11, 5, { 0xe2, 0xab, 0x86, 0xcc, 0xb8 } }, /* nsupseteqq; */
+	{ 7838, 6, 2, { 0xc2, 0xa4 } }, /* curren */
+	{ 1510, 7, 3, { 0xe2, 0x88, 0x80 } }, /* ForAll; */
+	{ 4360, 4, 2, { 0xce, 0xa1 } }, /* Rho; */
+	{ 15956, 6, 3, { 0xe2, 0x87, 0x88 } }, /* uuarr; */
+	{ 13620, 7, 2, { 0xc5, 0x99 } }, /* rcaron; */
+	{ 0, 0, 0, { 0 } },
+	{ 14063, 7, 3, { 0xe2, 0x80, 0x99 } }, /* rsquor; */
+	{ 6112, 6, 3, { 0xe2, 0x88, 0xa0 } }, /* angle; */
+	{ 9931, 6, 2, { 0xc4, 0xb5 } }, /* jcirc; */
+	{ 0, 0, 0, { 0 } },
+	{ 14702, 5, 3, { 0xe2, 0x98, 0x86 } }, /* star; */
+	{ 2356, 13, 3, { 0xe2, 0x8a, 0xb2 } }, /* LeftTriangle; */
+	{ 4268, 5, 3, { 0xe2, 0x86, 0xa0 } }, /* Rarr; */
+	{ 10161, 7, 3, { 0xe2, 0x86, 0xab } }, /* larrlp; */
+	{ 10634, 6, 3, { 0xe2, 0x86, 0xbd } }, /* lhard; */
+	{ 587, 5, 2, { 0xd0, 0x82 } }, /* DJcy; */
+	{ 14153, 6, 3, { 0xe2, 0x89, 0xbd } }, /* sccue; */
+	{ 8935, 7, 2, { 0xc2, 0xbc } }, /* frac14; */
+	{ 4095, 14, 3, { 0xe2, 0x84, 0x8c } }, /* Poincareplane; */
+	{ 9490, 9, 3, { 0xe2, 0xa4, 0xa5 } }, /* hksearow; */
+	{ 2955, 15, 3, { 0xe2, 0x89, 0xaa } }, /* NestedLessLess; */
+	{ 1517, 11, 3, { 0xe2, 0x84, 0xb1 } }, /* Fouriertrf; */
+	{ 13680, 5, 3, { 0xe2, 0x84, 0x9c } }, /* real; */
+	{ 8034, 4, 4, { 0xf0, 0x9d, 0x94, 0xa1 } }, /* dfr; */
+	{ 813, 16, 3, { 0xe2, 0x87, 0x93 } }, /* DoubleDownArrow; */
+	{ 12380, 7, 3, { 0xe2, 0x84, 0x96 } }, /* numero; */
+	{ 2086, 7, 2, { 0xc4, 0xb9 } }, /* Lacute; */
+	{ 8187, 9, 3, { 0xe2, 0x88, 0xb8 } }, /* dotminus; */
+	{ 6912, 6, 3, { 0xe2, 0x95, 0xa3 } }, /* boxVL; */
+	{ 8963, 7, 3, { 0xe2, 0x85, 0x94 } }, /* frac23; */
+	{ 4159, 14, 3, { 0xe2, 0x89, 0xbe } }, /* PrecedesTilde; */
+	{ 13418, 6, 3, { 0xe2, 0x88, 0x9a } }, /* radic; */
+	{ 0, 0, 0, { 0 } },
+	{ 9109, 4, 3, { 0xe2, 0x89, 0xa5 } }, /* geq; */
+	{ 10060, 5, 3, { 0xe2, 0xa5, 0xa2 } }, /* lHar; */
+	{ 0, 0, 0, { 0 } },
+	{ 5879, 5, 2, { 0xc5, 0xb8 } }, /* Yuml; */
+	{ 3870, 6, 2, { 0xc3, 0x94 } }, /* Ocirc; */
+	{ 13147, 12, 3, { 0xe2, 0x89, 0xbc } }, /* preccurlyeq; */
+	{ 3876, 4, 2, { 0xd0, 0x9e } }, /* Ocy; */
+	{ 5219, 6, 2, { 0xce, 0x98 } }, /* Theta; */
+	{ 10190, 4, 3, { 0xe2, 0xaa, 0xab } }, /* lat; */
+	{ 1239, 7, 2, { 0xc4, 0x90 } }, /* Dstrok; */
+	{ 374, 11, 3, { 0xe2, 0x8a, 0x95 } }, /* CirclePlus; */
+	{ 7093, 7, 3, { 0xe2, 0x80, 0xb5 } }, /* bprime; */
+	{ 14327, 9, 3, { 0xe2, 0x88, 0xa3 } }, /* shortmid; */
+	{ 1597, 13, 3, { 0xe2, 0x89, 0xa5 } }, /* GreaterEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 8610, 8, 2, { 0xce, 0xb5 } }, /* epsilon; */
+	{ 13052, 6, 2, { 0xc2, 0xb1 } }, /* plusmn */
+	{ 5361, 6, 2, { 0xc3, 0x9b } }, /* Ucirc; */
+	{ 8437, 7, 3, { 0xe2, 0x89, 0x95 } }, /* ecolon; */
+	{ 14828, 10, 3, { 0xe2, 0xab, 0x85 } }, /* subseteqq; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 1925, 15, 3, { 0xe2, 0x81, 0xa3 } }, /* InvisibleComma; */
+	{ 16083, 13, 6, { 0xe2, 0x8a, 0x8a, 0xef, 0xb8, 0x80 } }, /* varsubsetneq; */
+	{ 4356, 4, 3, { 0xe2, 0x84, 0x9c } }, /* Rfr; */
+	{ 15104, 10, 3, { 0xe2, 0x8a, 0x8b } }, /* supsetneq; */
+	{ 82, 4, 3, { 0xe2, 0xa9, 0x93 } }, /* And; */
+	{ 7577, 11, 3, { 0xe2, 0x88, 0x81 } }, /* complement; */
+	{ 8229, 10, 3, { 0xe2, 0x86, 0x93 } }, /* downarrow; */
+	{ 4612, 18, 3, { 0xe2, 0xa5, 0x8f } }, /* RightUpDownVector; */
+	{ 9850, 6, 2, { 0xc2, 0xbf } }, /* iquest */
+	{ 9032, 6, 3, { 0xe2, 0x81, 0x84 } }, /* frasl; */
+	{ 7166, 7, 3, { 0xe2, 0x80, 0xa2 } }, /* bullet; */
+	{ 8758, 5, 1, { 0x21 } }, /* excl; */
+	{ 8168, 4, 2, { 0xcb, 0x99 } }, /* dot; */
+	{ 11973, 5, 3, { 0xe2, 0x88, 0xa6 } }, /* npar; */
+	{ 11825, 5, 3, { 0xe2, 0x89, 0xb0 } }, /* nleq; */
+	{ 1428, 4, 2, { 0xc3, 0x8b } }, /* Euml */
+	{ 12025, 6, 3, { 0xe2, 0x8a, 0x80 } }, /* nprec; */
+	{ 1775, 7, 2, { 0xc4, 0xa6 } }, /* Hstrok; */
+	{ 16495, 7, 3, { 0xe2, 0x8b, 0x80 } }, /* xwedge; */
+	{ 14230, 6, 3, { 0xe2, 0x87, 0x98 } }, /* seArr; */
+	{ 7552, 6, 1, { 0x2c } }, /* comma; */
+	{ 9698, 6, 2, { 0xc4, 0xab } }, /* imacr; */
+	{ 0, 0, 0, { 0 } },
+	{ 12136, 5, 3, { 0xe2, 0x89, 0x81 } }, /* nsim; */
+	{ 9214, 5, 3, { 0xe2, 0xaa, 0x8a } }, /* gnap; */
+	{ 6961, 6, 3, { 0xe2, 0x94, 0x90 } }, /* boxdl; */
+	{ 11919, 8, 3, { 0xe2, 0x88, 0x89 } }, /* notinva; */
+	{ 1839, 6, 2, { 0xc3, 0x8e } }, /* Icirc; */
+	{ 3385, 24, 5, { 0xe2, 0xaa, 0xa2, 0xcc, 0xb8 } }, /* NotNestedGreaterGreater; */
+	{ 8808, 4, 2, { 0xd1, 0x84 } }, /* fcy; */
+	{ 12217, 11, 5, { 0xe2, 0xab, 0x85, 0xcc, 0xb8 } }, /* nsubseteqq; */
+	{ 3115, 16, 3, { 0xe2, 0x89, 0xb1 } }, /* NotGreaterEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 12931, 8, 3, { 0xe2, 0x80, 0xb1 } }, /* pertenk; */
+	{ 4906, 5, 3, { 0xe2, 0x88, 0x9a } }, /* Sqrt; */
+	{ 14896, 12, 3, { 0xe2, 0x89, 0xbd } }, /* succcurlyeq; */
+	{ 111, 5, 2, { 0xc3, 0x85 } }, /* Aring */
+	{ 13317, 5, 4, { 0xf0, 0x9d, 0x95, 0xa2 } }, /* qopf; */
+	{ 12373, 3, 2, { 0xce, 0xbd } }, /* nu; */
+	{ 1377, 8, 2, { 0xce, 0x95 } }, /* Epsilon; */
+	{ 10088, 7, 2, { 0xce, 0xbb } }, /* lambda; */
+	{ 11263, 6, 2, { 0xc2, 0xb5 } }, /* micro; */
+	{ 15665, 6, 2, { 0xd1, 0x9e } }, /* ubrcy; */
+	{ 11390, 4, 5, { 0xe2, 0x8b, 0x99, 0xcc, 0xb8 } }, /* nGg; */
+	{ 3327, 15, 3, { 0xe2, 0x89, 0xb8 } }, /* NotLessGreater; */
+	{ 12090, 4, 3, { 0xe2, 0x8a, 0x81 } }, /* nsc; */
+	{ 1710, 7, 2, { 0xd0, 0xaa } }, /* HARDcy; */
+	{ 0, 0, 0, { 0 } },
+	{ 14181, 6, 3, { 0xe2, 0xaa, 0xba } }, /* scnap; */
+	{ 15185, 6, 2, { 0xc3, 0x9f } }, /* szlig; */
+	{ 0, 0, 0, { 0 } },
+	{ 9018, 7, 3, { 0xe2, 0x85, 0x9d } }, /* frac58; */
+	{ 7565, 5, 3, { 0xe2, 0x88, 0x81 } }, /* comp; */
+	{ 0, 0, 0, { 0 } },
+	{ 9622, 4, 2, { 0xd0, 0xb8 } }, /* icy; */
+	{ 14213, 5, 3, { 0xe2, 0x8b, 0x85 } }, /* sdot; */
+	{ 7075, 6, 3, { 0xe2, 0x94, 0xbc } }, /* boxvh; */
+	{ 4746, 5, 3, { 0xe2, 0x84, 0x9b } }, /* Rscr; */
+	{ 1576, 4, 2, { 0xd0, 0x93 } }, /* Gcy; */
+	{ 13965, 6, 3, { 0xe2, 0x9f, 0xad } }, /* roang; */
+	{ 53, 4, 4, { 0xf0, 0x9d, 0x94, 0x84 } }, /* Afr; */
+	{ 0, 0, 0, { 0 } },
+	{ 16439, 7, 3, { 0xe2, 0xa8, 0x81 } }, /* xoplus; */
+	{ 4117, 9, 3, { 0xe2, 0x89, 0xba } }, /* Precedes; */
+	{ 15405, 8, 3, { 0xe2, 0xab, 0x9a } }, /* topfork; */
+	{ 5546, 11, 3, { 0xe2, 0x86, 0xa5 } }, /* UpTeeArrow; */
+	{ 16636, 5, 3, { 0xe2, 0x80, 0x8c } }, /* zwnj; */
+	{ 15326, 6, 2, { 0xc3, 0xbe } }, /* thorn; */
+	{ 13329, 5, 4, { 0xf0, 0x9d, 0x93, 0x86 } }, /* qscr; */
+	{ 15533, 9, 3, { 0xe2, 0xa8, 0xba } }, /* triminus; */
+	{ 9284, 3, 1, { 0x3e } }, /* gt; */
+	{ 190, 11, 3, { 0xe2, 0x84, 0xac } }, /* Bernoullis; */
+	{ 2071, 5, 4, { 0xf0, 0x9d, 0x92, 0xa6 } }, /* Kscr; */
+	{ 6252, 3, 3, { 0xe2, 0x89, 0x88 } }, /* ap; */
+	{ 10738, 4, 3, { 0xe2, 0xaa, 0x87 } }, /* lne; */
+	{ 15783, 6, 2, { 0xc5, 0xab } }, /* umacr; */
+	{ 16584, 4, 2, { 0xd0, 0xb7 } }, /* zcy; */
+	{ 7945, 5, 3, { 0xe2, 0x80, 0x90 } }, /* dash; */
+	{ 10572, 10, 3, { 0xe2, 0x8b, 0x9a } }, /* lesseqgtr; */
+	{ 14819, 9, 3, { 0xe2, 0x8a, 0x86 } }, /* subseteq; */
+	{ 5246, 6, 3, { 0xe2, 0x88, 0xbc } }, /* Tilde; */
+	{ 559, 5, 4, { 0xf0, 0x9d, 0x92, 0x9e } }, /* Cscr; */
+	{ 14784, 6, 3, { 0xe2, 0xab, 0x8b } }, /* subnE; */
+	{ 4045, 16, 3, { 0xe2, 0x8f, 0x9c } }, /* OverParenthesis; */
+	{ 0, 0, 0, { 0 } },
+	{ 13058, 7, 2, { 0xc2, 0xb1 } }, /* plusmn; */
+	{ 8909, 6, 2, { 0xc2, 0xbd } }, /* frac12 */
+	{ 631, 4, 3, { 0xe2, 0x88, 0x87 } }, /* Del; */
+	{ 6901, 5, 3, { 0xe2, 0x95, 0x91 } }, /* boxV; */
+	{ 16235, 6, 6, { 0xe2, 0x8a, 0x82, 0xe2, 0x83, 0x92 } }, /* vnsub; */
+	{ 11729, 5, 3, { 0xe2, 0x89, 0xaf } }, /* ngtr; */
+	{ 15867, 6, 2, { 0xcf, 0x92 } }, /* upsih; */
+	{ 12719, 6, 3, { 0xe2, 0x8a, 0x95 } }, /* oplus; */
+	{ 15589, 7, 2, { 0xc5, 0xa7 } }, /* tstrok; */
+	{ 10485, 4, 3, { 0xe2, 0x8b, 0x9a } }, /* leg; */
+	{ 2247, 15, 3, { 0xe2, 0x87, 0x83 } }, /* LeftDownVector; */
+	{ 4109, 5, 3, { 0xe2, 0x84, 0x99 } }, /* Popf; */
+	{ 11653, 7, 3, { 0xe2, 0xa4, 0xa8 } }, /* nesear; */
+	{ 0, 0, 0, { 0 } },
+	{ 1211, 13, 3, { 0xe2, 0x86, 0xa7 } }, /* DownTeeArrow; */
+	{ 13354, 6, 1, { 0x3f } }, /* quest; */
+	{ 9389, 5, 6, { 0xe2, 0x89, 0xa9, 0xef, 0xb8, 0x80 } }, /* gvnE; */
+	{ 3904, 6, 2, { 0xc5, 0x8c } }, /* Omacr; */
+	{ 12020, 5, 5, { 0xe2, 0xaa, 0xaf, 0xcc, 0xb8 } }, /* npre; */
+	{ 4085, 10, 2, { 0xc2, 0xb1 } }, /* PlusMinus; */
+	{ 9686, 6, 3, { 0xe2, 0x84, 0xa9 } }, /* iiota; */
+	{ 10507, 4, 3, { 0xe2, 0xa9, 0xbd } }, /* les; */
+	{ 13959, 6, 3, { 0xe2, 0xab, 0xae } }, /* rnmid; */
+	{ 6077, 7, 3, { 0xe2, 0xa9, 0x95 } }, /* andand; */
+	{ 0, 0, 0, { 0 } },
+	{ 14030, 6, 3, { 0xe2, 0x87, 0x89 } }, /* rrarr; */
+	{ 6152, 9, 3, { 0xe2, 0xa6, 0xab } }, /* angmsdad; */
+	{ 946, 17, 3, { 0xe2, 0x87, 0x92 } }, /* DoubleRightArrow; */
+	{ 14134, 3, 3, { 0xe2, 0x89, 0xbb } }, /* sc; */
+	{ 11516, 6, 3, { 0xe2, 0x99, 0xae } }, /* natur; */
+	{ 8055, 8, 3, { 0xe2, 0x8b, 0x84 } }, /* diamond; */
+	{ 15237, 4, 4, { 0xf0, 0x9d, 0x94, 0xb1 } }, /* tfr; */
+	{ 0, 0, 0, { 0 } },
+	{ 16397, 6, 3, { 0xe2, 0x9f, 0xb7 } }, /* xharr; */
+	{ 12510, 7, 3, { 0xe2, 0xa4, 0xa7 } }, /* nwnear; */
+	{ 10267, 7, 2, { 0xc4, 0xbc } }, /* lcedil; */
+	{ 11689, 4, 3, { 0xe2, 0x89, 0xb1 } }, /* nge; */
+	{ 6520, 8, 3, { 0xe2, 0x89, 0xac } }, /* between; */
+	{ 12412, 7, 3, { 0xe2, 0x8a, 0xac } }, /* nvdash; */
+	{ 0, 0, 0, { 0 } },
+	{ 6949, 6, 3, { 0xe2, 0x95, 0x95 } }, /* boxdL; */
+	{ 15159, 6, 3, { 0xe2, 0x86, 0x99 } }, /* swarr; */
+	{ 15578, 5, 2, { 0xd1, 0x86 } }, /* tscy; */
+	{ 627, 4, 2, { 0xd0, 0x94 } }, /* Dcy; */
+	{ 15221, 4, 2, { 0xd1, 0x82 } }, /* tcy; */
+	{ 4393, 14, 3, { 0xe2, 0x87, 0xa5 } }, /* RightArrowBar; */
+	{ 8562, 5, 3, { 0xe2, 0x80, 0x83 } }, /* emsp; */
+	{ 14936, 9, 3, { 0xe2, 0x8b, 0xa9 } }, /* succnsim; */
+	{ 2449, 16, 3, { 0xe2, 0xa5, 0x98 } }, /* LeftUpVectorBar; */
+	{ 15198, 4, 2, { 0xcf, 0x84 } }, /* tau; */
+	{ 13388, 7, 3, { 0xe2, 0xa4, 0x9c } }, /* rAtail; */
+	{ 12207, 10, 3, { 0xe2, 0x8a, 0x88 } }, /* nsubseteq; */
+	{ 8744, 4, 2, { 0xc3, 0xab } }, /* euml */
+	{ 1149, 19, 3, { 0xe2, 0xa5, 0x9f } }, /* DownRightTeeVector; */
+	{ 7921, 5, 3, { 0xe2, 0xa5, 0xa5 } }, /* dHar; */
+	{ 5329, 5, 3, { 0xe2, 0x86, 0x9f } }, /* Uarr; */
+	{ 460, 6, 3, { 0xe2, 0x88, 0xb7 } }, /* Colon; */
+	{ 8866, 6, 3, { 0xe2, 0x96, 0xb1 } }, /* fltns; */
+	{ 6014, 3, 3, { 0xe2, 0x81, 0xa1 } }, /* af; */
+	{ 5201, 4, 2, { 0xd0, 0xa2 } }, /* Tcy; */
+	{ 7190, 7, 3, { 0xe2, 0x89, 0x8f } }, /* bumpeq; */
+	{ 3992, 7, 2, { 0xc3, 0x95 } }, /* Otilde; */
+	{ 4070, 4, 2, { 0xd0, 0x9f } }, /* Pcy; */
+	{ 6883, 6, 3, { 0xe2, 0x95, 0x9a } }, /* boxUR; */
+	{ 2802, 10, 3, { 0xe2, 0x88, 0x93 } }, /* MinusPlus; */
+	{ 963, 15, 3, { 0xe2, 0x8a, 0xa8 } }, /* DoubleRightTee; */
+	{ 2436, 13, 3, { 0xe2, 0x86, 0xbf } }, /* LeftUpVector; */
+	{ 4301, 15, 3, { 0xe2, 0x88, 0x8b } }, /* ReverseElement; */
+	{ 15440, 13, 3, { 0xe2, 0x96, 0xbf } }, /* triangledown; */
+	{ 0, 0, 0, { 0 } },
+	{ 8407, 7, 3, { 0xe2, 0xa9, 0xae } }, /* easter; */
+	{ 6510, 5, 2, { 0xce, 0xb2 } }, /* beta; */
+	{ 2718, 15, 3, { 0xe2, 0x86, 0x99 } }, /* LowerLeftArrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 9254, 6, 1, { 0x60 } }, /* grave; */
+	{ 7926, 7, 3, { 0xe2, 0x80, 0xa0 } }, /* dagger; */
+	{ 13438, 6, 3, { 0xe2, 0xa6, 0x92 } }, /* rangd; */
+	{ 0, 0, 0, { 0 } },
+	{ 12564, 7, 2, { 0xc5, 0x91 } }, /* odblac; */
+	{ 2934, 21, 3, { 0xe2, 0x89, 0xab } }, /* NestedGreaterGreater; */
+	{ 1282, 6, 2, { 0xc3, 0x8a } }, /* Ecirc; */
+	{ 3910, 6, 2, { 0xce, 0xa9 } }, /* Omega; */
+	{ 14393, 6, 3, { 0xe2, 0x89, 0x83 } }, /* simeq; */
+	{ 15841, 15, 3, { 0xe2, 0x86, 0xbe } }, /* upharpoonright; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 12325, 16, 3, { 0xe2, 0x8b, 0xac } }, /* ntrianglelefteq; */
+	{ 12526, 7, 2, { 0xc3, 0xb3 } }, /* oacute; */
+	{ 14404, 6, 3, { 0xe2, 0xaa, 0xa0 } }, /* simgE; */
+	{ 13093, 5, 4, { 0xf0, 0x9d, 0x95, 0xa1 } }, /* popf; */
+	{ 3409, 18, 5, { 0xe2, 0xaa, 0xa1, 0xcc, 0xb8 } }, /* NotNestedLessLess; */
+	{ 15248, 10, 3, { 0xe2, 0x88, 0xb4 } }, /* therefore; */
+	{ 14128, 6, 3, { 0xe2, 0x80, 0x9a } }, /* sbquo; */
+	{ 1702, 5, 4, { 0xf0, 0x9d, 0x92, 0xa2 } }, /* Gscr; */
+	{ 4074, 4, 4, { 0xf0, 0x9d, 0x94, 0x93 } }, /* Pfr; */
+	{ 9364, 8, 3, { 0xe2, 0x89, 0xb7 } }, /* gtrless; */
+	{ 6312, 4, 1, { 0x2a } }, /* ast; */
+	{ 1989, 4, 2, { 0xc3, 0x8f } }, /* Iuml */
+	{ 2062, 4, 4, { 0xf0, 0x9d, 0x94, 0x8e } }, /* Kfr; */
+	{ 8915, 7, 2, { 0xc2, 0xbd } }, /* frac12; */
+	{ 10416, 16, 3, { 0xe2, 0x87, 0x86 } }, /* leftrightarrows; */
+	{ 6170, 9, 3, { 0xe2, 0xa6, 0xad } }, /* angmsdaf; */
+	{ 7417, 17, 3, { 0xe2, 0x86, 0xbb } }, /* circlearrowright; */
+	{ 4229, 4, 4, { 0xf0, 0x9d, 0x94, 0x94 } }, /* Qfr; */
+	{ 11836, 10, 5, { 0xe2, 0xa9, 0xbd, 0xcc, 0xb8 } }, /* nleqslant; */
+	{ 0, 0, 0, { 0 } },
+	{ 8942, 7, 3, { 0xe2, 0x85, 0x95 } }, /* frac15; */
+	{ 12419, 5, 6, { 0xe2, 0x89, 0xa5, 0xe2, 0x83, 0x92 } }, /* nvge; */
+	{ 15873, 8, 2, { 0xcf, 0x85 } }, /* upsilon; */
+	{ 8383, 6, 3, { 0xe2, 0xa9, 0xb7 } }, /* eDDot; */
+	{ 10524, 8, 3, { 0xe2, 0xaa, 0x81 } }, /* lesdoto; */
+	{ 1966, 5, 2, { 0xce, 0x99 } }, /* Iota; */
+	{ 12782, 8, 3, { 0xe2, 0xa9, 0x97 } }, /* orslope; */
+	{ 13444, 6, 3, { 0xe2, 0xa6, 0xa5 } }, /* range; */
+	{ 10401, 15, 3, { 0xe2, 0x86, 0x94 } }, /* leftrightarrow; */
+	{ 15748, 6, 3, { 0xe2, 0x96, 0x80 } }, /* uhblk; */
+	{ 5832, 5, 2, { 0xd0, 0x87 } }, /* YIcy; */
+	{ 14707, 6, 3, { 0xe2, 0x98, 0x85 } }, /* starf; */
+	{ 13668, 7, 3, { 0xe2, 0x80, 0x9d } }, /* rdquor; */
+	{ 10724, 5, 3, { 0xe2, 0xaa, 0x89 } }, /* lnap; */
+	{ 592, 5, 2, { 0xd0, 0x85 } }, /* DScy; */
+	{ 7360, 6, 3, { 0xe2, 0x9c, 0x93 } }, /* check; */
+	{ 0, 0, 0, { 0 } },
+	{ 1116, 15, 3, { 0xe2, 0x86, 0xbd } }, /* DownLeftVector; */
+	{ 4179, 8, 3, { 0xe2, 0x88, 0x8f } }, /* Product; */
+	{ 5936, 5, 3, { 0xe2, 0x84, 0xa4 } }, /* Zopf; */
+	{ 16412, 6, 3, { 0xe2, 0x9f, 0xb5 } }, /* xlarr; */
+	{ 14421, 6, 3, { 0xe2, 0x89, 0x86 } }, /* simne; */
+	{ 5349, 7, 2, { 0xc5, 0xac } }, /* Ubreve; */
+	{ 238, 4, 2, { 0xc2, 0xa9 } }, /* COPY */
+	{ 11114, 8, 3, { 0xe2, 0xa5, 0xa6 } }, /* luruhar; */
+	{ 24, 7, 2, { 0xc3, 0x81 } }, /* Aacute; */
+	{ 5309, 7, 2, { 0xc5, 0xa6 } }, /* Tstrok; */
+	{ 12437, 7, 3, { 0xe2, 0xa4, 0x82 } }, /* nvlArr; */
+	{ 242, 5, 2, { 0xc2, 0xa9 } }, /* COPY; */
+	{ 7674, 5, 3, { 0xe2, 0xab, 0x90 } }, /* csup; */
+	{ 10553, 11, 3, { 0xe2, 0xaa, 0x85 } }, /* lessapprox; */
+	{ 10183, 7, 3, { 0xe2, 0x86, 0xa2 } }, /* larrtl; */
+	{ 16381, 6, 3, { 0xe2, 0x96, 0xbd } }, /* xdtri; */
+	{ 9097, 5, 2, { 0xc4, 0xa1 } }, /* gdot; */
+	{ 6853, 6, 3, { 0xe2, 0x95, 0xa6 } }, /* boxHD; */
+	{ 13462, 6, 2, { 0xc2, 0xbb } }, /* raquo; */
+	{ 12874, 9, 3, { 0xe2, 0x88, 0xa5 } }, /* parallel; */
+	{ 14885, 11, 3, { 0xe2, 0xaa, 0xb8 } }, /* succapprox; */
+	{ 0, 0, 0, { 0 } },
+	{ 14048, 4, 3, { 0xe2, 0x86, 0xb1 } }, /* rsh; */
+	{ 5676, 4, 3, { 0xe2, 0x8b, 0x81 } }, /* Vee; */
+	{ 14322, 5, 2, { 0xd1, 0x88 } }, /* shcy; */
+	{ 0, 0, 0, { 0 } },
+	{ 8462, 4, 4, { 0xf0, 0x9d, 0x94, 0xa2 } }, /* efr; */
+	{ 6161, 9, 3, { 0xe2, 0xa6, 0xac } }, /* angmsdae; */
+	{ 5104, 9, 3, { 0xe2, 0x88, 0x8b } }, /* SuchThat; */
+	{ 8696, 9, 3, { 0xe2, 0xa7, 0xa5 } }, /* eqvparsl; */
+	{ 14350, 3, 2, { 0xc2, 0xad } }, /* shy */
+	{ 16632, 4, 3, { 0xe2, 0x80, 0x8d } }, /* zwj; */
+	{ 8400, 7, 2, { 0xc3, 0xa9 } }, /* eacute; */
+	{ 0, 0, 0, { 0 } },
+	{ 7544, 8, 3, { 0xe2, 0x89, 0x94 } }, /* coloneq; */
+	{ 10498, 9, 3, { 0xe2, 0xa9, 0xbd } }, /* leqslant; */
+	{ 14001, 8, 3, { 0xe2, 0xa8, 0xb5 } }, /* rotimes; */
+	{ 2851, 4, 2, { 0xd0, 0x9d } }, /* Ncy; */
+	{ 9844, 6, 3, { 0xe2, 0xa8, 0xbc } }, /* iprod; */
+	{ 6503, 7, 3, { 0xe2, 0x84, 0xac } }, /* bernou; */
+	{ 3858, 7, 2, { 0xc3, 0x93 } }, /* Oacute; */
+	{ 9562, 5, 4, { 0xf0, 0x9d, 0x92, 0xbd } }, /* hscr; */
+	{ 14479, 5, 3, { 0xe2, 0x88, 0xa3 } }, /* smid; */
+	{ 4630, 17, 3, { 0xe2, 0xa5, 0x9c } }, /* RightUpTeeVector; */
+	{ 8343, 6, 3, { 0xe2, 0x96, 0xbe } }, /* dtrif; */
+	{ 5777, 7, 3, { 0xe2, 0x8a, 0xaa } }, /* Vvdash; */
+	{ 0, 0, 0, { 0 } },
+	{ 9406, 5, 2, { 0xc2, 0xbd } }, /* half; */
+	{ 4786, 7, 2, { 0xc5, 0x9a } }, /* Sacute; */
+	{ 10024, 5, 4, { 0xf0, 0x9d, 0x93, 0x80 } }, /* kscr; */
+	{ 0, 0, 0, { 0 } },
+	{ 7634, 5, 2, { 0xc2, 0xa9 } }, /* copy; */
+	{ 13112, 4, 3, { 0xe2, 0xaa, 0xb3 } }, /* prE; */
+	{ 1903, 9, 3, { 0xe2, 0x88, 0xab } }, /* Integral; */
+	{ 0, 0, 0, { 0 } },
+	{ 13734, 4, 4, { 0xf0, 0x9d, 0x94, 0xaf } }, /* rfr; */
+	{ 5151, 5, 2, { 0xc3, 0x9e } }, /* THORN */
+	{ 6644, 9, 3, { 0xe2, 0x8b, 0x80 } }, /* bigwedge; */
+	{ 9087, 6, 2, { 0xc4, 0x9d } }, /* gcirc; */
+	{ 13507, 7, 3, { 0xe2, 0x86, 0xaa } }, /* rarrhk; */
+	{ 6021, 6, 2, { 0xc3, 0xa0 } }, /* agrave */
+	{ 506, 5, 3, { 0xe2, 0x84, 0x82 } }, /* Copf; */
+	{ 156, 10, 3, { 0xe2, 0x88, 0x96 } }, /* Backslash; */
+	{ 2515, 17, 3, { 0xe2, 0x8b, 0x9a } }, /* LessEqualGreater; */
+	{ 6581, 9, 3, { 0xe2, 0xa8, 0x86 } }, /* bigsqcup; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 2788, 10, 3, { 0xe2, 0x84, 0xb3 } }, /* Mellintrf; */
+	{ 5814, 3, 2, { 0xce, 0x9e } }, /* Xi; */
+	{ 3810, 15, 3, { 0xe2, 0x88, 0xa4 } }, /* NotVerticalBar; */
+	{ 5855, 6, 2, { 0xc5, 0xb6 } }, /* Ycirc; */
+	{ 11693, 5, 3, { 0xe2, 0x89, 0xb1 } }, /* ngeq; */
+	{ 16423, 5, 3, { 0xe2, 0x8b, 0xbb } }, /* xnis; */
+	{ 4364, 18, 3, { 0xe2, 0x9f, 0xa9 } }, /* RightAngleBracket; */
+	{ 307, 6, 2, { 0xc4, 0x88 } }, /* Ccirc; */
+	{ 3285, 21, 3, { 0xe2, 0x8b, 0xac } }, /* NotLeftTriangleEqual; */
+	{ 6259, 7, 3, { 0xe2, 0xa9, 0xaf } }, /* apacir; */
+	{ 0, 0, 0, { 0 } },
+	{ 6143, 9, 3, { 0xe2, 0xa6, 0xaa } }, /* angmsdac; */
+	{ 12234, 8, 5, { 0xe2, 0xaa, 0xb0, 0xcc, 0xb8 } }, /* nsucceq; */
+	{ 13675, 5, 3, { 0xe2, 0x86, 0xb3 } }, /* rdsh; */
+	{ 3237, 13, 5, { 0xe2, 0x89, 0x8f, 0xcc, 0xb8 } }, /* NotHumpEqual; */
+	{ 13279, 6, 3, { 0xe2, 0x89, 0xbe } }, /* prsim; */
+	{ 16189, 4, 3, { 0xe2, 0x88, 0xa8 } }, /* vee; */
+	{ 6361, 6, 3, { 0xe2, 0xa8, 0x91 } }, /* awint; */
+	{ 10106, 7, 3, { 0xe2, 0x9f, 0xa8 } }, /* langle; */
+	{ 10040, 7, 3, { 0xe2, 0xa4, 0x9b } }, /* lAtail; */
+	{ 12708, 5, 3, { 0xe2, 0xa6, 0xb7 } }, /* opar; */
+	{ 0, 0, 0, { 0 } },
+	{ 7463, 12, 3, { 0xe2, 0x8a, 0x9a } }, /* circledcirc; */
+	{ 5952, 7, 2, { 0xc3, 0xa1 } }, /* aacute; */
+	{ 15425, 6, 3, { 0xe2, 0x84, 0xa2 } }, /* trade; */
+	{ 2855, 20, 3, { 0xe2, 0x80, 0x8b } }, /* NegativeMediumSpace; */
+	{ 7768, 6, 3, { 0xe2, 0xa9, 0x85 } }, /* cupor; */
+	{ 1834, 5, 2, { 0xc3, 0x8e } }, /* Icirc */
+	{ 3533, 22, 3, { 0xe2, 0x8b, 0xad } }, /* NotRightTriangleEqual; */
+	{ 5680, 7, 3, { 0xe2, 0x80, 0x96 } }, /* Verbar; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 14812, 7, 3, { 0xe2, 0x8a, 0x82 } }, /* subset; */
+	{ 1845, 4, 2, { 0xd0, 0x98 } }, /* Icy; */
+	{ 0, 0, 0, { 0 } },
+	{ 2139, 17, 3, { 0xe2, 0x9f, 0xa8 } }, /* LeftAngleBracket; */
+	{ 2679, 19, 3, { 0xe2, 0x9f, 0xba } }, /* Longleftrightarrow; */
+	{ 10999, 6, 3, { 0xe2, 0xaa, 0x8f } }, /* lsimg; */
+	{ 0, 0, 0, { 0 } },
+	{ 9666, 7, 3, { 0xe2, 0xa8, 0x8c } }, /* iiiint; */
+	{ 9611, 5, 2, { 0xc3, 0xae } }, /* icirc */
+	{ 0, 0, 0, { 0 } },
+	{ 7256, 6, 2, { 0xcb, 0x87 } }, /* caron; */
+	{ 2837, 7, 2, { 0xc5, 0x87 } }, /* Ncaron; */
+	{ 1810, 6, 2, { 0xc4, 0xb2 } }, /* IJlig; */
+	{ 16570, 7, 2, { 0xc5, 0xba } }, /* zacute; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 6307, 5, 4, { 0xf0, 0x9d, 0x92, 0xb6 } }, /* ascr; */
+	{ 5927, 5, 2, { 0xce, 0x96 } }, /* Zeta; */
+	{ 5790, 6, 3, { 0xe2, 0x8b, 0x80 } }, /* Wedge; */
+	{ 0, 0, 0, { 0 } },
+	{ 11789, 5, 3, { 0xe2, 0x80, 0xa5 } }, /* nldr; */
+	{ 8448, 5, 2, { 0xc4, 0x97 } }, /* edot; */
+	{ 9479, 7, 3, { 0xe2, 0x8a, 0xb9 } }, /* hercon; */
+	{ 2076, 5, 2, { 0xd0, 0x89 } }, /* LJcy; */
+	{ 6296, 5, 2, { 0xc3, 0xa5 } }, /* aring */
+	{ 7275, 6, 2, { 0xc3, 0xa7 } }, /* ccedil */
+	{ 13543, 6, 3, { 0xe2, 0x86, 0x9d } }, /* rarrw; */
+	{ 8394, 6, 2, { 0xc3, 0xa9 } }, /* eacute */
+	{ 7161, 5, 3, { 0xe2, 0x80, 0xa2 } }, /* bull; */
+	{ 5837, 5, 2, { 0xd0, 0xae } }, /* YUcy; */
+	{ 8081, 4, 2, { 0xc2, 0xa8 } }, /* die; */
+	{ 16627, 5, 4, { 0xf0, 0x9d, 0x93, 0x8f } }, /* zscr; */
+	{ 16588, 5, 2, { 0xc5, 0xbc } }, /* zdot; */
+	{ 5473, 5, 4, { 0xf0, 0x9d, 0x95, 0x8c } }, /* Uopf; */
+	{ 13109, 3, 3, { 0xe2, 0x89, 0xba } }, /* pr; */
+	{ 10593, 8, 3, { 0xe2, 0x89, 0xb6 } }, /* lessgtr; */
+	{ 0, 0, 0, { 0 } },
+	{ 12356, 17, 3, { 0xe2, 0x8b, 0xad } }, /* ntrianglerighteq; */
+	{ 10175, 8, 3, { 0xe2, 0xa5, 0xb3 } }, /* larrsim; */
+	{ 8374, 9, 3, { 0xe2, 0x9f, 0xbf } }, /* dzigrarr; */
+	{ 5687, 5, 3, { 0xe2, 0x80, 0x96 } }, /* Vert; */
+	{ 11783, 6, 3, { 0xe2, 0x86, 0x9a } }, /* nlarr; */
+	{ 9063, 6, 2, { 0xce, 0xb3 } }, /* gamma; */
+	{ 1961, 5, 4, { 0xf0, 0x9d, 0x95, 0x80 } }, /* Iopf; */
+	{ 10993, 6, 3, { 0xe2, 0xaa, 0x8d } }, /* lsime; */
+	{ 13809, 15, 3, { 0xe2, 0x87, 0x80 } }, /* rightharpoonup; */
+	{ 13308, 4, 4, { 0xf0, 0x9d, 0x94, 0xae } }, /* qfr; */
+	{ 13024, 8, 3, { 0xe2, 0xa8, 0xa2 } }, /* pluscir; */
+	{ 11352, 5, 4, { 0xf0, 0x9d, 0x95, 0x9e } }, /* mopf; */
+	{ 3221, 16, 5, { 0xe2, 0x89, 0x8e, 0xcc, 0xb8 } }, /* NotHumpDownHump; */
+	{ 5205, 4, 4, { 0xf0, 0x9d, 0x94, 0x97 } }, /* Tfr; */
+	{ 7726, 8, 3, { 0xe2, 0xa4, 0xbd } }, /* cularrp; */
+	{ 16490, 5, 3, { 0xe2, 0x8b, 0x81 } }, /* xvee; */
+	{ 11646, 7, 3, { 0xe2, 0x89, 0xa2 } }, /* nequiv; */
+	{ 11734, 6, 3, { 0xe2, 0x87, 0x8e } }, /* nhArr; */
+	{ 5388, 7, 2, { 0xc3, 0x99 } }, /* Ugrave; */
+	{ 14866, 7, 3, { 0xe2, 0xab, 0x95 } }, /* subsub; */
+	{ 422, 22, 3, { 0xe2, 0x80, 0x9d } }, /* CloseCurlyDoubleQuote; */
+	{ 11491, 5, 5, { 0xe2, 0xa9, 0xb0, 0xcc, 0xb8 } }, /* napE; */
+	{ 6796, 5, 3, { 0xe2, 0x8c, 0x90 } }, /* bnot; */
+	{ 287, 7, 2, { 0xc4, 0x8c } }, /* Ccaron; */
+	{ 5907, 5, 2, { 0xc5, 0xbb } }, /* Zdot; */
+	{ 10100, 6, 3, { 0xe2, 0xa6, 0x91 } }, /* langd; */
+	{ 3916, 8, 2, { 0xce, 0x9f } }, /* Omicron; */
+	{ 13716, 4, 2, { 0xc2, 0xae } }, /* reg; */
+	{ 5478, 8, 3, { 0xe2, 0x86, 0x91 } }, /* UpArrow; */
+	{ 10053, 3, 3, { 0xe2, 0x89, 0xa6 } }, /* lE; */
+	{ 6673, 12, 3, { 0xe2, 0x96, 0xaa } }, /* blacksquare; */
+	{ 12883, 7, 3, { 0xe2, 0xab, 0xb3 } }, /* parsim; */
+	{ 7747, 7, 3, { 0xe2, 0xa9, 0x86 } }, /* cupcap; */
+	{ 0, 0, 0, { 0 } },
+	{ 14768, 8, 3, { 0xe2, 0xab, 0x83 } }, /* subedot; */
+	{ 15528, 5, 3, { 0xe2, 0x89, 0x9c } }, /* trie; */
+	{ 6411, 10, 3, { 0xe2, 0x8b, 0x8d } }, /* backsimeq; */
+	{ 0, 0, 0, { 0 } },
+	{ 8929, 6, 2, { 0xc2, 0xbc } }, /* frac14 */
+	{ 6539, 8, 3, { 0xe2, 0x97, 0xaf } }, /* bigcirc; */
+	{ 9270, 6, 3, { 0xe2, 0xaa, 0x8e } }, /* gsime; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 11192, 11, 3, { 0xe2, 0x86, 0xa4 } }, /* mapstoleft; */
+	{ 1424, 4, 2, { 0xce, 0x97 } }, /* Eta; */
+	{ 13235, 5, 3, { 0xe2, 0x88, 0x8f } }, /* prod; */
+	{ 7658, 5, 4, { 0xf0, 0x9d, 0x92, 0xb8 } }, /* cscr; */
+	{ 1727, 6, 2, { 0xc4, 0xa4 } }, /* Hcirc; */
+	{ 6497, 6, 2, { 0xcf, 0xb6 } }, /* bepsi; */
+	{ 6614, 14, 3, { 0xe2, 0x96, 0xb3 } }, /* bigtriangleup; */
+	{ 7909, 7, 3, { 0xe2, 0x8c, 0xad } }, /* cylcty; */
+	{ 0, 0, 0, { 0 } },
+	{ 12609, 6, 2, { 0xc3, 0xb2 } }, /* ograve */
+	{ 3852, 6, 2, { 0xc3, 0x93 } }, /* Oacute */
+	{ 14302, 7, 3, { 0xe2, 0x8c, 0xa2 } }, /* sfrown; */
+	{ 11714, 5, 5, { 0xe2, 0xa9, 0xbe, 0xcc, 0xb8 } }, /* nges; */
+	{ 11170, 4, 3, { 0xe2, 0x86, 0xa6 } }, /* map; */
+	{ 11143, 4, 2, { 0xc2, 0xaf } }, /* macr */
+	{ 11462, 7, 3, { 0xe2, 0x8a, 0xae } }, /* nVdash; */
+	{ 7245, 5, 6, { 0xe2, 0x88, 0xa9, 0xef, 0xb8, 0x80 } }, /* caps; */
+	{ 7308, 5, 2, { 0xc4, 0x8b } }, /* cdot; */
+	{ 7224, 7, 3, { 0xe2, 0xa9, 0x8b } }, /* capcap; */
+	{ 13312, 5, 3, { 0xe2, 0xa8, 0x8c } }, /* qint; */
+	{ 2822, 3, 2, { 0xce, 0x9c } }, /* Mu; */
+	{ 334, 10, 2, { 0xc2, 0xb7 } }, /* CenterDot; */
+	{ 12989, 8, 3, { 0xe2, 0x84, 0x8e } }, /* planckh; */
+	{ 13401, 5, 3, { 0xe2, 0xa5, 0xa4 } }, /* rHar; */
+	{ 8532, 9, 3, { 0xe2, 0x88, 0x85 } }, /* emptyset; */
+	{ 226, 7, 3, { 0xe2, 0x89, 0x8e } }, /* Bumpeq; */
+	{ 645, 17, 2, { 0xc2, 0xb4 } }, /* DiacriticalAcute; */
+	{ 12653, 8, 3, { 0xe2, 0xa6, 0xbb } }, /* olcross; */
+	{ 10934, 6, 3, { 0xe2, 0x87, 0x86 } }, /* lrarr; */
+	{ 12794, 5, 3, { 0xe2, 0x84, 0xb4 } }, /* oscr; */
+	{ 5796, 4, 4, { 0xf0, 0x9d, 0x94, 0x9a } }, /* Wfr; */
+	{ 6865, 6, 3, { 0xe2, 0x95, 0xa4 } }, /* boxHd; */
+	{ 12725, 3, 3, { 0xe2, 0x88, 0xa8 } }, /* or; */
+	{ 8618, 6, 2, { 0xcf, 0xb5 } }, /* epsiv; */
+	{ 11088, 5, 3, { 0xe2, 0x97, 0x83 } }, /* ltri; */
+	{ 2199, 12, 3, { 0xe2, 0x8c, 0x88 } }, /* LeftCeiling; */
+	{ 1028, 10, 3, { 0xe2, 0x86, 0x93 } }, /* DownArrow; */
+	{ 6393, 10, 3, { 0xe2, 0x80, 0xb5 } }, /* backprime; */
+	{ 5183, 4, 2, { 0xce, 0xa4 } }, /* Tau; */
+	{ 3427, 12, 3, { 0xe2, 0x8a, 0x80 } }, /* NotPrecedes; */
+	{ 10047, 6, 3, { 0xe2, 0xa4, 0x8e } }, /* lBarr; */
+	{ 15856, 6, 3, { 0xe2, 0x8a, 0x8e } }, /* uplus; */
+	{ 13136, 11, 3, { 0xe2, 0xaa, 0xb7 } }, /* precapprox; */
+	{ 1707, 3, 3, { 0xe2, 0x89, 0xab } }, /* Gt; */
+	{ 9834, 5, 4, { 0xf0, 0x9d, 0x95, 0x9a } }, /* iopf; */
+	{ 9105, 4, 3, { 0xe2, 0x8b, 0x9b } }, /* gel; */
+	{ 16577, 7, 2, { 0xc5, 0xbe } }, /* zcaron; */
+	{ 8075, 6, 3, { 0xe2, 0x99, 0xa6 } }, /* diams; */
+	{ 2012, 5, 4, { 0xf0, 0x9d, 0x95, 0x81 } }, /* Jopf; */
+	{ 9839, 5, 2, { 0xce, 0xb9 } }, /* iota; */
+	{ 14966, 5, 2, { 0xc2, 0xb9 } }, /* sup1; */
+	{ 11212, 7, 3, { 0xe2, 0x96, 0xae } }, /* marker; */
+	{ 9219, 9, 3, { 0xe2, 0xaa, 0x8a } }, /* gnapprox; */
+	{ 1755, 15, 3, { 0xe2, 0x94, 0x80 } }, /* HorizontalLine; */
+	{ 10616, 7, 3, { 0xe2, 0x8c, 0x8a } }, /* lfloor; */
+	{ 10695, 7, 2, { 0xc5, 0x80 } }, /* lmidot; */
+	{ 13971, 6, 3, { 0xe2, 0x87, 0xbe } }, /* roarr; */
+	{ 6247, 5, 4, { 0xf0, 0x9d, 0x95, 0x92 } }, /* aopf; */
+	{ 12861, 4, 3, { 0xe2, 0x88, 0xa5 } }, /* par; */
+	{ 717, 17, 2, { 0xcb, 0x9c } }, /* DiacriticalTilde; */
+	{ 0, 0, 0, { 0 } },
+	{ 7738, 9, 3, { 0xe2, 0xa9, 0x88 } }, /* cupbrcap; */
+	{ 6322, 8, 3, { 0xe2, 0x89, 0x8d } }, /* asympeq; */
+	{ 0, 0, 0, { 0 } },
+	{ 11219, 7, 3, { 0xe2, 0xa8, 0xa9 } }, /* mcomma; */
+	{ 3670, 17, 5, { 0xe2, 0xaa, 0xb0, 0xcc, 0xb8 } }, /* NotSucceedsEqual; */
+	{ 13127, 4, 3, { 0xe2, 0xaa, 0xaf } }, /* pre; */
+	{ 9926, 5, 2, { 0xc3, 0xaf } }, /* iuml; */
+	{ 7401, 16, 3, { 0xe2, 0x86, 0xba } }, /* circlearrowleft; */
+	{ 11375, 9, 3, { 0xe2, 0x8a, 0xb8 } }, /* multimap; */
+	{ 8639, 6, 3, { 0xe2, 0x89, 0x82 } }, /* eqsim; */
+	{ 3986, 6, 2, { 0xc3, 0x95 } }, /* Otilde */
+	{ 12777, 5, 3, { 0xe2, 0xa9, 0x96 } }, /* oror; */
+	{ 10329, 3, 3, { 0xe2, 0x89, 0xa4 } }, /* le; */
+	{ 12912, 7, 1, { 0x2e } }, /* period; */
+	{ 15950, 6, 3, { 0xe2, 0x96, 0xb4 } }, /* utrif; */
+	{ 11566, 7, 2, { 0xc5, 0x88 } }, /* ncaron; */
+	{ 5946, 6, 2, { 0xc3, 0xa1 } }, /* aacute */
+	{ 15114, 11, 3, { 0xe2, 0xab, 0x8c } }, /* supsetneqq; */
+	{ 14315, 7, 2, { 0xd1, 0x89 } }, /* shchcy; */
+	{ 742, 14, 3, { 0xe2, 0x85, 0x86 } }, /* DifferentialD; */
+	{ 7630, 4, 2, { 0xc2, 0xa9 } }, /* copy */
+	{ 3151, 18, 5, { 0xe2, 0x89, 0xab, 0xcc, 0xb8 } }, /* NotGreaterGreater; */
+	{ 16276, 7, 6, { 0xe2, 0x8a, 0x8a, 0xef, 0xb8, 0x80 } }, /* vsubne; */
+	{ 147, 4, 2, { 0xc3, 0x84 } }, /* Auml */
+	{ 14218, 6, 3, { 0xe2, 0x8a, 0xa1 } }, /* sdotb; */
+	{ 8456, 6, 3, { 0xe2, 0x89, 0x92 } }, /* efDot; */
+	{ 7052, 5, 3, { 0xe2, 0x94, 0x82 } }, /* boxv; */
+	{ 0, 0, 0, { 0 } },
+	{ 14603, 11, 3, { 0xe2, 0x8a, 0x91 } }, /* sqsubseteq; */
+	{ 16252, 6, 3, { 0xe2, 0x88, 0x9d } }, /* vprop; */
+	{ 2596, 3, 3, { 0xe2, 0x8b, 0x98 } }, /* Ll; */
+	{ 16324, 7, 3, { 0xe2, 0x89, 0x99 } }, /* wedgeq; */
+	{ 5613, 8, 2, { 0xce, 0xa5 } }, /* Upsilon; */
+	{ 14121, 7, 2, { 0xc5, 0x9b } }, /* sacute; */
+	{ 8204, 10, 3, { 0xe2, 0x8a, 0xa1 } }, /* dotsquare; */
+	{ 8956, 7, 3, { 0xe2, 0x85, 0x9b } }, /* frac18; */
+	{ 4576, 17, 3, { 0xe2, 0xa7, 0x90 } }, /* RightTriangleBar; */
+	{ 3738, 17, 3, { 0xe2, 0x8a, 0x89 } }, /* NotSupersetEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 13395, 6, 3, { 0xe2, 0xa4, 0x8f } }, /* rBarr; */
+	{ 1538, 2, 1, { 0x3e } }, /* GT */
+	{ 2128, 7, 2, { 0xc4, 0xbb } }, /* Lcedil; */
+	{ 765, 7, 3, { 0xe2, 0x83, 0x9c } }, /* DotDot; */
+	{ 11398, 5, 5, { 0xe2, 0x89, 0xab, 0xcc, 0xb8 } }, /* nGtv; */
+	{ 4547, 15, 3, { 0xe2, 0xa5, 0x9b } }, /* RightTeeVector; */
+	{ 178, 4, 2, { 0xd0, 0x91 } }, /* Bcy; */
+	{ 6824, 6, 3, { 0xe2, 0x95, 0x97 } }, /* boxDL; */
+	{ 15542, 8, 3, { 0xe2, 0xa8, 0xb9 } }, /* triplus; */
+	{ 4294, 4, 2, { 0xd0, 0xa0 } }, /* Rcy; */
+	{ 5395, 6, 2, { 0xc5, 0xaa } }, /* Umacr; */
+	{ 14993, 5, 3, { 0xe2, 0xab, 0x86 } }, /* supE; */
+	{ 15984, 5, 3, { 0xe2, 0xab, 0xa8 } }, /* vBar; */
+	{ 9650, 6, 2, { 0xc3, 0xac } }, /* igrave */
+	{ 0, 0, 0, { 0 } },
+	{ 14647, 4, 3, { 0xe2, 0x96, 0xa1 } }, /* squ; */
+	{ 0, 0, 0, { 0 } },
+	{ 5772, 5, 4, { 0xf0, 0x9d, 0x92, 0xb1 } }, /* Vscr; */
+	{ 8748, 5, 2, { 0xc3, 0xab } }, /* euml; */
+	{ 0, 0, 0, { 0 } },
+	{ 15343, 6, 2, { 0xc3, 0x97 } }, /* times; */
+	{ 12919, 7, 3, { 0xe2, 0x80, 0xb0 } }, /* permil; */
+	{ 11725, 4, 3, { 0xe2, 0x89, 0xaf } }, /* ngt; */
+	{ 10922, 5, 1, { 0x28 } }, /* lpar; */
+	{ 1444, 13, 3, { 0xe2, 0x85, 0x87 } }, /* ExponentialE; */
+	{ 7888, 6, 3, { 0xe2, 0x8b, 0x8f } }, /* cuwed; */
+	{ 9076, 4, 3, { 0xe2, 0xaa, 0x86 } }, /* gap; */
+	{ 279, 8, 3, { 0xe2, 0x84, 0xad } }, /* Cayleys; */
+	{ 13578, 6, 3, { 0xe2, 0x9d, 0xb3 } }, /* rbbrk; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 13750, 7, 3, { 0xe2, 0xa5, 0xac } }, /* rharul; */
+	{ 12965, 3, 2, { 0xcf, 0x80 } }, /* pi; */
+	{ 7002, 9, 3, { 0xe2, 0x8a, 0x9f } }, /* boxminus; */
+	{ 0, 0, 0, { 0 } },
+	{ 641, 4, 4, { 0xf0, 0x9d, 0x94, 0x87 } }, /* Dfr; */
+	{ 8009, 4, 2, { 0xc2, 0xb0 } }, /* deg; */
+	{ 0, 0, 0, { 0 } },
+	{ 7294, 6, 3, { 0xe2, 0xa9, 0x8c } }, /* ccups; */
+	{ 6464, 4, 2, { 0xd0, 0xb1 } }, /* bcy; */
+	{ 16418, 5, 3, { 0xe2, 0x9f, 0xbc } }, /* xmap; */
+	{ 8426, 5, 2, { 0xc3, 0xaa } }, /* ecirc */
+	{ 0, 0, 0, { 0 } },
+	{ 3643, 15, 3, { 0xe2, 0x8a, 0x88 } }, /* NotSubsetEqual; */
+	{ 8922, 7, 3, { 0xe2, 0x85, 0x93 } }, /* frac13; */
+	{ 5497, 17, 3, { 0xe2, 0x87, 0x85 } }, /* UpArrowDownArrow; */
+	{ 127, 7, 3, { 0xe2, 0x89, 0x94 } }, /* Assign; */
+	{ 0, 0, 0, { 0 } },
+	{ 13536, 7, 3, { 0xe2, 0x86, 0xa3 } }, /* rarrtl; */
+	{ 6653, 7, 3, { 0xe2, 0xa4, 0x8d } }, /* bkarow; */
+	{ 0, 0, 0, { 0 } },
+	{ 4678, 12, 3, { 0xe2, 0x87, 0x80 } }, /* RightVector; */
+	{ 8156, 7, 1, { 0x24 } }, /* dollar; */
+	{ 880, 20, 3, { 0xe2, 0x9f, 0xb8 } }, /* DoubleLongLeftArrow; */
+	{ 15413, 5, 3, { 0xe2, 0xa4, 0xa9 } }, /* tosa; */
+	{ 7679, 6, 3, { 0xe2, 0xab, 0x92 } }, /* csupe; */
+	{ 14695, 7, 3, { 0xe2, 0x8b, 0x86 } }, /* sstarf; */
+	{ 11333, 5, 3, { 0xe2, 0x80, 0xa6 } }, /* mldr; */
+	{ 10640, 6, 3, { 0xe2, 0x86, 0xbc } }, /* lharu; */
+	{ 15979, 5, 3, { 0xe2, 0x87, 0x95 } }, /* vArr; */
+	{ 5884, 5, 2, { 0xd0, 0x96 } }, /* ZHcy; */
+	{ 11035, 5, 3, { 0xe2, 0xaa, 0xa6 } }, /* ltcc; */
+	{ 9080, 7, 2, { 0xc4, 0x9f } }, /* gbreve; */
+	{ 13272, 7, 3, { 0xe2, 0x88, 0x9d } }, /* propto; */
+	{ 11250, 4, 4, { 0xf0, 0x9d, 0x94, 0xaa } }, /* mfr; */
+	{ 16019, 9, 2, { 0xcf, 0xb0 } }, /* varkappa; */
+	{ 10244, 8, 3, { 0xe2, 0xa6, 0x8f } }, /* lbrksld; */
+	{ 4010, 5, 2, { 0xc3, 0x96 } }, /* Ouml; */
+	{ 13131, 5, 3, { 0xe2, 0x89, 0xba } }, /* prec; */
+	{ 4593, 19, 3, { 0xe2, 0x8a, 0xb5 } }, /* RightTriangleEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 1098, 18, 3, { 0xe2, 0xa5, 0x9e } }, /* DownLeftTeeVector; */
+	{ 0, 0, 0, { 0 } },
+	{ 12558, 6, 3, { 0xe2, 0x8a, 0x9d } }, /* odash; */
+	{ 15377, 5, 3, { 0xe2, 0xa4, 0xa8 } }, /* toea; */
+	{ 12065, 12, 3, { 0xe2, 0x86, 0x9b } }, /* nrightarrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 3880, 7, 2, { 0xc5, 0x90 } }, /* Odblac; */
+	{ 15125, 7, 3, { 0xe2, 0xab, 0x88 } }, /* supsim; */
+	{ 0, 0, 0, { 0 } },
+	{ 9336, 7, 3, { 0xe2, 0x8b, 0x97 } }, /* gtrdot; */
+	{ 9056, 7, 2, { 0xc7, 0xb5 } }, /* gacute; */
+	{ 16162, 17, 3, { 0xe2, 0x8a, 0xb3 } }, /* vartriangleright; */
+	{ 12978, 4, 2, { 0xcf, 0x96 } }, /* piv; */
+	{ 8970, 7, 3, { 0xe2, 0x85, 0x96 } }, /* frac25; */
+	{ 0, 0, 0, { 0 } },
+	{ 3891, 6, 2, { 0xc3, 0x92 } }, /* Ograve */
+	{ 12943, 4, 2, { 0xcf, 0x86 } }, /* phi; */
+	{ 10777, 14, 3, { 0xe2, 0x9f, 0xb5 } }, /* longleftarrow; */
+	{ 3687, 22, 3, { 0xe2, 0x8b, 0xa1 } }, /* NotSucceedsSlantEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 7950, 6, 3, { 0xe2, 0x8a, 0xa3 } }, /* dashv; */
+	{ 8475, 7, 2, { 0xc3, 0xa8 } }, /* egrave; */
+	{ 2631, 19, 3, { 0xe2, 0x9f, 0xb7 } }, /* LongLeftRightArrow; */
+	{ 11903, 7, 5, { 0xe2, 0x8b, 0xb9, 0xcc, 0xb8 } }, /* notinE; */
+	{ 0, 0, 0, { 0 } },
+	{ 14676, 5, 4, { 0xf0, 0x9d, 0x93, 0x88 } }, /* sscr; */
+	{ 7106, 6, 2, { 0xc2, 0xa6 } }, /* brvbar */
+	{ 1246, 4, 2, { 0xc5, 0x8a } }, /* ENG; */
+	{ 134, 6, 2, { 0xc3, 0x83 } }, /* Atilde */
+	{ 7956, 8, 3, { 0xe2, 0xa4, 0x8f } }, /* dbkarow; */
+	{ 1419, 5, 3, { 0xe2, 0xa9, 0xb3 } }, /* Esim; */
+	{ 7332, 4, 2, { 0xc2, 0xa2 } }, /* cent */
+	{ 9144, 8, 3, { 0xe2, 0xaa, 0x82 } }, /* gesdoto; */
+	{ 0, 0, 0, { 0 } },
+	{ 14021, 9, 3, { 0xe2, 0xa8, 0x92 } }, /* rppolint; */
+	{ 12926, 5, 3, { 0xe2, 0x8a, 0xa5 } }, /* perp; */
+	{ 7818, 9, 3, { 0xe2, 0x8b, 0x8e } }, /* curlyvee; */
+	{ 14170, 6, 2, { 0xc5, 0x9d } }, /* scirc; */
+	{ 6967, 6, 3, { 0xe2, 0x94, 0x8c } }, /* boxdr; */
+	{ 11438, 5, 5, { 0xe2, 0x89, 0xaa, 0xcc, 0xb8 } }, /* nLtv; */
+	{ 8839, 4, 4, { 0xf0, 0x9d, 0x94, 0xa3 } }, /* ffr; */
+	{ 12588, 6, 2, { 0xc5, 0x93 } }, /* oelig; */
+	{ 0, 0, 0, { 0 } },
+	{ 9868, 5, 3, { 0xe2, 0x88, 0x88 } }, /* isin; */
+	{ 12548, 6, 2, { 0xc3, 0xb4 } }, /* ocirc; */
+	{ 14137, 4, 3, { 0xe2, 0xaa, 0xb4 } }, /* scE; */
+	{ 11502, 6, 2, { 0xc5, 0x89 } }, /* napos; */
+	{ 76, 6, 2, { 0xc4, 0x80 } }, /* Amacr; */
+	{ 10065, 7, 2, { 0xc4, 0xba } }, /* lacute; */
+	{ 8548, 7, 3, { 0xe2, 0x80, 0x84 } }, /* emsp13; */
+	{ 12424, 5, 4, { 0x3e, 0xe2, 0x83, 0x92 } }, /* nvgt; */
+	{ 5632, 7, 2, { 0xc5, 0xa8 } }, /* Utilde; */
+	{ 6103, 4, 3, { 0xe2, 0x88, 0xa0 } }, /* ang; */
+	{ 11867, 6, 3, { 0xe2, 0x8b, 0xaa } }, /* nltri; */
+	{ 10689, 6, 3, { 0xe2, 0x97, 0xba } }, /* lltri; */
+	{ 14388, 5, 3, { 0xe2, 0x89, 0x83 } }, /* sime; */
+	{ 3979, 7, 2, { 0xc3, 0x98 } }, /* Oslash; */
+	{ 12543, 5, 2, { 0xc3, 0xb4 } }, /* ocirc */
+	{ 0, 0, 0, { 0 } },
+	{ 13046, 6, 3, { 0xe2, 0xa9, 0xb2 } }, /* pluse; */
+	{ 6066, 3, 1, { 0x26 } }, /* amp */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 2476, 14, 3, { 0xe2, 0xa5, 0x92 } }, /* LeftVectorBar; */
+	{ 14370, 7, 2, { 0xcf, 0x82 } }, /* sigmav; */
+	{ 15736, 6, 3, { 0xe2, 0x86, 0xbf } }, /* uharl; */
+	{ 5289, 5, 4, { 0xf0, 0x9d, 0x95, 0x8b } }, /* Topf; */
+	{ 9237, 6, 3, { 0xe2, 0x89, 0xa9 } }, /* gneqq; */
+	{ 14298, 4, 4, { 0xf0, 0x9d, 0x94, 0xb0 } }, /* sfr; */
+	{ 8513, 7, 3, { 0xe2, 0xaa, 0x97 } }, /* elsdot; */
+	{ 15241, 7, 3, { 0xe2, 0x88, 0xb4 } }, /* there4; */
+	{ 0, 0, 0, { 0 } },
+	{ 6830, 6, 3, { 0xe2, 0x95, 0x94 } }, /* boxDR; */
+	{ 10238, 6, 3, { 0xe2, 0xa6, 0x8b } }, /* lbrke; */
+	{ 0, 0, 0, { 0 } },
+	{ 11666, 7, 3, { 0xe2, 0x88, 0x84 } }, /* nexist; */
+	{ 2058, 4, 2, { 0xd0, 0x9a } }, /* Kcy; */
+	{ 1940, 15, 3, { 0xe2, 0x81, 0xa2 } }, /* InvisibleTimes; */
+	{ 4287, 7, 2, { 0xc5, 0x96 } }, /* Rcedil; */
+	{ 0, 0, 0, { 0 } },
+	{ 2982, 8, 3, { 0xe2, 0x81, 0xa0 } }, /* NoBreak; */
+	{ 10072, 9, 3, { 0xe2, 0xa6, 0xb4 } }, /* laemptyv; */
+	{ 9656, 7, 2, { 0xc3, 0xac } }, /* igrave; */
+	{ 0, 0, 0, { 0 } },
+	{ 16477, 7, 3, { 0xe2, 0xa8, 0x84 } }, /* xuplus; */
+	{ 12469, 8, 6, { 0xe2, 0x8a, 0xb5, 0xe2, 0x83, 0x92 } }, /* nvrtrie; */
+	{ 0, 0, 0, { 0 } },
+	{ 5648, 6, 3, { 0xe2, 0x8a, 0xab } }, /* VDash; */
+	{ 3950, 15, 3, { 0xe2, 0x80, 0x98 } }, /* OpenCurlyQuote; */
+	{ 1795, 10, 3, { 0xe2, 0x89, 0x8f } }, /* HumpEqual; */
+	{ 900, 25, 3, { 0xe2, 0x9f, 0xba } }, /* DoubleLongLeftRightArrow; */
+	{ 4796, 7, 2, { 0xc5, 0xa0 } }, /* Scaron; */
+	{ 5, 6, 2, { 0xc3, 0x86 } }, /* AElig; */
+	{ 0, 0, 0, { 0 } },
+	{ 3592, 18, 5, { 0xe2, 0x8a, 0x90, 0xcc, 0xb8 } }, /* NotSquareSuperset; */
+	{ 0, 0, 0, { 0 } },
+	{ 9131, 6, 3, { 0xe2, 0xaa, 0xa9 } }, /* gescc; */
+	{ 6421, 7, 3, { 0xe2, 0x8a, 0xbd } }, /* barvee; */
+	{ 4252, 4, 2, { 0xc2, 0xae } }, /* REG; */
+	{ 0, 0, 0, { 0 } },
+	{ 2004, 4, 2, { 0xd0, 0x99 } }, /* Jcy; */
+	{ 6255, 4, 3, { 0xe2, 0xa9, 0xb0 } }, /* apE; */
+	{ 10702, 7, 3, { 0xe2, 0x8e, 0xb0 } }, /* lmoust; */
+	{ 1858, 6, 2, { 0xc3, 0x8c } }, /* Igrave */
+	{ 15349, 7, 3, { 0xe2, 0x8a, 0xa0 } }, /* timesb; */
+	{ 11794, 4, 3, { 0xe2, 0x89, 0xb0 } }, /* nle; */
+	{ 10747, 6, 3, { 0xe2, 0x89, 0xa8 } }, /* lneqq; */
+	{ 7646, 6, 3, { 0xe2, 0x86, 0xb5 } }, /* crarr; */
+	{ 5817, 5, 4, { 0xf0, 0x9d, 0x95, 0x8f } }, /* Xopf; */
+	{ 11236, 14, 3, { 0xe2, 0x88, 0xa1 } }, /* measuredangle; */
+	{ 16502, 6, 2, { 0xc3, 0xbd } }, /* yacute */
+	{ 568, 7, 3, { 0xe2, 0x89, 0x8d } }, /* CupCap; */
+	{ 7355, 5, 2, { 0xd1, 0x87 } }, /* chcy; */
+	{ 6197, 6, 3, { 0xe2, 0x88, 0x9f } }, /* angrt; */
+	{ 12154, 6, 3, { 0xe2, 0x88, 0xa4 } }, /* nsmid; */
+	{ 0, 0, 0, { 0 } },
+	{ 14751, 5, 3, { 0xe2, 0xab, 0x85 } }, /* subE; */
+	{ 14070, 7, 3, { 0xe2, 0x8b, 0x8c } }, /* rthree; */
+	{ 4647, 14, 3, { 0xe2, 0x86, 0xbe } }, /* RightUpVector; */
+	{ 0, 0, 0, { 0 } },
+	{ 5577, 15, 3, { 0xe2, 0x86, 0x96 } }, /* UpperLeftArrow; */
+	{ 11863, 4, 3, { 0xe2, 0x89, 0xae } }, /* nlt; */
+	{ 2582, 10, 3, { 0xe2, 0x89, 0xb2 } }, /* LessTilde; */
+	{ 5401, 9, 1, { 0x5f } }, /* UnderBar; */
+	{ 11561, 5, 3, { 0xe2, 0xa9, 0x83 } }, /* ncap; */
+	{ 13292, 5, 4, { 0xf0, 0x9d, 0x93, 0x85 } }, /* pscr; */
+	{ 9052, 4, 3, { 0xe2, 0xaa, 0x8c } }, /* gEl; */
+	{ 6435, 9, 3, { 0xe2, 0x8c, 0x85 } }, /* barwedge; */
+	{ 5805, 5, 4, { 0xf0, 0x9d, 0x92, 0xb2 } }, /* Wscr; */
+	{ 11384, 6, 3, { 0xe2, 0x8a, 0xb8 } }, /* mumap; */
+	{ 13744, 6, 3, { 0xe2, 0x87, 0x80 } }, /* rharu; */
+	{ 8656, 12, 3, { 0xe2, 0xaa, 0x95 } }, /* eqslantless; */
+	{ 15013, 5, 3, { 0xe2, 0x8a, 0x87 } }, /* supe; */
+	{ 10909, 8, 3, { 0xe2, 0x97, 0x8a } }, /* lozenge; */
+	{ 12865, 4, 2, { 0xc2, 0xb6 } }, /* para */
+	{ 5977, 5, 2, { 0xc3, 0xa2 } }, /* acirc */
+	{ 14427, 8, 3, { 0xe2, 0xa8, 0xa4 } }, /* simplus; */
+	{ 10659, 5, 2, { 0xd1, 0x99 } }, /* ljcy; */
+	{ 5565, 12, 3, { 0xe2, 0x87, 0x95 } }, /* Updownarrow; */
+	{ 3314, 13, 3, { 0xe2, 0x89, 0xb0 } }, /* NotLessEqual; */
+	{ 16465, 5, 4, { 0xf0, 0x9d, 0x93, 0x8d } }, /* xscr; */
+	{ 8855, 5, 3, { 0xe2, 0x99, 0xad } }, /* flat; */
+	{ 7903, 6, 3, { 0xe2, 0x88, 0xb1 } }, /* cwint; */
+	{ 12600, 4, 4, { 0xf0, 0x9d, 0x94, 0xac } }, /* ofr; */
+	{ 15807, 8, 3, { 0xe2, 0x86, 0x91 } }, /* uparrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 10771, 6, 3, { 0xe2, 0x9f, 0xa6 } }, /* lobrk; */
+	{ 7761, 7, 3, { 0xe2, 0x8a, 0x8d } }, /* cupdot; */
+	{ 14266, 5, 1, { 0x3b } }, /* semi; */
+	{ 13912, 13, 3, { 0xe2, 0x89, 0x93 } }, /* risingdotseq; */
+	{ 12647, 6, 3, { 0xe2, 0xa6, 0xbe } }, /* olcir; */
+	{ 7341, 10, 2, { 0xc2, 0xb7 } }, /* centerdot; */
+	{ 10280, 5, 1, { 0x7b } }, /* lcub; */
+	{ 0, 0, 0, { 0 } },
+	{ 4524, 9, 3, { 0xe2, 0x8a, 0xa2 } }, /* RightTee; */
+	{ 86, 6, 2, { 0xc4, 0x84 } }, /* Aogon; */
+	{ 15927, 5, 4, { 0xf0, 0x9d, 0x93, 0x8a } }, /* uscr; */
+	{ 11681, 4, 4, { 0xf0, 0x9d, 0x94, 0xab } }, /* nfr; */
+	{ 4810, 6, 2, { 0xc5, 0x9c } }, /* Scirc; */
+	{ 6266, 4, 3, { 0xe2, 0x89, 0x8a } }, /* ape; */
+	{ 5869, 5, 4, { 0xf0, 0x9d, 0x95, 0x90 } }, /* Yopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 4015, 8, 3, { 0xe2, 0x80, 0xbe } }, /* OverBar; */
+	{ 16028, 11, 3, { 0xe2, 0x88, 0x85 } }, /* varnothing; */
+	{ 10582, 11, 3, { 0xe2, 0xaa, 0x8b } }, /* lesseqqgtr; */
+	{ 0, 0, 0, { 0 } },
+	{ 12429, 8, 3, { 0xe2, 0xa7, 0x9e } }, /* nvinfin; */
+	{ 1689, 13, 3, { 0xe2, 0x89, 0xb3 } }, /* GreaterTilde; */
+	{ 8794, 14, 3, { 0xe2, 0x89, 0x92 } }, /* fallingdotseq; */
+	{ 12031, 8, 5, { 0xe2, 0xaa, 0xaf, 0xcc, 0xb8 } }, /* npreceq; */
+	{ 845, 21, 3, { 0xe2, 0x87, 0x94 } }, /* DoubleLeftRightArrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 2179, 20, 3, { 0xe2, 0x87, 0x86 } }, /* LeftArrowRightArrow; */
+	{ 7384, 5, 3, { 0xe2, 0xa7, 0x83 } }, /* cirE; */
+	{ 2081, 2, 1, { 0x3c } }, /* LT */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 4263, 5, 3, { 0xe2, 0x9f, 0xab } }, /* Rang; */
+	{ 8599, 6, 3, { 0xe2, 0xa9, 0xb1 } }, /* eplus; */
+	{ 9631, 5, 2, { 0xc2, 0xa1 } }, /* iexcl */
+	{ 2100, 5, 3, { 0xe2, 0x9f, 0xaa } }, /* Lang; */
+	{ 11, 3, 1, { 0x26 } }, /* AMP */
+	{ 5749, 14, 3, { 0xe2, 0x80, 0x8a } }, /* VeryThinSpace; */
+	{ 12106, 5, 4, { 0xf0, 0x9d, 0x93, 0x83 } }, /* nscr; */
+	{ 6590, 8, 3, { 0xe2, 0x98, 0x85 } }, /* bigstar; */
+	{ 7882, 6, 3, { 0xe2, 0x8b, 0x8e } }, /* cuvee; */
+	{ 9987, 7, 2, { 0xc4, 0xb7 } }, /* kcedil; */
+	{ 16297, 8, 3, { 0xe2, 0xa6, 0x9a } }, /* vzigzag; */
+	{ 9243, 6, 3, { 0xe2, 0x8b, 0xa7 } }, /* gnsim; */
+	{ 49, 4, 2, { 0xd0, 0x90 } }, /* Acy; */
+	{ 16376, 5, 3, { 0xe2, 0x8b, 0x83 } }, /* xcup; */
+	{ 6428, 7, 3, { 0xe2, 0x8c, 0x85 } }, /* barwed; */
+	{ 925, 21, 3, { 0xe2, 0x9f, 0xb9 } }, /* DoubleLongRightArrow; */
+	{ 4216, 4, 2, { 0xce, 0xa8 } }, /* Psi; */
+	{ 7611, 7, 3, { 0xe2, 0x88, 0xae } }, /* conint; */
+	{ 15466, 15, 3, { 0xe2, 0x8a, 0xb4 } }, /* trianglelefteq; */
+	{ 0, 0, 0, { 0 } },
+	{ 10609, 7, 3, { 0xe2, 0xa5, 0xbc } }, /* lfisht; */
+	{ 4033, 12, 3, { 0xe2, 0x8e, 0xb4 } }, /* OverBracket; */
+	{ 7827, 11, 3, { 0xe2, 0x8b, 0x8f } }, /* curlywedge; */
+	{ 13738, 6, 3, { 0xe2, 0x87, 0x81 } }, /* rhard; */
+	{ 5036, 12, 3, { 0xe2, 0x8a, 0x86 } }, /* SubsetEqual; */
+	{ 8093, 6, 3, { 0xe2, 0x8b, 0xb2 } }, /* disin; */
+	{ 16470, 7, 3, { 0xe2, 0xa8, 0x86 } }, /* xsqcup; */
+	{ 13598, 6, 3, { 0xe2, 0xa6, 0x8c } }, /* rbrke; */
+	{ 2817, 5, 3, { 0xe2, 0x84, 0xb3 } }, /* Mscr; */
+	{ 16370, 6, 3, { 0xe2, 0x97, 0xaf } }, /* xcirc; */
+	{ 1976, 7, 2, { 0xc4, 0xa8 } }, /* Itilde; */
+	{ 14670, 6, 3, { 0xe2, 0x86, 0x92 } }, /* srarr; */
+	{ 11357, 3, 3, { 0xe2, 0x88, 0x93 } }, /* mp; */
+	{ 8624, 7, 3, { 0xe2, 0x89, 0x96 } }, /* eqcirc; */
+	{ 9425, 5, 3, { 0xe2, 0x86, 0x94 } }, /* harr; */
+	{ 1543, 6, 2, { 0xce, 0x93 } }, /* Gamma; */
+	{ 7933, 7, 3, { 0xe2, 0x84, 0xb8 } }, /* daleth; */
+	{ 14790, 6, 3, { 0xe2, 0x8a, 0x8a } }, /* subne; */
+	{ 0, 0, 0, { 0 } },
+	{ 14627, 9, 3, { 0xe2, 0x8a, 0x90 } }, /* sqsupset; */
+	{ 16318, 6, 3, { 0xe2, 0x88, 0xa7 } }, /* wedge; */
+	{ 14399, 5, 3, { 0xe2, 0xaa, 0x9e } }, /* simg; */
+	{ 2754, 4, 3, { 0xe2, 0x86, 0xb0 } }, /* Lsh; */
+	{ 7501, 7, 3, { 0xe2, 0xab, 0xaf } }, /* cirmid; */
+	{ 13693, 9, 3, { 0xe2, 0x84, 0x9c } }, /* realpart; */
+	{ 5410, 11, 3, { 0xe2, 0x8f, 0x9f } }, /* UnderBrace; */
+	{ 11988, 7, 6, { 0xe2, 0xab, 0xbd, 0xe2, 0x83, 0xa5 } }, /* nparsl; */
+	{ 7231, 7, 3, { 0xe2, 0xa9, 0x87 } }, /* capcup; */
+	{ 18, 6, 2, { 0xc3, 0x81 } }, /* Aacute */
+	{ 12533, 5, 3, { 0xe2, 0x8a, 0x9b } }, /* oast; */
+	{ 15729, 7, 2, { 0xc3, 0xb9 } }, /* ugrave; */
+	{ 12756, 5, 2, { 0xc2, 0xaa } }, /* ordf; */
+	{ 8631, 8, 3, { 0xe2, 0x89, 0x95 } }, /* eqcolon; */
+	{ 6699, 18, 3, { 0xe2, 0x96, 0xbe } }, /* blacktriangledown; */
+	{ 16258, 6, 3, { 0xe2, 0x8a, 0xb3 } }, /* vrtri; */
+	{ 9909, 7, 2, { 0xc4, 0xa9 } }, /* itilde; */
+	{ 12187, 6, 5, { 0xe2, 0xab, 0x85, 0xcc, 0xb8 } }, /* nsubE; */
+	{ 0, 0, 0, { 0 } },
+	{ 1770, 5, 3, { 0xe2, 0x84, 0x8b } }, /* Hscr; */
+	{ 0, 0, 0, { 0 } },
+	{ 12905, 7, 1, { 0x25 } }, /* percnt; */
+	{ 0, 0, 0, { 0 } },
+	{ 677, 23, 2, { 0xcb, 0x9d } }, /* DiacriticalDoubleAcute; */
+	{ 0, 0, 0, { 0 } },
+	{ 9180, 4, 3, { 0xe2, 0x8b, 0x99 } }, /* ggg; */
+	{ 8254, 16, 3, { 0xe2, 0x87, 0x83 } }, /* downharpoonleft; */
+	{ 15505, 16, 3, { 0xe2, 0x8a, 0xb5 } }, /* trianglerighteq; */
+	{ 14089, 6, 3, { 0xe2, 0x8a, 0xb5 } }, /* rtrie; */
+	{ 7734, 4, 3, { 0xe2, 0x88, 0xaa } }, /* cup; */
+	{ 0, 0, 0, { 0 } },
+	{ 12387, 6, 3, { 0xe2, 0x80, 0x87 } }, /* numsp; */
+	{ 13627, 7, 2, { 0xc5, 0x97 } }, /* rcedil; */
+	{ 11573, 7, 2, { 0xc5, 0x86 } }, /* ncedil; */
+	{ 11673, 8, 3, { 0xe2, 0x88, 0x84 } }, /* nexists; */
+	{ 12594, 6, 3, { 0xe2, 0xa6, 0xbf } }, /* ofcir; */
+	{ 9152, 9, 3, { 0xe2, 0xaa, 0x84 } }, /* gesdotol; */
+	{ 4803, 7, 2, { 0xc5, 0x9e } }, /* Scedil; */
+	{ 0, 0, 0, { 0 } },
+	{ 8486, 7, 3, { 0xe2, 0xaa, 0x98 } }, /* egsdot; */
+	{ 13196, 8, 3, { 0xe2, 0x89, 0xbe } }, /* precsim; */
+	{ 0, 0, 0, { 0 } },
+	{ 15915, 6, 2, { 0xc5, 0xaf } }, /* uring; */
+	{ 1301, 6, 2, { 0xc3, 0x88 } }, /* Egrave */
+	{ 4734, 12, 3, { 0xe2, 0x87, 0x9b } }, /* Rrightarrow; */
+	{ 8050, 5, 3, { 0xe2, 0x8b, 0x84 } }, /* diam; */
+	{ 8310, 5, 4, { 0xf0, 0x9d, 0x92, 0xb9 } }, /* dscr; */
+	{ 3764, 14, 3, { 0xe2, 0x89, 0x84 } }, /* NotTildeEqual; */
+	{ 14796, 8, 3, { 0xe2, 0xaa, 0xbf } }, /* subplus; */
+	{ 321, 5, 2, { 0xc4, 0x8a } }, /* Cdot; */
+	{ 15637, 5, 3, { 0xe2, 0x87, 0x91 } }, /* uArr; */
+	{ 1322, 6, 2, { 0xc4, 0x92 } }, /* Emacr; */
+	{ 12683, 8, 2, { 0xce, 0xbf } }, /* omicron; */
+	{ 10517, 7, 3, { 0xe2, 0xa9, 0xbf } }, /* lesdot; */
+	{ 12846, 4, 2, { 0xc3, 0xb6 } }, /* ouml */
+	{ 5156, 6, 2, { 0xc3, 0x9e } }, /* THORN; */
+	{ 2698, 15, 3, { 0xe2, 0x9f, 0xb9 } }, /* Longrightarrow; */
+	{ 14243, 6, 3, { 0xe2, 0x86, 0x98 } }, /* searr; */
+	{ 6895, 6, 3, { 0xe2, 0x95, 0x99 } }, /* boxUr; */
+	{ 3796, 14, 3, { 0xe2, 0x89, 0x89 } }, /* NotTildeTilde; */
+	{ 11508, 8, 3, { 0xe2, 0x89, 0x89 } }, /* napprox; */
+	{ 1328, 17, 3, { 0xe2, 0x97, 0xbb } }, /* EmptySmallSquare; */
+	{ 6554, 8, 3, { 0xe2, 0xa8, 0x80 } }, /* bigodot; */
+	{ 5334, 9, 3, { 0xe2, 0xa5, 0x89 } }, /* Uarrocir; */
+	{ 13528, 8, 3, { 0xe2, 0xa5, 0xb4 } }, /* rarrsim; */
+	{ 16508, 7, 2, { 0xc3, 0xbd } }, /* yacute; */
+	{ 1372, 5, 4, { 0xf0, 0x9d, 0x94, 0xbc } }, /* Eopf; */
+	{ 1270, 7, 2, { 0xc4, 0x9a } }, /* Ecaron; */
+	{ 6270, 5, 3, { 0xe2, 0x89, 0x8b } }, /* apid; */
+	{ 15671, 7, 2, { 0xc5, 0xad } }, /* ubreve; */
+	{ 16179, 4, 2, { 0xd0, 0xb2 } }, /* vcy; */
+	{ 13457, 5, 2, { 0xc2, 0xbb } }, /* raquo */
+	{ 0, 0, 0, { 0 } },
+	{ 9173, 4, 4, { 0xf0, 0x9d, 0x94, 0xa4 } }, /* gfr; */
+	{ 11704, 10, 5, { 0xe2, 0xa9, 0xbe, 0xcc, 0xb8 } }, /* ngeqslant; */
+	{ 9937, 4, 2, { 0xd0, 0xb9 } }, /* jcy; */
+	{ 662, 15, 2, { 0xcb, 0x99 } }, /* DiacriticalDot; */
+	{ 10988, 5, 3, { 0xe2, 0x89, 0xb2 } }, /* lsim; */
+	{ 7366, 10, 3, { 0xe2, 0x9c, 0x93 } }, /* checkmark; */
+	{ 1465, 18, 3, { 0xe2, 0x97, 0xbc } }, /* FilledSmallSquare; */
+	{ 11475, 7, 2, { 0xc5, 0x84 } }, /* nacute; */
+	{ 13708, 5, 3, { 0xe2, 0x96, 0xad } }, /* rect; */
+	{ 12823, 7, 2, { 0xc3, 0xb5 } }, /* otilde; */
+	{ 7977, 4, 2, { 0xd0, 0xb4 } }, /* dcy; */
+	{ 9567, 7, 3, { 0xe2, 0x84, 0x8f } }, /* hslash; */
+	{ 14880, 5, 3, { 0xe2, 0x89, 0xbb } }, /* succ; */
+	{ 1461, 4, 4, { 0xf0, 0x9d, 0x94, 0x89 } }, /* Ffr; */
+	{ 14998, 7, 3, { 0xe2, 0xaa, 0xbe } }, /* supdot; */
+	{ 10372, 14, 3, { 0xe2, 0x86, 0xbc } }, /* leftharpoonup; */
+	{ 11768, 5, 2, { 0xd1, 0x9a } }, /* njcy; */
+	{ 11023, 7, 2, { 0xc5, 0x82 } }, /* lstrok; */
+	{ 0, 0, 0, { 0 } },
+	{ 15881, 11, 3, { 0xe2, 0x87, 0x88 } }, /* upuparrows; */
+	{ 9249, 5, 4, { 0xf0, 0x9d, 0x95, 0x98 } }, /* gopf; */
+	{ 8605, 5, 2, { 0xce, 0xb5 } }, /* epsi; */
+	{ 7516, 6, 3, { 0xe2, 0x99, 0xa3 } }, /* clubs; */
+	{ 8668, 7, 1, { 0x3d } }, /* equals; */
+	{ 5557, 8, 3, { 0xe2, 0x87, 0x91 } }, /* Uparrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 12341, 15, 3, { 0xe2, 0x8b, 0xab } }, /* ntriangleright; */
+	{ 7268, 7, 2, { 0xc4, 0x8d } }, /* ccaron; */
+	{ 0, 0, 0, { 0 } },
+	{ 2385, 18, 3, { 0xe2, 0x8a, 0xb4 } }, /* LeftTriangleEqual; */
+	{ 206, 4, 4, { 0xf0, 0x9d, 0x94, 0x85 } }, /* Bfr; */
+	{ 4256, 7, 2, { 0xc5, 0x94 } }, /* Racute; */
+	{ 0, 0, 0, { 0 } },
+	{ 2066, 5, 4, { 0xf0, 0x9d, 0x95, 0x82 } }, /* Kopf; */
+	{ 2592, 4, 4, { 0xf0, 0x9d, 0x94, 0x8f } }, /* Lfr; */
+	{ 14540, 10, 3, { 0xe2, 0x99, 0xa0 } }, /* spadesuit; */
+	{ 9673, 6, 3, { 0xe2, 0x88, 0xad } }, /* iiint; */
+	{ 11600, 4, 2, { 0xd0, 0xbd } }, /* ncy; */
+	{ 12805, 7, 2, { 0xc3, 0xb8 } }, /* oslash; */
+	{ 13654, 8, 3, { 0xe2, 0xa5, 0xa9 } }, /* rdldhar; */
+	{ 10113, 4, 3, { 0xe2, 0xaa, 0x85 } }, /* lap; */
+	{ 0, 0, 0, { 0 } },
+	{ 10753, 6, 3, { 0xe2, 0x8b, 0xa6 } }, /* lnsim; */
+	{ 15365, 7, 3, { 0xe2, 0xa8, 0xb0 } }, /* timesd; */
+	{ 13948, 11, 3, { 0xe2, 0x8e, 0xb1 } }, /* rmoustache; */
+	{ 4273, 7, 3, { 0xe2, 0xa4, 0x96 } }, /* Rarrtl; */
+	{ 3843, 3, 2, { 0xce, 0x9d } }, /* Nu; */
+	{ 0, 0, 0, { 0 } },
+	{ 1068, 10, 2, { 0xcc, 0x91 } }, /* DownBreve; */
+	{ 15550, 6, 3, { 0xe2, 0xa7, 0x8d } }, /* trisb; */
+	{ 8849, 6, 2, { 0x66, 0x6a } }, /* fjlig; */
+	{ 12293, 6, 2, { 0xc3, 0xb1 } }, /* ntilde */
+	{ 3169, 15, 3, { 0xe2, 0x89, 0xb9 } }, /* NotGreaterLess; */
+	{ 5848, 7, 2, { 0xc3, 0x9d } }, /* Yacute; */
+	{ 8466, 3, 3, { 0xe2, 0xaa, 0x9a } }, /* eg; */
+	{ 4335, 21, 3, { 0xe2, 0xa5, 0xaf } }, /* ReverseUpEquilibrium; */
+	{ 6403, 8, 3, { 0xe2, 0x88, 0xbd } }, /* backsim; */
+	{ 2211, 18, 3, { 0xe2, 0x9f, 0xa6 } }, /* LeftDoubleBracket; */
+	{ 6048, 6, 2, { 0xce, 0xb1 } }, /* alpha; */
+	{ 14665, 5, 3, { 0xe2, 0x96, 0xaa } }, /* squf; */
+	{ 15453, 13, 3, { 0xe2, 0x97, 0x83 } }, /* triangleleft; */
+	{ 16520, 6, 2, { 0xc5, 0xb7 } }, /* ycirc; */
+	{ 16008, 11, 2, { 0xcf, 0xb5 } }, /* varepsilon; */
+	{ 5896, 7, 2, { 0xc5, 0xbd } }, /* Zcaron; */
+	{ 8555, 7, 3, { 0xe2, 0x80, 0x85 } }, /* emsp14; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 7866, 16, 3, { 0xe2, 0x86, 0xb7 } }, /* curvearrowright; */
+	{ 14594, 9, 3, { 0xe2, 0x8a, 0x8f } }, /* sqsubset; */
+	{ 7916, 5, 3, { 0xe2, 0x87, 0x93 } }, /* dArr; */
+	{ 635, 6, 2, { 0xce, 0x94 } }, /* Delta; */
+	{ 14971, 4, 2, { 0xc2, 0xb2 } }, /* sup2 */
+	{ 11752, 3, 3, { 0xe2, 0x88, 0x8b } }, /* ni; */
+	{ 4889, 12, 3, { 0xe2, 0x88, 0x98 } }, /* SmallCircle; */
+	{ 5889, 7, 2, { 0xc5, 0xb9 } }, /* Zacute; */
+	{ 15491, 14, 3, { 0xe2, 0x96, 0xb9 } }, /* triangleright; */
+	{ 7452, 11, 3, { 0xe2, 0x8a, 0x9b } }, /* circledast; */
+	{ 10315, 9, 3, { 0xe2, 0xa5, 0x8b } }, /* ldrushar; */
+	{ 15280, 12, 3, { 0xe2, 0x89, 0x88 } }, /* thickapprox; */
+	{ 5457, 10, 3, { 0xe2, 0x8a, 0x8e } }, /* UnionPlus; */
+	{ 8444, 4, 2, { 0xd1, 0x8d } }, /* ecy; */
+	{ 11122, 10, 6, { 0xe2, 0x89, 0xa8, 0xef, 0xb8, 0x80 } }, /* lvertneqq; */
+	{ 10432, 18, 3, { 0xe2, 0x87, 0x8b } }, /* leftrightharpoons; */
+	{ 1580, 5, 2, { 0xc4, 0xa0 } }, /* Gdot; */
+	{ 210, 5, 4, { 0xf0, 0x9d, 0x94, 0xb9 } }, /* Bopf; */
+	{ 15018, 8, 3, { 0xe2, 0xab, 0x84 } }, /* supedot; */
+	{ 300, 7, 2, { 0xc3, 0x87 } }, /* Ccedil; */
+	{ 12376, 4, 1, { 0x23 } }, /* num; */
+	{ 11403, 11, 3, { 0xe2, 0x87, 0x8d } }, /* nLeftarrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 13480, 6, 3, { 0xe2, 0x87, 0xa5 } }, /* rarrb; */
+	{ 5278, 11, 3, { 0xe2, 0x89, 0x88 } }, /* TildeTilde; */
+	{ 10206, 6, 6, { 0xe2, 0xaa, 0xad, 0xef, 0xb8, 0x80 } }, /* lates; */
+	{ 5236, 10, 3, { 0xe2, 0x80, 0x89 } }, /* ThinSpace; */
+	{ 11434, 4, 6, { 0xe2, 0x89, 0xaa, 0xe2, 0x83, 0x92 } }, /* nLt; */
+	{ 16052, 10, 3, { 0xe2, 0x88, 0x9d } }, /* varpropto; */
+	{ 7719, 7, 3, { 0xe2, 0x86, 0xb6 } }, /* cularr; */
+	{ 7618, 5, 4, { 0xf0, 0x9d, 0x95, 0x94 } }, /* copf; */
+	{ 15564, 9, 3, { 0xe2, 0x8f, 0xa2 } }, /* trpezium; */
+	{ 1998, 6, 2, { 0xc4, 0xb4 } }, /* Jcirc; */
+	{ 5057, 14, 3, { 0xe2, 0xaa, 0xb0 } }, /* SucceedsEqual; */
+	{ 10742, 5, 3, { 0xe2, 0xaa, 0x87 } }, /* lneq; */
+	{ 761, 4, 2, { 0xc2, 0xa8 } }, /* Dot; */
+	{ 3610, 23, 3, { 0xe2, 0x8b, 0xa3 } }, /* NotSquareSupersetEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 9893, 7, 3, { 0xe2, 0x8b, 0xb3 } }, /* isinsv; */
+	{ 15573, 5, 4, { 0xf0, 0x9d, 0x93, 0x89 } }, /* tscr; */
+	{ 12449, 5, 4, { 0x3c, 0xe2, 0x83, 0x92 } }, /* nvlt; */
+	{ 14176, 5, 3, { 0xe2, 0xaa, 0xb6 } }, /* scnE; */
+	{ 8733, 4, 2, { 0xce, 0xb7 } }, /* eta; */
+	{ 7707, 6, 3, { 0xe2, 0x8b, 0x9e } }, /* cuepr; */
+	{ 397, 25, 3, { 0xe2, 0x88, 0xb2 } }, /* ClockwiseContourIntegral; */
+	{ 9206, 4, 3, { 0xe2, 0xaa, 0xa4 } }, /* glj; */
+	{ 12830, 7, 3, { 0xe2, 0x8a, 0x97 } }, /* otimes; */
+	{ 9968, 6, 2, { 0xd1, 0x94 } }, /* jukcy; */
+	{ 4968, 15, 3, { 0xe2, 0x8a, 0x90 } }, /* SquareSuperset; */
+	{ 6027, 7, 2, { 0xc3, 0xa0 } }, /* agrave; */
+	{ 14957, 5, 3, { 0xe2, 0x99, 0xaa } }, /* sung; */
+	{ 15132, 7, 3, { 0xe2, 0xab, 0x94 } }, /* supsub; */
+	{ 1549, 7, 2, { 0xcf, 0x9c } }, /* Gammad; */
+	{ 803, 10, 2, { 0xc2, 0xa8 } }, /* DoubleDot; */
+	{ 0, 0, 0, { 0 } },
+	{ 15938, 7, 2, { 0xc5, 0xa9 } }, /* utilde; */
+	{ 0, 0, 0, { 0 } },
+	{ 9588, 7, 3, { 0xe2, 0x80, 0x90 } }, /* hyphen; */
+	{ 15064, 6, 3, { 0xe2, 0x8a, 0x8b } }, /* supne; */
+	{ 0, 0, 0, { 0 } },
+	{ 10139, 8, 3, { 0xe2, 0xa4, 0x9f } }, /* larrbfs; */
+	{ 7603, 8, 3, { 0xe2, 0xa9, 0xad } }, /* congdot; */
+	{ 0, 0, 0, { 0 } },
+	{ 1345, 21, 3, { 0xe2, 0x96, 0xab } }, /* EmptyVerySmallSquare; */
+	{ 16213, 7, 1, { 0x7c } }, /* verbar; */
+	{ 14353, 4, 2, { 0xc2, 0xad } }, /* shy; */
+	{ 3250, 16, 3, { 0xe2, 0x8b, 0xaa } }, /* NotLeftTriangle; */
+	{ 3012, 4, 3, { 0xe2, 0xab, 0xac } }, /* Not; */
+	{ 10029, 6, 3, { 0xe2, 0x87, 0x9a } }, /* lAarr; */
+	{ 12812, 5, 3, { 0xe2, 0x8a, 0x98 } }, /* osol; */
+	{ 0, 0, 0, { 0 } },
+	{ 11965, 8, 3, { 0xe2, 0x8b, 0xbd } }, /* notnivc; */
+	{ 6766, 6, 3, { 0xe2, 0x96, 0x91 } }, /* blk14; */
+	{ 9102, 3, 3, { 0xe2, 0x89, 0xa5 } }, /* ge; */
+	{ 7786, 8, 3, { 0xe2, 0xa4, 0xbc } }, /* curarrm; */
+	{ 11978, 10, 3, { 0xe2, 0x88, 0xa6 } }, /* nparallel; */
+	{ 2305, 16, 3, { 0xe2, 0xa5, 0x8e } }, /* LeftRightVector; */
+	{ 11345, 7, 3, { 0xe2, 0x8a, 0xa7 } }, /* models; */
+	{ 7313, 5, 2, { 0xc2, 0xb8 } }, /* cedil */
+	{ 12632, 4, 2, { 0xce, 0xa9 } }, /* ohm; */
+	{ 7318, 6, 2, { 0xc2, 0xb8 } }, /* cedil; */
+	{ 11857, 6, 3, { 0xe2, 0x89, 0xb4 } }, /* nlsim; */
+	{ 1737, 13, 3, { 0xe2, 0x84, 0x8b } }, /* HilbertSpace; */
+	{ 7288, 6, 2, { 0xc4, 0x89 } }, /* ccirc; */
+	{ 9372, 7, 3, { 0xe2, 0x89, 0xb3 } }, /* gtrsim; */
+	{ 473, 10, 3, { 0xe2, 0x89, 0xa1 } }, /* Congruent; */
+	{ 12489, 7, 3, { 0xe2, 0xa4, 0xa3 } }, /* nwarhk; */
+	{ 3887, 4, 4, { 0xf0, 0x9d, 0x94, 0x92 } }, /* Ofr; */
+	{ 14257, 4, 2, { 0xc2, 0xa7 } }, /* sect */
+	{ 14984, 5, 2, { 0xc2, 0xb3 } }, /* sup3; */
+	{ 15173, 7, 3, { 0xe2, 0xa4, 0xaa } }, /* swnwar; */
+	{ 4883, 6, 2, { 0xce, 0xa3 } }, /* Sigma; */
+	{ 0, 0, 0, { 0 } },
+	{ 7668, 6, 3, { 0xe2, 0xab, 0x91 } }, /* csube; */
+	{ 11604, 6, 3, { 0xe2, 0x80, 0x93 } }, /* ndash; */
+	{ 10966, 6, 3, { 0xe2, 0x8a, 0xbf } }, /* lrtri; */
+	{ 9555, 7, 3, { 0xe2, 0x80, 0x95 } }, /* horbar; */
+	{ 13411, 7, 2, { 0xc5, 0x95 } }, /* racute; */
+	{ 0, 0, 0, { 0 } },
+	{ 13334, 12, 3, { 0xe2, 0x84, 0x8d } }, /* quaternions; */
+	{ 10627, 3, 3, { 0xe2, 0x89, 0xb6 } }, /* lg; */
+	{ 7970, 7, 2, { 0xc4, 0x8f } }, /* dcaron; */
+	{ 1288, 4, 2, { 0xd0, 0xad } }, /* Ecy; */
+	{ 0, 0, 0, { 0 } },
+	{ 14435, 8, 3, { 0xe2, 0xa5, 0xb2 } }, /* simrarr; */
+	{ 9499, 9, 3, { 0xe2, 0xa4, 0xa6 } }, /* hkswarow; */
+	{ 0, 0, 0, { 0 } },
+	{ 3354, 18, 5, { 0xe2, 0xa9, 0xbd, 0xcc, 0xb8 } }, /* NotLessSlantEqual; */
+	{ 6449, 9, 3, { 0xe2, 0x8e, 0xb6 } }, /* bbrktbrk; */
+	{ 14357, 6, 2, { 0xcf, 0x83 } }, /* sigma; */
+	{ 6134, 9, 3, { 0xe2, 0xa6, 0xa9 } }, /* angmsdab; */
+	{ 16067, 7, 2, { 0xcf, 0xb1 } }, /* varrho; */
+	{ 11949, 8, 3, { 0xe2, 0x88, 0x8c } }, /* notniva; */
+	{ 10081, 7, 3, { 0xe2, 0x84, 0x92 } }, /* lagran; */
+	{ 1457, 4, 2, { 0xd0, 0xa4 } }, /* Fcy; */
+	{ 15892, 7, 3, { 0xe2, 0x8c, 0x9d } }, /* urcorn; */
+	{ 11181, 11, 3, { 0xe2, 0x86, 0xa7 } }, /* mapstodown; */
+	{ 0, 0, 0, { 0 } },
+	{ 5421, 13, 3, { 0xe2, 0x8e, 0xb5 } }, /* UnderBracket; */
+	{ 6489, 8, 3, { 0xe2, 0xa6, 0xb0 } }, /* bemptyv; */
+	{ 9636, 6, 2, { 0xc2, 0xa1 } }, /* iexcl; */
+	{ 4440, 19, 3, { 0xe2, 0x9f, 0xa7 } }, /* RightDoubleBracket; */
+	{ 13720, 7, 3, { 0xe2, 0xa5, 0xbd } }, /* rfisht; */
+	{ 6806, 4, 3, { 0xe2, 0x8a, 0xa5 } }, /* bot; */
+	{ 6942, 7, 3, { 0xe2, 0xa7, 0x89 } }, /* boxbox; */
+	{ 2290, 15, 3, { 0xe2, 0x86, 0x94 } }, /* LeftRightArrow; */
+	{ 2749, 5, 3, { 0xe2, 0x84, 0x92 } }, /* Lscr; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 11619, 7, 3, { 0xe2, 0xa4, 0xa4 } }, /* nearhk; */
+	{ 13222, 6, 3, { 0xe2, 0xaa, 0xb9 } }, /* prnap; */
+	{ 12738, 6, 3, { 0xe2, 0x84, 0xb4 } }, /* order; */
+	{ 6735, 19, 3, { 0xe2, 0x96, 0xb8 } }, /* blacktriangleright; */
+	{ 0, 0, 0, { 0 } },
+	{ 11010, 6, 3, { 0xe2, 0x80, 0x98 } }, /* lsquo; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 5144, 7, 3, { 0xe2, 0x8b, 0x91 } }, /* Supset; */
+	{ 6918, 6, 3, { 0xe2, 0x95, 0xa0 } }, /* boxVR; */
+	{ 9127, 4, 3, { 0xe2, 0xa9, 0xbe } }, /* ges; */
+	{ 0, 0, 0, { 0 } },
+	{ 13761, 5, 2, { 0xcf, 0xb1 } }, /* rhov; */
+	{ 313, 8, 3, { 0xe2, 0x88, 0xb0 } }, /* Cconint; */
+	{ 9755, 6, 3, { 0xe2, 0x88, 0x9e } }, /* infin; */
+	{ 12462, 7, 3, { 0xe2, 0xa4, 0x83 } }, /* nvrArr; */
+	{ 14490, 4, 3, { 0xe2, 0xaa, 0xaa } }, /* smt; */
+	{ 362, 12, 3, { 0xe2, 0x8a, 0x96 } }, /* CircleMinus; */
+	{ 4114, 3, 3, { 0xe2, 0xaa, 0xbb } }, /* Pr; */
+	{ 0, 0, 0, { 0 } },
+	{ 6562, 9, 3, { 0xe2, 0xa8, 0x81 } }, /* bigoplus; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 9951, 5, 4, { 0xf0, 0x9d, 0x95, 0x9b } }, /* jopf; */
+	{ 10759, 6, 3, { 0xe2, 0x9f, 0xac } }, /* loang; */
+	{ 16428, 6, 3, { 0xe2, 0xa8, 0x80 } }, /* xodot; */
+	{ 3496, 17, 3, { 0xe2, 0x8b, 0xab } }, /* NotRightTriangle; */
+	{ 6810, 7, 3, { 0xe2, 0x8a, 0xa5 } }, /* bottom; */
+	{ 10511, 6, 3, { 0xe2, 0xaa, 0xa8 } }, /* lescc; */
+	{ 8900, 9, 3, { 0xe2, 0xa8, 0x8d } }, /* fpartint; */
+	{ 7394, 7, 3, { 0xe2, 0x89, 0x97 } }, /* circeq; */
+	{ 10962, 4, 3, { 0xe2, 0x80, 0x8e } }, /* lrm; */
+	{ 1224, 10, 3, { 0xe2, 0x87, 0x93 } }, /* Downarrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 8414, 7, 2, { 0xc4, 0x9b } }, /* ecaron; */
+	{ 9282, 2, 1, { 0x3e } }, /* gt */
+	{ 7250, 6, 3, { 0xe2, 0x81, 0x81 } }, /* caret; */
+	{ 16360, 5, 4, { 0xf0, 0x9d, 0x93, 0x8c } }, /* wscr; */
+	{ 6336, 7, 2, { 0xc3, 0xa3 } }, /* atilde; */
+	{ 8520, 6, 2, { 0xc4, 0x93 } }, /* emacr; */
+	{ 13204, 6, 3, { 0xe2, 0x80, 0xb2 } }, /* prime; */
+	{ 7981, 3, 3, { 0xe2, 0x85, 0x86 } }, /* dd; */
+	{ 14293, 5, 3, { 0xe2, 0x9c, 0xb6 } }, /* sext; */
+	{ 6241, 6, 2, { 0xc4, 0x85 } }, /* aogon; */
+	{ 7588, 10, 3, { 0xe2, 0x84, 0x82 } }, /* complexes; */
+	{ 8889, 5, 3, { 0xe2, 0x8b, 0x94 } }, /* fork; */
+	{ 14776, 8, 3, { 0xe2, 0xab, 0x81 } }, /* submult; */
+	{ 0, 0, 0, { 0 } },
+	{ 7434, 9, 2, { 0xc2, 0xae } }, /* circledR; */
+	{ 13840, 18, 3, { 0xe2, 0x87, 0x8c } }, /* rightleftharpoons; */
+	{ 978, 14, 3, { 0xe2, 0x87, 0x91 } }, /* DoubleUpArrow; */
+	{ 7851, 15, 3, { 0xe2, 0x86, 0xb6 } }, /* curvearrowleft; */
+	{ 16526, 4, 2, { 0xd1, 0x8b } }, /* ycy; */
+	{ 4224, 5, 1, { 0x22 } }, /* QUOT; */
+	{ 15706, 6, 3, { 0xe2, 0xa5, 0xae } }, /* udhar; */
+	{ 13604, 8, 3, { 0xe2, 0xa6, 0x8e } }, /* rbrksld; */
+	{ 16530, 3, 2, { 0xc2, 0xa5 } }, /* yen */
+	{ 0, 0, 0, { 0 } },
+	{ 609, 5, 3, { 0xe2, 0x86, 0xa1 } }, /* Darr; */
+	{ 12039, 6, 3, { 0xe2, 0x87, 0x8f } }, /* nrArr; */
+	{ 9608, 3, 3, { 0xe2, 0x81, 0xa3 } }, /* ic; */
+	{ 5717, 18, 3, { 0xe2, 0x9d, 0x98 } }, /* VerticalSeparator; */
+	{ 15481, 10, 3, { 0xe2, 0x89, 0x9c } }, /* triangleq; */
+	{ 0, 0, 0, { 0 } },
+	{ 14568, 6, 3, { 0xe2, 0x8a, 0x94 } }, /* sqcup; */
+	{ 12734, 4, 3, { 0xe2, 0xa9, 0x9d } }, /* ord; */
+	{ 13424, 9, 3, { 0xe2, 0xa6, 0xb3 } }, /* raemptyv; */
+	{ 11943, 6, 3, { 0xe2, 0x88, 0x8c } }, /* notni; */
+	{ 5842, 6, 2, { 0xc3, 0x9d } }, /* Yacute */
+	{ 15989, 6, 3, { 0xe2, 0xab, 0xa9 } }, /* vBarv; */
+	{ 12400, 7, 3, { 0xe2, 0xa4, 0x84 } }, /* nvHarr; */
+	{ 2083, 3, 1, { 0x3c } }, /* LT; */
+	{ 2156, 10, 3, { 0xe2, 0x86, 0x90 } }, /* LeftArrow; */
+	{ 14484, 6, 3, { 0xe2, 0x8c, 0xa3 } }, /* smile; */
+	{ 11320, 8, 3, { 0xe2, 0xa8, 0xaa } }, /* minusdu; */
+	{ 12850, 5, 2, { 0xc3, 0xb6 } }, /* ouml; */
+	{ 13121, 6, 3, { 0xe2, 0x89, 0xbc } }, /* prcue; */
+	{ 0, 0, 0, { 0 } },
+	{ 3016, 13, 3, { 0xe2, 0x89, 0xa2 } }, /* NotCongruent; */
+	{ 1899, 4, 3, { 0xe2, 0x88, 0xac } }, /* Int; */
+	{ 5382, 6, 2, { 0xc3, 0x99 } }, /* Ugrave */
+	{ 11885, 5, 4, { 0xf0, 0x9d, 0x95, 0x9f } }, /* nopf; */
+	{ 15742, 6, 3, { 0xe2, 0x86, 0xbe } }, /* uharr; */
+	{ 12001, 8, 3, { 0xe2, 0xa8, 0x94 } }, /* npolint; */
+	{ 5822, 5, 4, { 0xf0, 0x9d, 0x92, 0xb3 } }, /* Xscr; */
+	{ 1257, 6, 2, { 0xc3, 0x89 } }, /* Eacute */
+	{ 14463, 7, 3, { 0xe2, 0xa8, 0xb3 } }, /* smashp; */
+	{ 15372, 5, 3, { 0xe2, 0x88, 0xad } }, /* tint; */
+	{ 3999, 7, 3, { 0xe2, 0xa8, 0xb7 } }, /* Otimes; */
+	{ 15921, 6, 3, { 0xe2, 0x97, 0xb9 } }, /* urtri; */
+	{ 16347, 3, 3, { 0xe2, 0x84, 0x98 } }, /* wp; */
+	{ 11740, 6, 3, { 0xe2, 0x86, 0xae } }, /* nharr; */
+	{ 3836, 7, 2, { 0xc3, 0x91 } }, /* Ntilde; */
+	{ 0, 0, 0, { 0 } },
+	{ 4243, 6, 3, { 0xe2, 0xa4, 0x90 } }, /* RBarr; */
+	{ 8843, 6, 3, { 0xef, 0xac, 0x81 } }, /* filig; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 6188, 9, 3, { 0xe2, 0xa6, 0xaf } }, /* angmsdah; */
+	{ 8688, 8, 3, { 0xe2, 0xa9, 0xb8 } }, /* equivDD; */
+	{ 15026, 8, 3, { 0xe2, 0x9f, 0x89 } }, /* suphsol; */
+	{ 8338, 5, 3, { 0xe2, 0x96, 0xbf } }, /* dtri; */
+	{ 16622, 5, 4, { 0xf0, 0x9d, 0x95, 0xab } }, /* zopf; */
+	{ 5966, 3, 3, { 0xe2, 0x88, 0xbe } }, /* ac; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 9745, 3, 3, { 0xe2, 0x88, 0x88 } }, /* in; */
+	{ 2369, 16, 3, { 0xe2, 0xa7, 0x8f } }, /* LeftTriangleBar; */
+	{ 16137, 9, 2, { 0xcf, 0x91 } }, /* vartheta; */
+	{ 9980, 7, 2, { 0xcf, 0xb0 } }, /* kappav; */
+	{ 5692, 12, 3, { 0xe2, 0x88, 0xa3 } }, /* VerticalBar; */
+	{ 12615, 7, 2, { 0xc3, 0xb2 } }, /* ograve; */
+	{ 0, 0, 0, { 0 } },
+	{ 13766, 11, 3, { 0xe2, 0x86, 0x92 } }, /* rightarrow; */
+	{ 14470, 9, 3, { 0xe2, 0xa7, 0xa4 } }, /* smeparsl; */
+	{ 0, 0, 0, { 0 } },
+	{ 9863, 5, 4, { 0xf0, 0x9d, 0x92, 0xbe } }, /* iscr; */
+	{ 2830, 7, 2, { 0xc5, 0x83 } }, /* Nacute; */
+	{ 9941, 4, 4, { 0xf0, 0x9d, 0x94, 0xa7 } }, /* jfr; */
+	{ 6754, 6, 3, { 0xe2, 0x90, 0xa3 } }, /* blank; */
+	{ 4661, 17, 3, { 0xe2, 0xa5, 0x94 } }, /* RightUpVectorBar; */
+	{ 15058, 6, 3, { 0xe2, 0xab, 0x8c } }, /* supnE; */
+	{ 1589, 3, 3, { 0xe2, 0x8b, 0x99 } }, /* Gg; */
+	{ 11258, 5, 2, { 0xc2, 0xb5 } }, /* micro */
+	{ 9418, 7, 2, { 0xd1, 0x8a } }, /* hardcy; */
+	{ 9343, 10, 3, { 0xe2, 0x8b, 0x9b } }, /* gtreqless; */
+	{ 10128, 5, 3, { 0xe2, 0x86, 0x90 } }, /* larr; */
+	{ 10541, 5, 6, { 0xe2, 0x8b, 0x9a, 0xef, 0xb8, 0x80 } }, /* lesg; */
+	{ 13640, 5, 1, { 0x7d } }, /* rcub; */
+	{ 5999, 4, 2, { 0xd0, 0xb0 } }, /* acy; */
+	{ 6547, 7, 3, { 0xe2, 0x8b, 0x83 } }, /* bigcup; */
+	{ 8711, 6, 3, { 0xe2, 0xa5, 0xb1 } }, /* erarr; */
+	{ 10532, 9, 3, { 0xe2, 0xaa, 0x83 } }, /* lesdotor; */
+	{ 13073, 8, 3, { 0xe2, 0xa8, 0xa7 } }, /* plustwo; */
+	{ 0, 0, 0, { 0 } },
+	{ 5592, 16, 3, { 0xe2, 0x86, 0x97 } }, /* UpperRightArrow; */
+	{ 9049, 3, 3, { 0xe2, 0x89, 0xa7 } }, /* gE; */
+	{ 8753, 5, 3, { 0xe2, 0x82, 0xac } }, /* euro; */
+	{ 9642, 4, 3, { 0xe2, 0x87, 0x94 } }, /* iff; */
+	{ 233, 5, 2, { 0xd0, 0xa7 } }, /* CHcy; */
+	{ 5113, 4, 3, { 0xe2, 0x88, 0x91 } }, /* Sum; */
+	{ 1644, 15, 3, { 0xe2, 0xaa, 0xa2 } }, /* GreaterGreater; */
+	{ 7351, 4, 4, { 0xf0, 0x9d, 0x94, 0xa0 } }, /* cfr; */
+	{ 7443, 9, 3, { 0xe2, 0x93, 0x88 } }, /* circledS; */
+	{ 11613, 6, 3, { 0xe2, 0x87, 0x97 } }, /* neArr; */
+	{ 9626, 5, 2, { 0xd0, 0xb5 } }, /* iecy; */
+	{ 8270, 17, 3, { 0xe2, 0x87, 0x82 } }, /* downharpoonright; */
+	{ 10601, 8, 3, { 0xe2, 0x89, 0xb2 } }, /* lesssim; */
+	{ 10260, 7, 2, { 0xc4, 0xbe } }, /* lcaron; */
+	{ 0, 0, 0, { 0 } },
+	{ 9292, 6, 3, { 0xe2, 0xa9, 0xba } }, /* gtcir; */
+	{ 14636, 11, 3, { 0xe2, 0x8a, 0x92 } }, /* sqsupseteq; */
+	{ 12267, 10, 3, { 0xe2, 0x8a, 0x89 } }, /* nsupseteq; */
+	{ 11851, 6, 3, { 0xe2, 0x89, 0xae } }, /* nless; */
+	{ 15356, 9, 3, { 0xe2, 0xa8, 0xb1 } }, /* timesbar; */
+	{ 15191, 7, 3, { 0xe2, 0x8c, 0x96 } }, /* target; */
+	{ 0, 0, 0, { 0 } },
+	{ 13925, 6, 3, { 0xe2, 0x87, 0x84 } }, /* rlarr; */
+	{ 4494, 19, 3, { 0xe2, 0xa5, 0x95 } }, /* RightDownVectorBar; */
+	{ 6034, 8, 3, { 0xe2, 0x84, 0xb5 } }, /* alefsym; */
+	{ 13727, 7, 3, { 0xe2, 0x8c, 0x8b } }, /* rfloor; */
+	{ 1659, 12, 3, { 0xe2, 0x89, 0xb7 } }, /* GreaterLess; */
+	{ 3372, 13, 3, { 0xe2, 0x89, 0xb4 } }, /* NotLessTilde; */
+	{ 16311, 7, 3, { 0xe2, 0xa9, 0x9f } }, /* wedbar; */
+	{ 13549, 7, 3, { 0xe2, 0xa4, 0x9a } }, /* ratail; */
+	{ 11093, 6, 3, { 0xe2, 0x8a, 0xb4 } }, /* ltrie; */
+	{ 9823, 5, 2, { 0xd1, 0x91 } }, /* iocy; */
+	{ 10154, 7, 3, { 0xe2, 0x86, 0xa9 } }, /* larrhk; */
+	{ 15393, 7, 3, { 0xe2, 0xab, 0xb1 } }, /* topcir; */
+	{ 5117, 4, 3, { 0xe2, 0x8b, 0x91 } }, /* Sup; */
+	{ 16391, 6, 3, { 0xe2, 0x9f, 0xba } }, /* xhArr; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 2812, 5, 4, { 0xf0, 0x9d, 0x95, 0x84 } }, /* Mopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 3007, 5, 3, { 0xe2, 0x84, 0x95 } }, /* Nopf; */
+	{ 10927, 7, 3, { 0xe2, 0xa6, 0x93 } }, /* lparlt; */
+	{ 15332, 6, 2, { 0xcb, 0x9c } }, /* tilde; */
+	{ 5982, 6, 2, { 0xc3, 0xa2 } }, /* acirc; */
+	{ 9044, 5, 4, { 0xf0, 0x9d, 0x92, 0xbb } }, /* fscr; */
+	{ 13792, 17, 3, { 0xe2, 0x87, 0x81 } }, /* rightharpoondown; */
+	{ 12045, 6, 3, { 0xe2, 0x86, 0x9b } }, /* nrarr; */
+	{ 6515, 5, 3, { 0xe2, 0x84, 0xb6 } }, /* beth; */
+	{ 1627, 17, 3, { 0xe2, 0x89, 0xa7 } }, /* GreaterFullEqual; */
+	{ 0, 0, 0, { 0 } },
+	{ 11162, 8, 3, { 0xe2, 0x9c, 0xa0 } }, /* maltese; */
+	{ 16342, 5, 4, { 0xf0, 0x9d, 0x95, 0xa8 } }, /* wopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 2329, 13, 3, { 0xe2, 0x86, 0xa4 } }, /* LeftTeeArrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 8296, 7, 3, { 0xe2, 0x8c, 0x9f } }, /* drcorn; */
+	{ 0, 0, 0, { 0 } },
+	{ 7713, 6, 3, { 0xe2, 0x8b, 0x9f } }, /* cuesc; */
+	{ 1563, 7, 2, { 0xc4, 0xa2 } }, /* Gcedil; */
+	{ 11287, 6, 2, { 0xc2, 0xb7 } }, /* middot */
+	{ 8722, 6, 3, { 0xe2, 0x89, 0x90 } }, /* esdot; */
+	{ 9828, 6, 2, { 0xc4, 0xaf } }, /* iogon; */
+	{ 122, 5, 4, { 0xf0, 0x9d, 0x92, 0x9c } }, /* Ascr; */
+	{ 15699, 7, 2, { 0xc5, 0xb1 } }, /* udblac; */
+	{ 11414, 16, 3, { 0xe2, 0x87, 0x8e } }, /* nLeftrightarrow; */
+	{ 16220, 5, 1, { 0x7c } }, /* vert; */
+	{ 0, 0, 0, { 0 } },
+	{ 15400, 5, 4, { 0xf0, 0x9d, 0x95, 0xa5 } }, /* topf; */
+	{ 5356, 5, 2, { 0xc3, 0x9b } }, /* Ucirc */
+	{ 10810, 11, 3, { 0xe2, 0x9f, 0xbc } }, /* longmapsto; */
+	{ 8567, 4, 2, { 0xc5, 0x8b } }, /* eng; */
+	{ 3060, 11, 3, { 0xe2, 0x88, 0x89 } }, /* NotElement; */
+	{ 258, 21, 3, { 0xe2, 0x85, 0x85 } }, /* CapitalDifferentialD; */
+	{ 2035, 5, 2, { 0xd0, 0xa5 } }, /* KHcy; */
+	{ 7492, 9, 3, { 0xe2, 0xa8, 0x90 } }, /* cirfnint; */
+	{ 11046, 6, 3, { 0xe2, 0x8b, 0x96 } }, /* ltdot; */
+	{ 1078, 20, 3, { 0xe2, 0xa5, 0x90 } }, /* DownLeftRightVector; */
+	{ 11313, 7, 3, { 0xe2, 0x88, 0xb8 } }, /* minusd; */
+	{ 6978, 6, 3, { 0xe2, 0x95, 0xa5 } }, /* boxhD; */
+	{ 9276, 6, 3, { 0xe2, 0xaa, 0x90 } }, /* gsiml; */
+	{ 7336, 5, 2, { 0xc2, 0xa2 } }, /* cent; */
+	{ 13039, 7, 3, { 0xe2, 0xa8, 0xa5 } }, /* plusdu; */
+	{ 15932, 6, 3, { 0xe2, 0x8b, 0xb0 } }, /* utdot; */
+	{ 14741, 6, 2, { 0xc2, 0xaf } }, /* strns; */
+	{ 0, 0, 0, { 0 } },
+	{ 16283, 7, 6, { 0xe2, 0xab, 0x8c, 0xef, 0xb8, 0x80 } }, /* vsupnE; */
+	{ 6003, 5, 2, { 0xc3, 0xa6 } }, /* aelig */
+	{ 9734, 5, 3, { 0xe2, 0x8a, 0xb7 } }, /* imof; */
+	{ 12253, 6, 3, { 0xe2, 0x8a, 0x89 } }, /* nsupe; */
+	{ 9462, 10, 3, { 0xe2, 0x99, 0xa5 } }, /* heartsuit; */
+	{ 10623, 4, 4, { 0xf0, 0x9d, 0x94, 0xa9 } }, /* lfr; */
+	{ 1556, 7, 2, { 0xc4, 0x9e } }, /* Gbreve; */
+	{ 11554, 7, 5, { 0xe2, 0x89, 0x8f, 0xcc, 0xb8 } }, /* nbumpe; */
+	{ 14927, 9, 3, { 0xe2, 0xaa, 0xb6 } }, /* succneqq; */
+	{ 4249, 3, 2, { 0xc2, 0xae } }, /* REG */
+	{ 5467, 6, 2, { 0xc5, 0xb2 } }, /* Uogon; */
+	{ 0, 0, 0, { 0 } },
+	{ 2166, 13, 3, { 0xe2, 0x87, 0xa4 } }, /* LeftArrowBar; */
+	{ 2912, 22, 3, { 0xe2, 0x80, 0x8b } }, /* NegativeVeryThinSpace; */
+	{ 12166, 8, 3, { 0xe2, 0x8b, 0xa2 } }, /* nsqsube; */
+	{ 0, 0, 0, { 0 } },
+	{ 6955, 6, 3, { 0xe2, 0x95, 0x92 } }, /* boxdR; */
+	{ 6008, 6, 2, { 0xc3, 0xa6 } }, /* aelig; */
+	{ 9177, 3, 3, { 0xe2, 0x89, 0xab } }, /* gg; */
+	{ 0, 0, 0, { 0 } },
+	{ 14658, 7, 3, { 0xe2, 0x96, 0xaa } }, /* squarf; */
+	{ 14014, 7, 3, { 0xe2, 0xa6, 0x94 } }, /* rpargt; */
+	{ 11280, 7, 3, { 0xe2, 0xab, 0xb0 } }, /* midcir; */
+	{ 14159, 4, 3, { 0xe2, 0xaa, 0xb0 } }, /* sce; */
+	{ 14236, 7, 3, { 0xe2, 0xa4, 0xa5 } }, /* searhk; */
+	{ 10231, 7, 1, { 0x5b } }, /* lbrack; */
+	{ 16551, 5, 4, { 0xf0, 0x9d, 0x93, 0x8e } }, /* yscr; */
+	{ 15225, 5, 3, { 0xe2, 0x83, 0x9b } }, /* tdot; */
+	{ 16387, 4, 4, { 0xf0, 0x9d, 0x94, 0xb5 } }, /* xfr; */
+	{ 15802, 5, 4, { 0xf0, 0x9d, 0x95, 0xa6 } }, /* uopf; */
+	{ 9210, 4, 3, { 0xe2, 0x89, 0xa9 } }, /* gnE; */
+	{ 15660, 5, 3, { 0xe2, 0x86, 0x91 } }, /* uarr; */
+	{ 15214, 7, 2, { 0xc5, 0xa3 } }, /* tcedil; */
+	{ 12952, 7, 3, { 0xe2, 0x84, 0xb3 } }, /* phmmat; */
+	{ 4779, 7, 2, { 0xd0, 0xac } }, /* SOFTcy; */
+	{ 6017, 4, 4, { 0xf0, 0x9d, 0x94, 0x9e } }, /* afr; */
+	{ 14651, 7, 3, { 0xe2, 0x96, 0xa1 } }, /* square; */
+	{ 8505, 4, 3, { 0xe2, 0x84, 0x93 } }, /* ell; */
+	{ 15202, 5, 3, { 0xe2, 0x8e, 0xb4 } }, /* tbrk; */
+	{ 8116, 14, 3, { 0xe2, 0x8b, 0x87 } }, /* divideontimes; */
+	{ 11935, 8, 3, { 0xe2, 0x8b, 0xb6 } }, /* notinvc; */
+	{ 4705, 11, 3, { 0xe2, 0x87, 0x92 } }, /* Rightarrow; */
+	{ 5827, 5, 2, { 0xd0, 0xaf } }, /* YAcy; */
+	{ 6660, 13, 3, { 0xe2, 0xa7, 0xab } }, /* blacklozenge; */
+	{ 11880, 5, 3, { 0xe2, 0x88, 0xa4 } }, /* nmid; */
+	{ 11759, 5, 3, { 0xe2, 0x8b, 0xba } }, /* nisd; */
+	{ 8860, 6, 3, { 0xef, 0xac, 0x82 } }, /* fllig; */
+	{ 5865, 4, 4, { 0xf0, 0x9d, 0x94, 0x9c } }, /* Yfr; */
+	{ 14110, 8, 3, { 0xe2, 0xa5, 0xa8 } }, /* ruluhar; */
+	{ 0, 0, 0, { 0 } },
+	{ 6842, 6, 3, { 0xe2, 0x95, 0x93 } }, /* boxDr; */
+	{ 1805, 5, 2, { 0xd0, 0x95 } }, /* IEcy; */
+	{ 7057, 6, 3, { 0xe2, 0x95, 0xaa } }, /* boxvH; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 8142, 7, 3, { 0xe2, 0x8c, 0x9e } }, /* dlcorn; */
+	{ 444, 16, 3, { 0xe2, 0x80, 0x99 } }, /* CloseCurlyQuote; */
+	{ 11830, 6, 5, { 0xe2, 0x89, 0xa6, 0xcc, 0xb8 } }, /* nleqq; */
+	{ 466, 7, 3, { 0xe2, 0xa9, 0xb4 } }, /* Colone; */
+	{ 9449, 6, 2, { 0xc4, 0xa5 } }, /* hcirc; */
+	{ 16269, 7, 6, { 0xe2, 0xab, 0x8b, 0xef, 0xb8, 0x80 } }, /* vsubnE; */
+	{ 11016, 7, 3, { 0xe2, 0x80, 0x9a } }, /* lsquor; */
+	{ 0, 0, 0, { 0 } },
+	{ 10212, 6, 3, { 0xe2, 0xa4, 0x8c } }, /* lbarr; */
+	{ 8431, 6, 2, { 0xc3, 0xaa } }, /* ecirc; */
+	{ 7998, 8, 3, { 0xe2, 0xa9, 0xb7 } }, /* ddotseq; */
+	{ 11306, 7, 3, { 0xe2, 0x8a, 0x9f } }, /* minusb; */
+	{ 0, 0, 0, { 0 } },
+	{ 11632, 8, 3, { 0xe2, 0x86, 0x97 } }, /* nearrow; */
+	{ 10147, 7, 3, { 0xe2, 0xa4, 0x9d } }, /* larrfs; */
+	{ 483, 7, 3, { 0xe2, 0x88, 0xaf } }, /* Conint; */
+	{ 0, 0, 0, { 0 } },
+	{ 294, 6, 2, { 0xc3, 0x87 } }, /* Ccedil */
+	{ 16229, 6, 3, { 0xe2, 0x8a, 0xb2 } }, /* vltri; */
+	{ 4820, 4, 4, { 0xf0, 0x9d, 0x94, 0x96 } }, /* Sfr; */
+	{ 14953, 4, 3, { 0xe2, 0x88, 0x91 } }, /* sum; */
+	{ 2262, 18, 3, { 0xe2, 0xa5, 0x99 } }, /* LeftDownVectorBar; */
+	{ 11496, 6, 5, { 0xe2, 0x89, 0x8b, 0xcc, 0xb8 } }, /* napid; */
+	{ 12174, 8, 3, { 0xe2, 0x8b, 0xa3 } }, /* nsqsupe; */
+	{ 9761, 9, 3, { 0xe2, 0xa7, 0x9d } }, /* infintie; */
+	{ 0, 0, 0, { 0 } },
+	{ 5861, 4, 2, { 0xd0, 0xab } }, /* Ycy; */
+	{ 6848, 5, 3, { 0xe2, 0x95, 0x90 } }, /* boxH; */
+	{ 14945, 8, 3, { 0xe2, 0x89, 0xbf } }, /* succsim; */
+	{ 15962, 4, 2, { 0xc3, 0xbc } }, /* uuml */
+	{ 5663, 6, 3, { 0xe2, 0x8a, 0xa9 } }, /* Vdash; */
+	{ 13937, 4, 3, { 0xe2, 0x80, 0x8f } }, /* rlm; */
+	{ 6352, 9, 3, { 0xe2, 0x88, 0xb3 } }, /* awconint; */
+	{ 4983, 20, 3, { 0xe2, 0x8a, 0x92 } }, /* SquareSupersetEqual; */
+	{ 3306, 8, 3, { 0xe2, 0x89, 0xae } }, /* NotLess; */
+	{ 12641, 6, 3, { 0xe2, 0x86, 0xba } }, /* olarr; */
+	{ 6343, 4, 2, { 0xc3, 0xa4 } }, /* auml */
+	{ 14449, 14, 3, { 0xe2, 0x88, 0x96 } }, /* smallsetminus; */
+	{ 9601, 7, 2, { 0xc3, 0xad } }, /* iacute; */
+	{ 2765, 3, 3, { 0xe2, 0x89, 0xaa } }, /* Lt; */
+	{ 4870, 13, 3, { 0xe2, 0x86, 0x91 } }, /* ShortUpArrow; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 4839, 15, 3, { 0xe2, 0x86, 0x90 } }, /* ShortLeftArrow; */
+	{ 9311, 8, 3, { 0xe2, 0xa9, 0xbc } }, /* gtquest; */
+	{ 0, 0, 0, { 0 } },
+	{ 6084, 5, 3, { 0xe2, 0xa9, 0x9c } }, /* andd; */
+	{ 9663, 3, 3, { 0xe2, 0x85, 0x88 } }, /* ii; */
+	{ 0, 0, 0, { 0 } },
+	{ 6801, 5, 4, { 0xf0, 0x9d, 0x95, 0x93 } }, /* bopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 254, 4, 3, { 0xe2, 0x8b, 0x92 } }, /* Cap; */
+	{ 0, 0, 0, { 0 } },
+	{ 11152, 5, 3, { 0xe2, 0x99, 0x82 } }, /* male; */
+	{ 12765, 5, 2, { 0xc2, 0xba } }, /* ordm; */
+	{ 0, 0, 0, { 0 } },
+	{ 16609, 5, 2, { 0xd0, 0xb6 } }, /* zhcy; */
+	{ 10252, 8, 3, { 0xe2, 0xa6, 0x8d } }, /* lbrkslu; */
+	{ 11897, 6, 3, { 0xe2, 0x88, 0x89 } }, /* notin; */
+	{ 16247, 5, 4, { 0xf0, 0x9d, 0x95, 0xa7 } }, /* vopf; */
+	{ 9879, 8, 3, { 0xe2, 0x8b, 0xb5 } }, /* isindot; */
+	{ 13521, 7, 3, { 0xe2, 0xa5, 0x85 } }, /* rarrpl; */
+	{ 11005, 5, 1, { 0x5b } }, /* lsqb; */
+	{ 9486, 4, 4, { 0xf0, 0x9d, 0x94, 0xa5 } }, /* hfr; */
+	{ 15653, 7, 2, { 0xc3, 0xba } }, /* uacute; */
+	{ 6889, 6, 3, { 0xe2, 0x95, 0x9c } }, /* boxUl; */
+	{ 1528, 5, 3, { 0xe2, 0x84, 0xb1 } }, /* Fscr; */
+	{ 10564, 8, 3, { 0xe2, 0x8b, 0x96 } }, /* lessdot; */
+	{ 3456, 22, 3, { 0xe2, 0x8b, 0xa0 } }, /* NotPrecedesSlantEqual; */
+	{ 8163, 5, 4, { 0xf0, 0x9d, 0x95, 0x95 } }, /* dopf; */
+	{ 866, 14, 3, { 0xe2, 0xab, 0xa4 } }, /* DoubleLeftTee; */
+	{ 3658, 12, 3, { 0xe2, 0x8a, 0x81 } }, /* NotSucceeds; */
+	{ 13777, 15, 3, { 0xe2, 0x86, 0xa3 } }, /* rightarrowtail; */
+	{ 13824, 16, 3, { 0xe2, 0x87, 0x84 } }, /* rightleftarrows; */
+	{ 13473, 7, 3, { 0xe2, 0xa5, 0xb5 } }, /* rarrap; */
+	{ 8990, 7, 3, { 0xe2, 0x85, 0x97 } }, /* frac35; */
+	{ 3439, 17, 5, { 0xe2, 0xaa, 0xaf, 0xcc, 0xb8 } }, /* NotPrecedesEqual; */
+	{ 10664, 3, 3, { 0xe2, 0x89, 0xaa } }, /* ll; */
+	{ 15647, 6, 2, { 0xc3, 0xba } }, /* uacute */
+	{ 2135, 4, 2, { 0xd0, 0x9b } }, /* Lcy; */
+	{ 7639, 7, 3, { 0xe2, 0x84, 0x97 } }, /* copysr; */
+	{ 4854, 16, 3, { 0xe2, 0x86, 0x92 } }, /* ShortRightArrow; */
+	{ 5090, 14, 3, { 0xe2, 0x89, 0xbf } }, /* SucceedsTilde; */
+	{ 3965, 3, 3, { 0xe2, 0xa9, 0x94 } }, /* Or; */
+	{ 10883, 8, 3, { 0xe2, 0xa8, 0xb4 } }, /* lotimes; */
+	{ 9719, 9, 3, { 0xe2, 0x84, 0x91 } }, /* imagpart; */
+	{ 15301, 7, 3, { 0xe2, 0x80, 0x89 } }, /* thinsp; */
+	{ 15180, 5, 2, { 0xc3, 0x9f } }, /* szlig */
+	{ 6060, 6, 3, { 0xe2, 0xa8, 0xbf } }, /* amalg; */
+	{ 4233, 5, 3, { 0xe2, 0x84, 0x9a } }, /* Qopf; */
+	{ 4721, 13, 3, { 0xe2, 0xa5, 0xb0 } }, /* RoundImplies; */
+	{ 14688, 7, 3, { 0xe2, 0x8c, 0xa3 } }, /* ssmile; */
+	{ 11081, 7, 3, { 0xe2, 0xa6, 0x96 } }, /* ltrPar; */
+	{ 14224, 6, 3, { 0xe2, 0xa9, 0xa6 } }, /* sdote; */
+	{ 7992, 6, 3, { 0xe2, 0x87, 0x8a } }, /* ddarr; */
+	{ 9038, 6, 3, { 0xe2, 0x8c, 0xa2 } }, /* frown; */
+	{ 10117, 5, 2, { 0xc2, 0xab } }, /* laquo */
+	{ 201, 5, 2, { 0xce, 0x92 } }, /* Beta; */
+	{ 14975, 5, 2, { 0xc2, 0xb2 } }, /* sup2; */
+	{ 6301, 6, 2, { 0xc3, 0xa5 } }, /* aring; */
+	{ 5639, 4, 2, { 0xc3, 0x9c } }, /* Uuml */
+	{ 7087, 6, 3, { 0xe2, 0x94, 0x9c } }, /* boxvr; */
+	{ 326, 8, 2, { 0xc2, 0xb8 } }, /* Cedilla; */
+	{ 12691, 5, 3, { 0xe2, 0xa6, 0xb6 } }, /* omid; */
+	{ 10940, 9, 3, { 0xe2, 0x8c, 0x9f } }, /* lrcorner; */
+	{ 2844, 7, 2, { 0xc5, 0x85 } }, /* Ncedil; */
+	{ 15085, 9, 3, { 0xe2, 0x8a, 0x87 } }, /* supseteq; */
+	{ 3897, 7, 2, { 0xc3, 0x92 } }, /* Ograve; */
+	{ 9704, 6, 3, { 0xe2, 0x84, 0x91 } }, /* image; */
+	{ 15314, 7, 3, { 0xe2, 0x88, 0xbc } }, /* thksim; */
+	{ 2029, 6, 2, { 0xd0, 0x84 } }, /* Jukcy; */
+	{ 15005, 8, 3, { 0xe2, 0xab, 0x98 } }, /* supdsub; */
+	{ 12502, 8, 3, { 0xe2, 0x86, 0x96 } }, /* nwarrow; */
+	{ 2500, 15, 3, { 0xe2, 0x87, 0x94 } }, /* Leftrightarrow; */
+	{ 16241, 6, 6, { 0xe2, 0x8a, 0x83, 0xe2, 0x83, 0x92 } }, /* vnsup; */
+	{ 0, 0, 0, { 0 } },
+	{ 6481, 8, 3, { 0xe2, 0x88, 0xb5 } }, /* because; */
+	{ 6316, 6, 3, { 0xe2, 0x89, 0x88 } }, /* asymp; */
+	{ 10002, 7, 2, { 0xc4, 0xb8 } }, /* kgreen; */
+	{ 9887, 6, 3, { 0xe2, 0x8b, 0xb4 } }, /* isins; */
+	{ 12901, 4, 2, { 0xd0, 0xbf } }, /* pcy; */
+	{ 13004, 5, 1, { 0x2b } }, /* plus; */
+	{ 10673, 9, 3, { 0xe2, 0x8c, 0x9e } }, /* llcorner; */
+	{ 8320, 5, 3, { 0xe2, 0xa7, 0xb6 } }, /* dsol; */
+	{ 0, 0, 0, { 0 } },
+	{ 14443, 6, 3, { 0xe2, 0x86, 0x90 } }, /* slarr; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 8355, 6, 3, { 0xe2, 0xa5, 0xaf } }, /* duhar; */
+	{ 7806, 12, 3, { 0xe2, 0x8b, 0x9f } }, /* curlyeqsucc; */
+	{ 9521, 14, 3, { 0xe2, 0x86, 0xa9 } }, /* hookleftarrow; */
+	{ 12228, 6, 3, { 0xe2, 0x8a, 0x81 } }, /* nsucc; */
+	{ 1184, 19, 3, { 0xe2, 0xa5, 0x97 } }, /* DownRightVectorBar; */
+	{ 7508, 8, 3, { 0xe2, 0xa7, 0x82 } }, /* cirscir; */
+	{ 11626, 6, 3, { 0xe2, 0x86, 0x97 } }, /* nearr; */
+	{ 14859, 7, 3, { 0xe2, 0xab, 0x87 } }, /* subsim; */
+	{ 4211, 5, 4, { 0xf0, 0x9d, 0x92, 0xab } }, /* Pscr; */
+	{ 10386, 15, 3, { 0xe2, 0x87, 0x87 } }, /* leftleftarrows; */
+	{ 14620, 7, 3, { 0xe2, 0x8a, 0x92 } }, /* sqsupe; */
+	{ 12869, 5, 2, { 0xc2, 0xb6 } }, /* para; */
+	{ 1168, 16, 3, { 0xe2, 0x87, 0x81 } }, /* DownRightVector; */
+	{ 5969, 4, 5, { 0xe2, 0x88, 0xbe, 0xcc, 0xb3 } }, /* acE; */
+	{ 12496, 6, 3, { 0xe2, 0x86, 0x96 } }, /* nwarr; */
+	{ 15050, 8, 3, { 0xe2, 0xab, 0x82 } }, /* supmult; */
+	{ 1871, 3, 3, { 0xe2, 0x84, 0x91 } }, /* Im; */
+	{ 14036, 7, 3, { 0xe2, 0x80, 0xba } }, /* rsaquo; */
+	{ 12058, 7, 5, { 0xe2, 0x86, 0x9d, 0xcc, 0xb8 } }, /* nrarrw; */
+	{ 0, 0, 0, { 0 } },
+	{ 13368, 4, 1, { 0x22 } }, /* quot */
+	{ 10324, 5, 3, { 0xe2, 0x86, 0xb2 } }, /* ldsh; */
+	{ 9581, 7, 3, { 0xe2, 0x81, 0x83 } }, /* hybull; */
+	{ 7046, 6, 3, { 0xe2, 0x94, 0x94 } }, /* boxur; */
+	{ 11032, 3, 1, { 0x3c } }, /* lt; */
+	{ 8063, 12, 3, { 0xe2, 0x99, 0xa6 } }, /* diamondsuit; */
+	{ 14494, 5, 3, { 0xe2, 0xaa, 0xac } }, /* smte; */
+	{ 1782, 13, 3, { 0xe2, 0x89, 0x8e } }, /* HumpDownHump; */
+	{ 15521, 7, 3, { 0xe2, 0x97, 0xac } }, /* tridot; */
+	{ 10646, 7, 3, { 0xe2, 0xa5, 0xaa } }, /* lharul; */
+	{ 12288, 5, 3, { 0xe2, 0x89, 0xb9 } }, /* ntgl; */
+	{ 4427, 13, 3, { 0xe2, 0x8c, 0x89 } }, /* RightCeiling; */
+	{ 1733, 4, 3, { 0xe2, 0x84, 0x8c } }, /* Hfr; */
+	{ 4198, 13, 3, { 0xe2, 0x88, 0x9d } }, /* Proportional; */
+	{ 8737, 3, 2, { 0xc3, 0xb0 } }, /* eth */
+	{ 15678, 5, 2, { 0xc3, 0xbb } }, /* ucirc */
+	{ 0, 0, 0, { 0 } },
+	{ 13757, 4, 2, { 0xcf, 0x81 } }, /* rho; */
+	{ 11360, 5, 4, { 0xf0, 0x9d, 0x93, 0x82 } }, /* mscr; */
+	{ 5874, 5, 4, { 0xf0, 0x9d, 0x92, 0xb4 } }, /* Yscr; */
+	{ 14587, 7, 3, { 0xe2, 0x8a, 0x91 } }, /* sqsube; */
+	{ 13941, 7, 3, { 0xe2, 0x8e, 0xb1 } }, /* rmoust; */
+	{ 7570, 7, 3, { 0xe2, 0x88, 0x98 } }, /* compfn; */
+	{ 12051, 7, 5, { 0xe2, 0xa4, 0xb3, 0xcc, 0xb8 } }, /* nrarrc; */
+	{ 553, 6, 3, { 0xe2, 0xa8, 0xaf } }, /* Cross; */
+	{ 13346, 8, 3, { 0xe2, 0xa8, 0x96 } }, /* quatint; */
+	{ 0, 0, 0, { 0 } },
+	{ 9595, 6, 2, { 0xc3, 0xad } }, /* iacute */
+	{ 2229, 18, 3, { 0xe2, 0xa5, 0xa1 } }, /* LeftDownTeeVector; */
+	{ 12855, 6, 3, { 0xe2, 0x8c, 0xbd } }, /* ovbar; */
+	{ 6760, 6, 3, { 0xe2, 0x96, 0x92 } }, /* blk12; */
+	{ 10729, 9, 3, { 0xe2, 0xaa, 0x89 } }, /* lnapprox; */
+	{ 4824, 15, 3, { 0xe2, 0x86, 0x93 } }, /* ShortDownArrow; */
+	{ 8214, 15, 3, { 0xe2, 0x8c, 0x86 } }, /* doublebarwedge; */
+	{ 8882, 7, 3, { 0xe2, 0x88, 0x80 } }, /* forall; */
+	{ 8812, 7, 3, { 0xe2, 0x99, 0x80 } }, /* female; */
+	{ 13486, 8, 3, { 0xe2, 0xa4, 0xa0 } }, /* rarrbfs; */
+	{ 9137, 7, 3, { 0xe2, 0xaa, 0x80 } }, /* gesdot; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 7130, 5, 3, { 0xe2, 0x88, 0xbd } }, /* bsim; */
+	{ 6287, 9, 3, { 0xe2, 0x89, 0x8a } }, /* approxeq; */
+	{ 2978, 4, 4, { 0xf0, 0x9d, 0x94, 0x91 } }, /* Nfr; */
+	{ 8130, 7, 3, { 0xe2, 0x8b, 0x87 } }, /* divonx; */
+	{ 12141, 6, 3, { 0xe2, 0x89, 0x84 } }, /* nsime; */
+	{ 9873, 6, 3, { 0xe2, 0x8b, 0xb9 } }, /* isinE; */
+	{ 8019, 8, 3, { 0xe2, 0xa6, 0xb1 } }, /* demptyv; */
+	{ 11482, 5, 6, { 0xe2, 0x88, 0xa0, 0xe2, 0x83, 0x92 } }, /* nang; */
+	{ 5903, 4, 2, { 0xd0, 0x97 } }, /* Zcy; */
+	{ 8044, 6, 3, { 0xe2, 0x87, 0x82 } }, /* dharr; */
+	{ 5993, 6, 2, { 0xc2, 0xb4 } }, /* acute; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 11487, 4, 3, { 0xe2, 0x89, 0x89 } }, /* nap; */
+	{ 31, 7, 2, { 0xc4, 0x82 } }, /* Abreve; */
+	{ 4006, 4, 2, { 0xc3, 0x96 } }, /* Ouml */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 15723, 6, 2, { 0xc3, 0xb9 } }, /* ugrave */
+	{ 15139, 7, 3, { 0xe2, 0xab, 0x96 } }, /* supsup; */
+	{ 15789, 3, 2, { 0xc2, 0xa8 } }, /* uml */
+	{ 5294, 10, 3, { 0xe2, 0x83, 0x9b } }, /* TripleDot; */
+	{ 14763, 5, 3, { 0xe2, 0x8a, 0x86 } }, /* sube; */
+	{ 13931, 6, 3, { 0xe2, 0x87, 0x8c } }, /* rlhar; */
+	{ 772, 9, 3, { 0xe2, 0x89, 0x90 } }, /* DotEqual; */
+	{ 16406, 6, 3, { 0xe2, 0x9f, 0xb8 } }, /* xlArr; */
+	{ 8769, 12, 3, { 0xe2, 0x84, 0xb0 } }, /* expectation; */
+	{ 9692, 6, 2, { 0xc4, 0xb3 } }, /* ijlig; */
+	{ 12661, 6, 3, { 0xe2, 0x80, 0xbe } }, /* oline; */
+	{ 10035, 5, 3, { 0xe2, 0x87, 0x90 } }, /* lArr; */
+	{ 13084, 9, 3, { 0xe2, 0xa8, 0x95 } }, /* pointint; */
+	{ 2121, 7, 2, { 0xc4, 0xbd } }, /* Lcaron; */
+	{ 15689, 4, 2, { 0xd1, 0x83 } }, /* ucy; */
+	{ 12101, 5, 5, { 0xe2, 0xaa, 0xb0, 0xcc, 0xb8 } }, /* nsce; */
+	{ 7112, 7, 2, { 0xc2, 0xa6 } }, /* brvbar; */
+	{ 0, 0, 0, { 0 } },
+	{ 11030, 2, 1, { 0x3c } }, /* lt */
+	{ 8582, 5, 4, { 0xf0, 0x9d, 0x95, 0x96 } }, /* eopf; */
+	{ 0, 0, 0, { 0 } },
+	{ 5735, 14, 3, { 0xe2, 0x89, 0x80 } }, /* VerticalTilde; */
+	{ 12947, 5, 2, { 0xcf, 0x95 } }, /* phiv; */
+	{ 0, 0, 0, { 0 } },
+	{ 13406, 5, 5, { 0xe2, 0x88, 0xbd, 0xcc, 0xb1 } }, /* race; */
+	{ 9161, 5, 6, { 0xe2, 0x8b, 0x9b, 0xef, 0xb8, 0x80 } }, /* gesl; */
+	{ 6772, 6, 3, { 0xe2, 0x96, 0x93 } }, /* blk34; */
+	{ 15152, 7, 3, { 0xe2, 0xa4, 0xa6 } }, /* swarhk; */
+	{ 9190, 5, 2, { 0xd1, 0x93 } }, /* gjcy; */
+	{ 14980, 4, 2, { 0xc2, 0xb3 } }, /* sup3 */
+	{ 5959, 7, 2, { 0xc4, 0x83 } }, /* abreve; */
+	{ 0, 0, 0, { 0 } },
+	{ 7598, 5, 3, { 0xe2, 0x89, 0x85 } }, /* cong; */
+	{ 7691, 8, 3, { 0xe2, 0xa4, 0xb8 } }, /* cudarrl; */
+	{ 12299, 7, 2, { 0xc3, 0xb1 } }, /* ntilde; */
+	{ 3973, 6, 2, { 0xc3, 0x98 } }, /* Oslash */
+	{ 6054, 6, 2, { 0xc4, 0x81 } }, /* amacr; */
+	{ 9069, 7, 2, { 0xcf, 0x9d } }, /* gammad; */
+	{ 14415, 6, 3, { 0xe2, 0xaa, 0x9f } }, /* simlE; */
+	{ 13377, 6, 3, { 0xe2, 0x87, 0x9b } }, /* rAarr; */
+	{ 15908, 7, 3, { 0xe2, 0x8c, 0x8e } }, /* urcrop; */
+	{ 15971, 8, 3, { 0xe2, 0xa6, 0xa7 } }, /* uwangle; */
+	{ 7011, 8, 3, { 0xe2, 0x8a, 0x9e } }, /* boxplus; */
+	{ 0, 0, 0, { 0 } },
+	{ 0, 0, 0, { 0 } },
+	{ 2116, 5, 3, { 0xe2, 0x86, 0x9e } }, /* Larr; */
+	{ 13249, 9, 3, { 0xe2, 0x8c, 0x92 } }, /* profline; */
+	{ 1717, 6, 2, { 0xcb, 0x87 } }, /* Hacek; */
+	{ 3131, 20, 5, { 0xe2, 0x89, 0xa7, 0xcc, 0xb8 } }, /* NotGreaterFullEqual; */
+	{ 2022, 7, 2, { 0xd0, 0x88 } }, /* Jsercy; */
+	{ 5704, 13, 1, { 0x7c } }, /* VerticalLine; */
+	{ 6330, 6, 2, { 0xc3, 0xa3 } }, /* atilde */
+	{ 11254, 4, 3, { 0xe2, 0x84, 0xa7 } }, /* mho; */
+	{ 13228, 7, 3, { 0xe2, 0x8b, 0xa8 } }, /* prnsim; */
+	{ 15264, 9, 2, { 0xcf, 0x91 } }, /* thetasym; */
+	{ 7124, 6, 3, { 0xe2, 0x81, 0x8f } }, /* bsemi; */
+	{ 15207, 7, 2, { 0xc5, 0xa5 } }, /* tcaron; */
+	{ 6984, 6, 3, { 0xe2, 0x95, 0xa8 } }, /* boxhU; */
+	{ 10224, 7, 1, { 0x7b } }, /* lbrace; */
+	{ 14, 4, 1, { 0x26 } }, /* AMP; */
+	{ 11548, 6, 5, { 0xe2, 0x89, 0x8e, 0xcc, 0xb8 } }, /* nbump; */
+	{ 16353, 7, 3, { 0xe2, 0x89, 0x80 } }, /* wreath; */
+	{ 4078, 4, 2, { 0xce, 0xa6 } }, /* Phi; */
+	{ 7779, 7, 3, { 0xe2, 0x86, 0xb7 } }, /* curarr; */
+	{ 12538, 5, 3, { 0xe2, 0x8a, 0x9a } }, /* ocir; */
+	{ 4690, 15, 3, { 0xe2, 0xa5, 0x93 } }, /* RightVectorBar; */
+	{ 0, 0, 0, { 0 } },
+	{ 10905, 4, 3, { 0xe2, 0x97, 0x8a } }, /* loz; */
+	{ 6532, 7, 3, { 0xe2, 0x8b, 0x82 } }, /* bigcap; */
+	{ 15899, 9, 3, { 0xe2, 0x8c, 0x9d } }, /* urcorner; */
+	{ 13178, 9, 3, { 0xe2, 0xaa, 0xb5 } }, /* precneqq; */
+	{ 13907, 5, 2, { 0xcb, 0x9a } }, /* ring; */
+	{ 15777, 6, 3, { 0xe2, 0x97, 0xb8 } }, /* ultri; */
+	{ 6924, 6, 3, { 0xe2, 0x95, 0xab } }, /* boxVh; */
+	{ 2342, 14, 3, { 0xe2, 0xa5, 0x9a } }, /* LeftTeeVector; */
+	{ 9535, 15, 3, { 0xe2, 0x86, 0xaa } }, /* hookrightarrow; */
+	{ 14209, 4, 2, { 0xd1, 0x81 } }, /* scy; */
+	{ 8740, 4, 2, { 0xc3, 0xb0 } }, /* eth; */
+	{ 12770, 7, 3, { 0xe2, 0x8a, 0xb6 } }, /* origof; */
+	{ 13983, 6, 3, { 0xe2, 0xa6, 0x86 } }, /* ropar; */
+	{ 14249, 8, 3, { 0xe2, 0x86, 0x98 } }, /* searrow; */
+	{ 14747, 4, 3, { 0xe2, 0x8a, 0x82 } }, /* sub; */
+	{ 490, 16, 3, { 0xe2, 0x88, 0xae } }, /* ContourIntegral; */
+	{ 1391, 11, 3, { 0xe2, 0x89, 0x82 } }, /* EqualTilde; */
+	{ 9770, 7, 2, { 0xc4, 0xb1 } }, /* inodot; */
+	{ 6042, 6, 3, { 0xe2, 0x84, 0xb5 } }, /* aleph; */
+	{ 5659, 4, 2, { 0xd0, 0x92 } }, /* Vcy; */
+	{ 12393, 7, 3, { 0xe2, 0x8a, 0xad } }, /* nvDash; */
+	{ 12121, 15, 3, { 0xe2, 0x88, 0xa6 } }, /* nshortparallel; */
+	{ 11469, 6, 3, { 0xe2, 0x88, 0x87 } }, /* nabla; */
+	{ 12790, 4, 3, { 0xe2, 0xa9, 0x9b } }, /* orv; */
+	{ 992, 18, 3, { 0xe2, 0x87, 0x95 } }, /* DoubleUpDownArrow; */
+	{ 13065, 8, 3, { 0xe2, 0xa8, 0xa6 } }, /* plussim; */
+	{ 12147, 7, 3, { 0xe2, 0x89, 0x84 } }, /* nsimeq; */
+	{ 14084, 5, 3, { 0xe2, 0x96, 0xb9 } }, /* rtri; */
+	{ 8493, 3, 3, { 0xe2, 0xaa, 0x99 } }, /* el; */
+	{ 16459, 6, 3, { 0xe2, 0x9f, 0xb6 } }, /* xrarr; */
+	{ 13875, 16, 3, { 0xe2, 0x86, 0x9d } }, /* rightsquigarrow; */
+	{ 13267, 5, 3, { 0xe2, 0x88, 0x9d } }, /* prop; */
+	{ 12622, 4, 3, { 0xe2, 0xa7, 0x81 } }, /* ogt; */
+	{ 14287, 6, 3, { 0xe2, 0x88, 0x96 } }, /* setmn; */
+	{ 14009, 5, 1, { 0x29 } }, /* rpar; */
+	{ 13977, 6, 3, { 0xe2, 0x9f, 0xa7 } }, /* robrk; */
+	{ 14521, 7, 3, { 0xe2, 0x8c, 0xbf } }, /* solbar; */
+	{ 13450, 7, 3, { 0xe2, 0x9f, 0xa9 } }, /* rangle; */
+	{ 10653, 6, 3, { 0xe2, 0x96, 0x84 } }, /* lhblk; */
+};
+
+#endif
@@ -0,0 +1,332 @@
+/* Ruby's config defines _GNU_SOURCE, which fcntl.h needs for posix_fadvise. */
+#include "ruby.h"
+#include "ruby/encoding.h"
+#include "ruby/io.h"
+#include "ruby/thread.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "escapefile.h"
+#include "hescape.h"
+#include "stats.h"
+
+/*
+ * Bytes of input escaped at a time. The output buffer is large enough for the
+ * worst case, where every byte is escaped to six.
+ */
+#define ESCAPEFILE_CHUNK (64 * 1024)
+
+/*
+ * Windows translates CRLF and stops at ^Z when reading descriptors that aren't
+ * opened in binary mode. It's zero elsewhere, like in Ruby's own io.c.
+ */
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+typedef struct {
+	int input;
+	int output;
+	bool close_output;
+	uint8_t *in;
+	uint8_t *out;
+	size_t pending;
+	size_t offset;
+	size_t read;
+	size_t written;
+	bool done;
+	bool blocked;
+	int error;
+	bool writing;
+	VALUE source;
+	VALUE destination;
+} escapefile_state;
+
+/*
+ * Copy from the input to the output descriptor, escaping each chunk on the
+ * way. Called without the GVL, and returns early on EINTR so the caller can
+ * check for interrupts and call it again to pick up where it left off, or when
+ * a non-blocking output, like a pipe from IO.pipe, is full.
+ */
+static void * escapefile_copy(void *arg) {
+	escapefile_state *state = arg;
+
+	for (;;) {
+		while (state->pending > 0) {
+			ssize_t count = write(state->output, state->out + state->offset, state->pending);
+
+			if (count < 0) {
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					state->blocked = true;
+				} else if (errno != EINTR) {
+					state->error = errno;
+					state->writing = true;
+				}
+
+				return NULL;
+			}
+
+			state->offset += count;
+			state->pending -= count;
+			state->written += count;
+		}
+
+		ssize_t count = read(state->input, state->in, ESCAPEFILE_CHUNK);
+
+		if (count < 0) {
+			if (errno != EINTR) {
+				state->error = errno;
+			}
+
+			return NULL;
+		}
+
+		if (count == 0) {
+			state->done = true;
+			return NULL;
+		}
+
+		state->read += count;
+		state->pending = hesc_escape_html_into(state->out, state->in, count);
+		state->offset = 0;
+	}
+}
+
+static VALUE escapefile_body(VALUE arg) {
+	escapefile_state *state = (escapefile_state *) arg;
+
+	while (!state->done && state->error == 0) {
+		rb_thread_call_without_gvl(escapefile_copy, state, RUBY_UBF_IO, NULL);
+		rb_thread_check_ints();
+
+		if (state->blocked) {
+			rb_thread_fd_writable(state->output);
+			state->blocked = false;
+		}
+	}
+
+	if (state->error != 0) {
+		rb_syserr_fail_str(state->error, state->writing ? state->destination : state->source);
+	}
+
+	return Qnil;
+}
+
+static VALUE escapefile_cleanup(VALUE arg) {
+	escapefile_state *state = (escapefile_state *) arg;
+
+	close(state->input);
+
+	if (state->close_output && state->output >= 0) {
+		close(state->output);
+	}
+
+	xfree(state->in);
+	xfree(state->out);
+
+	return Qnil;
+}
+
+/*
+ * Escape from a readable IO to a writable one, which can be anything with
+ * compatible #read and #write methods, a chunk at a time. The IO releases the
+ * GVL while it waits on reads and writes.
+ */
+static VALUE escapefile_stream(VALUE input, VALUE output) {
+	ID read = rb_intern("read");
+	ID write = rb_intern("write");
+	VALUE buffer = rb_str_buf_new(ESCAPEFILE_CHUNK);
+	VALUE size = INT2FIX(ESCAPEFILE_CHUNK);
+	size_t total_in = 0;
+	size_t total_out = 0;
+
+	for (;;) {
+		/*
+		 * Readers like IO fill the buffer and return it, but others may ignore it
+		 * and return a string of their own, so only the return value counts.
+		 * Reading with a size returns nil at the end, though some readers return
+		 * an empty string instead.
+		 */
+		VALUE chunk = rb_funcall(input, read, 2, size, buffer);
+
+		if (NIL_P(chunk)) {
+			break;
+		}
+
+		Check_Type(chunk, T_STRING);
+
+		size_t slen = RSTRING_LEN(chunk);
+
+		if (slen == 0) {
+			break;
+		}
+
+		/*
+		 * Each chunk is written as a new frozen string, since writers like an
+		 * Array or a queue keep what they're given rather than copying it.
+		 */
+		const uint8_t *src = (const uint8_t *) RSTRING_PTR(chunk);
+		size_t esclen = hesc_escaped_size(src, slen);
+		VALUE escaped = rb_utf8_str_new(NULL, esclen);
+
+		hesc_escape_html_into((uint8_t *) RSTRING_PTR(escaped), src, slen);
+		RB_GC_GUARD(chunk);
+		rb_funcall(output, write, 1, rb_obj_freeze(escaped));
+
+		total_in += slen;
+		total_out += esclen;
+	}
+
+	RB_GC_GUARD(buffer);
+	STATS_RECORD("escape_stream", total_in, total_out);
+
+	return SIZET2NUM(total_out);
+}
+
+/*
+ * The external API for Berns.escape_stream.
+ *
+ * Escape everything read from input, like an IO or StringIO, and write it to
+ * output. Returns the number of bytes written.
+ *
+ */
+static VALUE external_escape_stream(RB_UNUSED_VAR(VALUE self), VALUE input, VALUE output) {
+	return escapefile_stream(input, output);
+}
+
+/*
+ * Whether writing to io's descriptor directly writes the same bytes as its
+ * #write method would, i.e. it neither transcodes UTF-8 nor converts newlines.
+ * On Windows that takes binary mode, since text mode converts newlines.
+ */
+static bool escapefile_writes_raw(VALUE io) {
+	rb_io_t *fptr;
+
+	GetOpenFile(io, fptr);
+
+	if (fptr->encs.ecflags & ECONV_DECORATOR_MASK) {
+		return false;
+	}
+
+	VALUE external = rb_funcall(io, rb_intern("external_encoding"), 0);
+
+	if (!NIL_P(external)) {
+		int encindex = rb_to_encoding_index(external);
+
+		if (encindex != rb_utf8_encindex() && encindex != rb_ascii8bit_encindex()) {
+			return false;
+		}
+	}
+
+#ifdef _WIN32
+	return RTEST(rb_funcall(io, rb_intern("binmode?"), 0));
+#else
+	return true;
+#endif
+}
+
+static VALUE escapefile_stream_file(VALUE file) {
+	VALUE *arguments = (VALUE *) file;
+
+	return escapefile_stream(arguments[0], arguments[1]);
+}
+
+static VALUE escapefile_close(VALUE file) {
+	return rb_io_close(((VALUE *) file)[0]);
+}
+
+/*
+ * The external API for Berns.escape_file.
+ *
+ * Escape the file at the input path and write it to output, which can be a
+ * path, which is created or truncated, or an IO, which is written to from its
+ * current position. Returns the number of bytes written.
+ *
+ * When the output is a path or an IO with a file descriptor that doesn't
+ * convert encodings or newlines, the whole copy runs without the GVL, reading
+ * and writing the descriptors directly through fixed-size buffers. Anything
+ * else, like a StringIO or an IO opened with "w:UTF-16LE", is written to with
+ * #write a chunk at a time.
+ *
+ */
+static VALUE external_escape_file(RB_UNUSED_VAR(VALUE self), VALUE input, VALUE output) {
+	VALUE source = rb_get_path(input);
+	VALUE io = rb_io_check_io(output);
+	escapefile_state state = { 0 };
+
+	state.source = source;
+	state.output = -1;
+
+	bool direct = NIL_P(io) ? RB_TYPE_P(output, T_STRING) || rb_respond_to(output, rb_intern("to_path")) : escapefile_writes_raw(io);
+
+	if (!direct) {
+		VALUE arguments[2] = { rb_file_open_str(source, "rb"), output };
+
+		return rb_ensure(escapefile_stream_file, (VALUE) arguments, escapefile_close, (VALUE) arguments);
+	}
+
+	if (!NIL_P(io)) {
+		rb_io_flush(io);
+		state.output = NUM2INT(rb_funcall(io, rb_intern("fileno"), 0));
+		state.destination = rb_inspect(io);
+	} else {
+		state.destination = rb_get_path(output);
+	}
+
+	state.input = rb_cloexec_open(StringValueCStr(source), O_RDONLY | O_BINARY, 0);
+
+	if (state.input < 0) {
+		rb_sys_fail_str(source);
+	}
+
+	rb_update_max_fd(state.input);
+
+	/*
+	 * Escaping a file onto itself would truncate it before it's read, or read
+	 * back what we'd just written.
+	 */
+	struct stat from;
+	struct stat to;
+	bool exists = state.output >= 0 ? fstat(state.output, &to) == 0 : stat(StringValueCStr(state.destination), &to) == 0;
+
+	if (fstat(state.input, &from) == 0 && exists && S_ISREG(from.st_mode) && from.st_dev == to.st_dev && from.st_ino == to.st_ino) {
+		close(state.input);
+		rb_raise(rb_eArgError, "Berns.escape_file input and output are the same file: %"PRIsVALUE, source);
+	}
+
+	if (state.output < 0) {
+		state.output = rb_cloexec_open(StringValueCStr(state.destination), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
+
+		if (state.output < 0) {
+			int error = errno;
+
+			close(state.input);
+			rb_syserr_fail_str(error, state.destination);
+		}
+
+		rb_update_max_fd(state.output);
+		state.close_output = true;
+	}
+
+#ifdef HAVE_POSIX_FADVISE
+	posix_fadvise(state.input, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+	state.in = ALLOC_N(uint8_t, ESCAPEFILE_CHUNK);
+	state.out = ALLOC_N(uint8_t, ESCAPEFILE_CHUNK * HESC_MAX_GROWTH);
+
+	rb_ensure(escapefile_body, (VALUE) &state, escapefile_cleanup, (VALUE) &state);
+
+	STATS_RECORD("escape_file", state.read, state.written);
+
+	return SIZET2NUM(state.written);
+}
+
+void escapefile_define(VALUE module) {
+	rb_define_singleton_method(module, "escape_file", external_escape_file, 2);
+	rb_define_singleton_method(module, "escape_stream", external_escape_stream, 2);
+}
@@ -0,0 +1,13 @@
+#ifndef ESCAPEFILE_H
+#define ESCAPEFILE_H
+
+#include "ruby.h"
+
+/*
+ * Define Berns.escape_file and Berns.escape_stream on the given module. Both
+ * escape their input in fixed-size chunks, so memory use doesn't depend on how
+ * large the input is.
+ */
+extern void escapefile_define(VALUE module);
+
+#endif
@@ -1,4 +1,5 @@
 # frozen_string_literal: true
+require 'fileutils'
 require 'mkmf'
 
 dir_config 'berns'
@@ -16,4 +17,67 @@ if enable_config('march-tune-native', true)
   append_cflags '-mtune=native'
 end
 
+# Static tracepoints for bpftrace and friends, see benchmarks/berns.bt. They're
+# nops until traced, but can be left out entirely with --disable-probes.
+have_header('sys/sdt.h') if enable_config('probes', true)
+
+# Count calls and bytes through each method for Berns.stats, which otherwise
+# returns nil. Off by default so the counters cost nothing unless asked for.
+$defs << '-DBERNS_STATS' if enable_config('stats', false) # rubocop:disable Style/GlobalVars
+
+# Profile-guided optimization. With --enable-pgo we configure and build an
+# instrumented copy of the extension in this same directory, run the training
+# workload in benchmarks/pgo.rb against it, and then configure the real build to
+# use the profile it wrote. Building in the same directory matters because GCC
+# matches profiles to object files by path.
+#
+# Both steps can also be run by hand with --with-pgo-generate=DIR and
+# --with-pgo-use=DIR.
+clang = macro_defined?('__clang__', '')
+profile_use = with_config('pgo-use')
+
+if (profile = with_config('pgo-generate'))
+  append_cflags "-fprofile-generate=#{ profile }"
+  $LDFLAGS << " -fprofile-generate=#{ profile }" # rubocop:disable Style/GlobalVars
+elsif enable_config('pgo', false) && !profile_use
+  profile = File.expand_path('pgo', Dir.pwd)
+  workload = File.expand_path('../../benchmarks/pgo.rb', __dir__)
+  lib = File.expand_path('../../lib', __dir__)
+  make = ENV.fetch('MAKE', 'make')
+  arguments = ARGV.reject { |argument| argument.start_with?('--enable-pgo') }
+
+  FileUtils.rm_rf(profile)
+  FileUtils.mkdir_p(File.join(profile, 'lib', 'berns'))
+
+  message "building an instrumented extension to profile in #{ profile }\n"
+
+  trained = system(RbConfig.ruby, __FILE__, "--with-pgo-generate=#{ profile }", *arguments) && system(make)
+
+  if trained
+    FileUtils.cp("berns.#{ RbConfig::CONFIG['DLEXT'] }", File.join(profile, 'lib', 'berns'))
+    trained = system(RbConfig.ruby, '-I', File.join(profile, 'lib'), '-I', lib, workload, '100') && system(make, 'clean')
+  end
+
+  # Clang writes raw profiles that have to be merged before they can be used.
+  trained &&= system('llvm-profdata', 'merge', "--output=#{ profile }/berns.profdata", *Dir[File.join(profile, '*.profraw')]) if clang
+
+  if trained
+    profile_use = profile
+  else
+    message "profiling failed, building without profile-guided optimization\n"
+  end
+end
+
+# The profile flags are added as-is since mkmf's test compile would warn about
+# its own missing profile and reject them.
+if profile_use
+  if clang
+    $CFLAGS << " -fprofile-use=#{ profile_use }/berns.profdata" # rubocop:disable Style/GlobalVars
+  else
+    append_cflags '-fprofile-correction'
+    append_cflags '-fprofile-partial-training'
+    $CFLAGS << " -fprofile-use=#{ profile_use }" # rubocop:disable Style/GlobalVars
+  end
+end
+
 create_makefile 'berns/berns'
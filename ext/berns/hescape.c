@@ -165,3 +165,238 @@ hesc_escape_html(uint8_t **dest, const uint8_t *buf, size_t size)
     return size + esize;
   }
 }
+
+/*
+ * Return the index of the next character to escape at or after i, or size.
+ */
+static inline size_t
+find_escape(const uint8_t *buf, size_t i, size_t size)
+{
+# ifdef __SSE4_2__
+  if (likely(size - i >= 16)) {
+    int found = 0;
+    __m128i escapes5 = _mm_loadu_si128((const __m128i *)"\"&'<>");
+    i = find_char_fast((const char *)buf, i, size, escapes5, 5, &found);
+    if (found) return i;
+  }
+# endif
+
+  while (i < size && HTML_ESCAPE_TABLE[buf[i]] == 0)
+    i++;
+
+  return i;
+}
+
+size_t
+hesc_escape_html_into(uint8_t *dest, const uint8_t *buf, size_t size)
+{
+  size_t i = 0, start = 0, w = 0, esc_i;
+
+  while ((i = find_escape(buf, i, size)) < size) {
+    esc_i = HTML_ESCAPE_TABLE[buf[i]];
+    memcpy(dest + w, buf + start, i - start);
+    w += i - start;
+    memcpy(dest + w, ESCAPED_STRING[esc_i], ESC_LEN(esc_i));
+    w += ESC_LEN(esc_i);
+    start = ++i;
+  }
+
+  memcpy(dest + w, buf + start, size - start);
+
+  return w + size - start;
+}
+
+size_t
+hesc_escaped_size(const uint8_t *buf, size_t size)
+{
+  size_t esize = 0, esc_i;
+
+  for (size_t i = 0; i < size; i++) {
+    if (unlikely((esc_i = HTML_ESCAPE_TABLE[buf[i]]) != 0))
+      esize += ESC_LEN(esc_i) - 1;
+  }
+
+  return size + esize;
+}
+
+void
+hesc_escape_html_inplace(uint8_t *buf, size_t size, size_t escaped_size)
+{
+  // Walk backwards from the end so that each byte is read before the escaped
+  // output overwrites it. Once the write position catches up with the read
+  // position there is nothing left to escape.
+  size_t w = escaped_size, i = size, esc_i;
+
+  while (i > 0 && w > i) {
+    i--;
+
+    if (unlikely((esc_i = HTML_ESCAPE_TABLE[buf[i]]) != 0)) {
+      w -= ESC_LEN(esc_i);
+      memcpy(buf + w, ESCAPED_STRING[esc_i], ESC_LEN(esc_i));
+    } else {
+      buf[--w] = buf[i];
+    }
+  }
+
+  buf[escaped_size] = '\0';
+}
+
+/*
+ * Return the size of the UTF-8 sequence starting at buf[i], setting *valid. For
+ * an invalid sequence, that's the size of its maximal subpart (Unicode 3.9,
+ * table 3-7), which is always at least 1.
+ */
+static inline size_t
+utf8_sequence(const uint8_t *buf, size_t i, size_t size, int *valid)
+{
+  uint8_t c = buf[i], lo = 0x80, hi = 0xBF;
+  size_t need, k;
+
+  if (c >= 0xC2 && c <= 0xDF) {
+    need = 1;
+  } else if (c >= 0xE0 && c <= 0xEF) {
+    need = 2;
+    if (c == 0xE0) lo = 0xA0;
+    else if (c == 0xED) hi = 0x9F;
+  } else if (c >= 0xF0 && c <= 0xF4) {
+    need = 3;
+    if (c == 0xF0) lo = 0x90;
+    else if (c == 0xF4) hi = 0x8F;
+  } else {
+    *valid = 0;
+    return 1;
+  }
+
+  for (k = 1; k <= need; k++) {
+    if (unlikely(i + k >= size || buf[i + k] < lo || buf[i + k] > hi)) {
+      *valid = 0;
+      return k;
+    }
+    lo = 0x80;
+    hi = 0xBF;
+  }
+
+  *valid = 1;
+  return k;
+}
+
+#ifdef __SSE4_2__
+/*
+ * Whether 16 bytes are all ASCII with nothing to escape.
+ */
+static inline int
+clean_ascii_block(__m128i b16, __m128i escapes5)
+{
+  return _mm_movemask_epi8(b16) == 0 &&
+    _mm_cmpestri(escapes5, 5, b16, 16, _SIDD_CMP_EQUAL_ANY) == 16;
+}
+#endif
+
+size_t
+hesc_utf8_clean_prefix(const uint8_t *buf, size_t size, int *ascii)
+{
+  size_t i = 0, end, len;
+  int valid;
+
+  *ascii = 1;
+
+# ifdef __SSE4_2__
+  __m128i escapes5 = _mm_loadu_si128((const __m128i *)"\"&'<>");
+# endif
+
+  while (i < size) {
+    end = size;
+
+# ifdef __SSE4_2__
+    // Skip whole blocks of plain ASCII, and check the rest of a block that
+    // isn't one byte at a time before trying the next block.
+    if (likely(size - i >= 16)) {
+      if (clean_ascii_block(_mm_loadu_si128((const void *)(buf + i)), escapes5)) {
+        i += 16;
+        continue;
+      }
+      end = i + 16;
+    }
+# endif
+
+    while (i < end) {
+      if (buf[i] < 0x80) {
+        if (unlikely(HTML_ESCAPE_TABLE[buf[i]] != 0))
+          return i;
+        i++;
+      } else {
+        *ascii = 0;
+        len = utf8_sequence(buf, i, size, &valid);
+        if (unlikely(!valid))
+          return i;
+        i += len;
+      }
+    }
+  }
+
+  return size;
+}
+
+void
+hesc_escape_html_utf8(uint8_t *dest, size_t capacity, const uint8_t *buf, size_t size, int replace, hesc_utf8_state *state)
+{
+  size_t i = state->read, w = state->written, end, esc_i, len;
+  int valid;
+
+# ifdef __SSE4_2__
+  __m128i escapes5 = _mm_loadu_si128((const __m128i *)"\"&'<>");
+# endif
+
+  while (i < size && capacity - w >= HESC_UTF8_SLACK) {
+    end = size;
+
+# ifdef __SSE4_2__
+    if (likely(size - i >= 16)) {
+      __m128i b16 = _mm_loadu_si128((const void *)(buf + i));
+      if (clean_ascii_block(b16, escapes5)) {
+        _mm_storeu_si128((void *)(dest + w), b16);
+        i += 16;
+        w += 16;
+        continue;
+      }
+      end = i + 16;
+    }
+# endif
+
+    // Each step writes at most 6 bytes, so HESC_UTF8_SLACK leaves room for one.
+    while (i < end && capacity - w >= HESC_UTF8_SLACK) {
+      if (buf[i] < 0x80) {
+        if (unlikely((esc_i = HTML_ESCAPE_TABLE[buf[i]]) != 0)) {
+          memcpy(dest + w, ESCAPED_STRING[esc_i], ESC_LEN(esc_i));
+          w += ESC_LEN(esc_i);
+          state->modified = 1;
+        } else {
+          dest[w++] = buf[i];
+        }
+        i++;
+        continue;
+      }
+
+      state->ascii = 0;
+      len = utf8_sequence(buf, i, size, &valid);
+
+      if (likely(valid)) {
+        memcpy(dest + w, buf + i, len);
+        w += len;
+      } else if (replace) {
+        memcpy(dest + w, "\xEF\xBF\xBD", 3);
+        w += 3;
+        state->modified = 1;
+      } else {
+        state->invalid = 1;
+        state->read = i;
+        state->written = w;
+        return;
+      }
+      i += len;
+    }
+  }
+
+  state->read = i;
+  state->written = w;
+}
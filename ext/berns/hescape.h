@@ -18,4 +18,51 @@
  */
 extern size_t hesc_escape_html(uint8_t **dest, const uint8_t *src, size_t size);
 
+/*
+ * Escape src into dest with the rules above and return the size written. dest
+ * must hold the escaped size of src, which is at most HESC_MAX_GROWTH times
+ * size, and is never allocated or freed.
+ */
+#define HESC_MAX_GROWTH 6
+extern size_t hesc_escape_html_into(uint8_t *dest, const uint8_t *src, size_t size);
+
+/*
+ * Return the size src would be after escaping with the rules above.
+ */
+extern size_t hesc_escaped_size(const uint8_t *src, size_t size);
+
+/*
+ * Escape buf in place. buf must hold at least escaped_size + 1 bytes, where
+ * escaped_size is the value returned by hesc_escaped_size for the same input.
+ */
+extern void hesc_escape_html_inplace(uint8_t *buf, size_t size, size_t escaped_size);
+
+/*
+ * Progress of hesc_escape_html_utf8, which can be called again with the same
+ * state and a larger dest to pick up where it stopped.
+ */
+typedef struct {
+  size_t read;     // bytes of src consumed
+  size_t written;  // bytes of dest written
+  int ascii;       // every byte consumed was ASCII
+  int modified;    // a character was escaped or a sequence replaced
+  int invalid;     // stopped at an invalid sequence starting at read
+} hesc_utf8_state;
+
+/*
+ * Escape src into dest with the rules above while validating it as UTF-8. Each
+ * maximal invalid subsequence, as String#scrub defines them, is replaced with
+ * U+FFFD when replace is set, and otherwise stops the scan with state->invalid
+ * set. Returns once src is consumed or dest has less than HESC_UTF8_SLACK bytes
+ * left after state->written.
+ */
+#define HESC_UTF8_SLACK 16
+extern void hesc_escape_html_utf8(uint8_t *dest, size_t capacity, const uint8_t *src, size_t size, int replace, hesc_utf8_state *state);
+
+/*
+ * Return the size of the longest prefix of src that is valid UTF-8 and has
+ * nothing to escape, setting *ascii to whether that prefix is all ASCII.
+ */
+extern size_t hesc_utf8_clean_prefix(const uint8_t *src, size_t size, int *ascii);
+
 #endif
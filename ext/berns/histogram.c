@@ -0,0 +1,142 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "histogram.h"
+
+static const rb_data_type_t histogram_type = {
+	"Berns::Histogram",
+	{ NULL, RUBY_TYPED_DEFAULT_FREE, NULL },
+	0, 0,
+	RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+static VALUE histogram_alloc(VALUE klass) {
+	histogram *state;
+
+	return TypedData_Make_Struct(klass, histogram, &histogram_type, state);
+}
+
+histogram * histogram_get(VALUE self) {
+	histogram *state;
+	TypedData_Get_Struct(self, histogram, &histogram_type, state);
+
+	return state;
+}
+
+static inline unsigned int histogram_bucket(uint64_t value) {
+	if (value <= 1) {
+		return (unsigned int) value;
+	}
+
+	unsigned int bucket = 65 - __builtin_clzll(value - 1);
+
+	return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1;
+}
+
+static inline uint64_t histogram_bound(unsigned int bucket) {
+	return bucket == 0 ? 0 : (uint64_t) 1 << (bucket - 1);
+}
+
+void histogram_add(histogram *state, uint64_t value) {
+	state->count++;
+	state->sum += value;
+	state->buckets[histogram_bucket(value)]++;
+}
+
+/*
+ * Berns::Histogram#record
+ *
+ * Count value, which must be an Integer. Negative values, which a clock
+ * stepping backwards could produce, are counted as zero. Returns self.
+ */
+static VALUE histogram_record(VALUE self, VALUE value) {
+	long long number = NUM2LL(value);
+
+	rb_check_frozen(self);
+	histogram_add(histogram_get(self), number > 0 ? (uint64_t) number : 0);
+
+	return self;
+}
+
+/*
+ * Berns::Histogram#count
+ */
+static VALUE histogram_count(VALUE self) {
+	return ULL2NUM(histogram_get(self)->count);
+}
+
+/*
+ * Berns::Histogram#sum
+ */
+static VALUE histogram_sum(VALUE self) {
+	return ULL2NUM(histogram_get(self)->sum);
+}
+
+/*
+ * Berns::Histogram#buckets
+ *
+ * A Hash of each non-empty bucket's upper bound to the number of values in it,
+ * in ascending order.
+ */
+static VALUE histogram_buckets(VALUE self) {
+	histogram *state = histogram_get(self);
+	VALUE buckets = rb_hash_new();
+
+	for (unsigned int bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+		if (state->buckets[bucket] > 0) {
+			rb_hash_aset(buckets, ULL2NUM(histogram_bound(bucket)), ULL2NUM(state->buckets[bucket]));
+		}
+	}
+
+	return buckets;
+}
+
+/*
+ * Berns::Histogram#to_h
+ */
+static VALUE histogram_to_h(VALUE self) {
+	VALUE hash = rb_hash_new();
+
+	rb_hash_aset(hash, ID2SYM(rb_intern("count")), histogram_count(self));
+	rb_hash_aset(hash, ID2SYM(rb_intern("sum")), histogram_sum(self));
+	rb_hash_aset(hash, ID2SYM(rb_intern("buckets")), histogram_buckets(self));
+
+	return hash;
+}
+
+/*
+ * Berns::Histogram#reset
+ */
+static VALUE histogram_reset(VALUE self) {
+	rb_check_frozen(self);
+	memset(histogram_get(self), 0, sizeof(histogram));
+
+	return self;
+}
+
+/*
+ * Berns::Histogram#initialize_copy
+ */
+static VALUE histogram_initialize_copy(VALUE self, VALUE other) {
+	if (self != other) {
+		*histogram_get(self) = *histogram_get(other);
+	}
+
+	return self;
+}
+
+VALUE histogram_define(VALUE module) {
+	VALUE klass = rb_define_class_under(module, "Histogram", rb_cObject);
+
+	rb_define_alloc_func(klass, histogram_alloc);
+	rb_define_method(klass, "<<", histogram_record, 1);
+	rb_define_method(klass, "buckets", histogram_buckets, 0);
+	rb_define_method(klass, "count", histogram_count, 0);
+	rb_define_method(klass, "initialize_copy", histogram_initialize_copy, 1);
+	rb_define_method(klass, "record", histogram_record, 1);
+	rb_define_method(klass, "reset", histogram_reset, 0);
+	rb_define_method(klass, "sum", histogram_sum, 0);
+	rb_define_method(klass, "to_h", histogram_to_h, 0);
+
+	return klass;
+}
@@ -0,0 +1,38 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+
+#include "ruby.h"
+
+/*
+ * Bucket 0 counts zeroes and bucket n counts values greater than 2^(n - 2) and
+ * at most 2^(n - 1), so every bucket's upper bound is inclusive like a
+ * Prometheus "le" label. The last bucket takes everything larger.
+ */
+#define HISTOGRAM_BUCKETS 64
+
+typedef struct {
+	uint64_t count;
+	uint64_t sum;
+	uint64_t buckets[HISTOGRAM_BUCKETS];
+} histogram;
+
+/*
+ * The histogram wrapped by a Berns::Histogram, and a value to count in it.
+ * Counts are only changed while holding the GVL, so plain increments are
+ * enough.
+ */
+extern histogram * histogram_get(VALUE self);
+extern void histogram_add(histogram *state, uint64_t value);
+
+/*
+ * Define the Berns::Histogram class under the given module and return it.
+ *
+ * Instances count non-negative integers, like render times in nanoseconds or
+ * output sizes in bytes, in buckets whose upper bounds are powers of two, along
+ * with their total. Recording is a couple of increments with no allocation.
+ */
+extern VALUE histogram_define(VALUE module);
+
+#endif
@@ -0,0 +1,319 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "jsonattr.h"
+#include "strxfree.h"
+#include "strxnew.h"
+#include "strxresize.h"
+
+/*
+ * The same limit the json gem uses by default, which also stops us from
+ * recursing forever through self-referential Arrays and Hashes.
+ */
+#define JSONATTR_MAX_NESTING 100
+
+static VALUE cJSONValue = Qnil;
+static ID id_value;
+static ID id_to_s;
+
+typedef struct {
+	char *buffer;
+	size_t length;
+	size_t capacity;
+	VALUE value;
+	const char *attr;
+	size_t attrlen;
+	bool finished;
+} jsonattr_state;
+
+typedef struct {
+	jsonattr_state *state;
+	int depth;
+	bool first;
+} jsonattr_pair;
+
+/*
+ * Bytes in JSON strings that need escaping for either JSON or HTML. Control
+ * characters, backslash, and double quotes are JSON escaped; double quotes,
+ * ampersands, single quotes, and angle brackets are HTML escaped.
+ */
+static const char JSONATTR_ESCAPE_TABLE[256] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+};
+
+static void dump(jsonattr_state *state, VALUE value, int depth);
+
+static inline void reserve(jsonattr_state *state, size_t size) {
+	size_t needed = state->length + size + 1;
+
+	if (needed > state->capacity) {
+		size_t capacity = state->capacity;
+
+		while (capacity < needed) {
+			capacity *= 2;
+		}
+
+		state->buffer = strxresize(state->buffer, capacity);
+		state->capacity = capacity;
+	}
+}
+
+static inline void append(jsonattr_state *state, const char *str, size_t len) {
+	reserve(state, len);
+	memcpy(state->buffer + state->length, str, len);
+	state->length += len;
+}
+
+#define APPEND_LITERAL(state, literal) append(state, literal, sizeof(literal) - 1)
+
+/*
+ * Append a string as a JSON string, escaping it for JSON and HTML as we go.
+ */
+static void dump_string(jsonattr_state *state, const char *str, size_t len) {
+	size_t start = 0;
+
+	APPEND_LITERAL(state, "&quot;");
+
+	for (size_t i = 0; i < len; i++) {
+		unsigned char c = str[i];
+
+		if (!JSONATTR_ESCAPE_TABLE[c]) {
+			continue;
+		}
+
+		append(state, str + start, i - start);
+		start = i + 1;
+
+		switch(c) {
+			case '"':
+				APPEND_LITERAL(state, "\\&quot;");
+				break;
+			case '\\':
+				APPEND_LITERAL(state, "\\\\");
+				break;
+			case '&':
+				APPEND_LITERAL(state, "&amp;");
+				break;
+			case '\'':
+				APPEND_LITERAL(state, "&#39;");
+				break;
+			case '<':
+				APPEND_LITERAL(state, "&lt;");
+				break;
+			case '>':
+				APPEND_LITERAL(state, "&gt;");
+				break;
+			case '\b':
+				APPEND_LITERAL(state, "\\b");
+				break;
+			case '\f':
+				APPEND_LITERAL(state, "\\f");
+				break;
+			case '\n':
+				APPEND_LITERAL(state, "\\n");
+				break;
+			case '\r':
+				APPEND_LITERAL(state, "\\r");
+				break;
+			case '\t':
+				APPEND_LITERAL(state, "\\t");
+				break;
+			default: {
+				char unicode[7];
+				snprintf(unicode, sizeof(unicode), "\\u%04x", c);
+				append(state, unicode, 6);
+				break;
+			}
+		}
+	}
+
+	append(state, str + start, len - start);
+	APPEND_LITERAL(state, "&quot;");
+}
+
+static void dump_rstring(jsonattr_state *state, VALUE string) {
+	if (TYPE(string) == T_SYMBOL) {
+		string = rb_sym2str(string);
+	} else if (TYPE(string) != T_STRING) {
+		string = rb_funcall(string, id_to_s, 0);
+		Check_Type(string, T_STRING);
+	}
+
+	dump_string(state, RSTRING_PTR(string), RSTRING_LEN(string));
+}
+
+static int dump_pair(VALUE key, VALUE value, VALUE data) {
+	jsonattr_pair *pair = (jsonattr_pair *) data;
+
+	if (!pair->first) {
+		APPEND_LITERAL(pair->state, ",");
+	}
+
+	pair->first = false;
+
+	dump_rstring(pair->state, key);
+	APPEND_LITERAL(pair->state, ":");
+	dump(pair->state, value, pair->depth);
+
+	return ST_CONTINUE;
+}
+
+static void dump(jsonattr_state *state, VALUE value, int depth) {
+	if (depth > JSONATTR_MAX_NESTING) {
+		rb_raise(rb_eArgError, "Berns.json nesting of %d is too deep", depth);
+	}
+
+	switch(TYPE(value)) {
+		case T_NIL:
+			APPEND_LITERAL(state, "null");
+			break;
+
+		case T_TRUE:
+			APPEND_LITERAL(state, "true");
+			break;
+
+		case T_FALSE:
+			APPEND_LITERAL(state, "false");
+			break;
+
+		case T_FIXNUM: {
+			char number[24];
+			int len = snprintf(number, sizeof(number), "%ld", FIX2LONG(value));
+			append(state, number, len);
+			break;
+		}
+
+		case T_BIGNUM: {
+			VALUE number = rb_big2str(value, 10);
+			append(state, RSTRING_PTR(number), RSTRING_LEN(number));
+			break;
+		}
+
+		case T_FLOAT: {
+			double number = RFLOAT_VALUE(value);
+
+			if (isnan(number) || isinf(number)) {
+				rb_raise(rb_eArgError, "Berns.json can't serialize %+"PRIsVALUE" as JSON", value);
+			}
+
+			VALUE string = rb_funcall(value, id_to_s, 0);
+			append(state, RSTRING_PTR(string), RSTRING_LEN(string));
+			break;
+		}
+
+		case T_STRING:
+			dump_string(state, RSTRING_PTR(value), RSTRING_LEN(value));
+			break;
+
+		case T_SYMBOL:
+			dump_rstring(state, value);
+			break;
+
+		case T_ARRAY:
+			APPEND_LITERAL(state, "[");
+
+			for (long i = 0; i < RARRAY_LEN(value); i++) {
+				if (i > 0) {
+					APPEND_LITERAL(state, ",");
+				}
+
+				dump(state, RARRAY_AREF(value, i), depth + 1);
+			}
+
+			APPEND_LITERAL(state, "]");
+			break;
+
+		case T_HASH: {
+			jsonattr_pair pair = { state, depth + 1, true };
+
+			APPEND_LITERAL(state, "{");
+			rb_hash_foreach(value, dump_pair, (VALUE) &pair);
+			APPEND_LITERAL(state, "}");
+			break;
+		}
+
+		default:
+			if (jsonattr_p(value)) {
+				dump(state, rb_ivar_get(value, id_value), depth + 1);
+			} else {
+				dump_rstring(state, value);
+			}
+
+			break;
+	}
+}
+
+static VALUE jsonattr_body(VALUE data) {
+	jsonattr_state *state = (jsonattr_state *) data;
+
+	append(state, state->attr, state->attrlen);
+	APPEND_LITERAL(state, "=\"");
+	dump(state, state->value, 0);
+	APPEND_LITERAL(state, "\"");
+
+	state->buffer[state->length] = '\0';
+	state->finished = true;
+
+	return Qnil;
+}
+
+/*
+ * Free the buffer if serialization raised, e.g. from a #to_s or a value that
+ * nests too deeply.
+ */
+static VALUE jsonattr_cleanup(VALUE data) {
+	jsonattr_state *state = (jsonattr_state *) data;
+
+	if (!state->finished) {
+		strxfree(state->buffer);
+	}
+
+	return Qnil;
+}
+
+char * jsonattr_to_attribute(const char *attr, const size_t attrlen, VALUE json) {
+	jsonattr_state state = {
+		.capacity = 256,
+		.value = rb_ivar_get(json, id_value),
+		.attr = attr,
+		.attrlen = attrlen,
+		.finished = false
+	};
+
+	state.buffer = strxnew(state.capacity);
+
+	rb_ensure(jsonattr_body, (VALUE) &state, jsonattr_cleanup, (VALUE) &state);
+
+	return state.buffer;
+}
+
+bool jsonattr_p(VALUE value) {
+	return RB_TYPE_P(value, T_OBJECT) && rb_obj_is_kind_of(value, cJSONValue);
+}
+
+/*
+ * Berns::JSONValue#initialize
+ */
+static VALUE jsonattr_initialize(VALUE self, VALUE value) {
+	rb_ivar_set(self, id_value, value);
+	rb_obj_freeze(self);
+
+	return self;
+}
+
+VALUE jsonattr_define(VALUE module) {
+	id_value = rb_intern("@value");
+	id_to_s = rb_intern("to_s");
+
+	cJSONValue = rb_define_class_under(module, "JSONValue", rb_cObject);
+	rb_define_method(cJSONValue, "initialize", jsonattr_initialize, 1);
+	rb_define_attr(cJSONValue, "value", 1, 0);
+
+	return cJSONValue;
+}
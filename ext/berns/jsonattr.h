@@ -0,0 +1,27 @@
+#ifndef JSONATTR_H
+#define JSONATTR_H
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ruby.h"
+
+/*
+ * Define the Berns::JSONValue class under the given module and return it.
+ * Instances wrap a value that should be serialized as JSON when used as an
+ * attribute value.
+ */
+extern VALUE jsonattr_define(VALUE module);
+
+/*
+ * Whether value is an instance of Berns::JSONValue.
+ */
+extern bool jsonattr_p(VALUE value);
+
+/*
+ * Serialize the value wrapped by a Berns::JSONValue to JSON and HTML escape it
+ * as the value of attr in a single pass, e.g. data-config="{&quot;a&quot;:1}".
+ * The returned memory must be freed with strxfree.
+ */
+extern char * jsonattr_to_attribute(const char *attr, const size_t attrlen, VALUE json);
+
+#endif
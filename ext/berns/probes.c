@@ -0,0 +1,82 @@
+/*
+ * The render probes use semaphores, which tracers increment while attached, so
+ * Berns::Builder can skip calling into here at all when nobody's listening.
+ * The rest of the probes are cheap enough to leave as bare nops. This has to be
+ * defined before sys/sdt.h is included.
+ */
+#define _SDT_HAS_SEMAPHORES 1
+
+#include "probes.h"
+
+#ifdef HAVE_SYS_SDT_H
+/*
+ * Volatile like the ones dtrace -h generates, since nothing in the program
+ * writes them: without it, LTO folds every read to zero and drops them.
+ */
+volatile unsigned short berns_render_start_semaphore __attribute__((unused)) __attribute__((section(".probes")));
+volatile unsigned short berns_render_done_semaphore __attribute__((unused)) __attribute__((section(".probes")));
+
+/*
+ * Berns::Probes.enabled?
+ */
+static VALUE probes_enabled(RB_UNUSED_VAR(VALUE self)) {
+	return (berns_render_start_semaphore || berns_render_done_semaphore) ? Qtrue : Qfalse;
+}
+
+/*
+ * Berns::Probes.render_start(label)
+ */
+static VALUE probes_render_start(RB_UNUSED_VAR(VALUE self), VALUE label) {
+	Check_Type(label, T_STRING);
+	PROBE2(render_start, RSTRING_PTR(label), RSTRING_LEN(label));
+	RB_GC_GUARD(label);
+
+	return Qnil;
+}
+
+/*
+ * Berns::Probes.render_done(label, bytes)
+ */
+static VALUE probes_render_done(RB_UNUSED_VAR(VALUE self), VALUE label, VALUE bytes) {
+	Check_Type(label, T_STRING);
+	long size = NUM2LONG(bytes);
+
+	PROBE3(render_done, RSTRING_PTR(label), RSTRING_LEN(label), size);
+	RB_GC_GUARD(label);
+
+	return Qnil;
+}
+#else
+static VALUE probes_enabled(RB_UNUSED_VAR(VALUE self)) {
+	return Qfalse;
+}
+
+static VALUE probes_render_start(RB_UNUSED_VAR(VALUE self), VALUE label) {
+	Check_Type(label, T_STRING);
+
+	return Qnil;
+}
+
+static VALUE probes_render_done(RB_UNUSED_VAR(VALUE self), VALUE label, VALUE bytes) {
+	Check_Type(label, T_STRING);
+	NUM2LONG(bytes);
+
+	return Qnil;
+}
+#endif
+
+VALUE probes_define(VALUE module) {
+	VALUE probes = rb_define_module_under(module, "Probes");
+
+#ifdef HAVE_SYS_SDT_H
+	rb_define_const(probes, "AVAILABLE", Qtrue);
+#else
+	rb_define_const(probes, "AVAILABLE", Qfalse);
+#endif
+
+	rb_define_singleton_method(probes, "enabled?", probes_enabled, 0);
+	rb_define_singleton_method(probes, "render_start", probes_render_start, 1);
+	rb_define_singleton_method(probes, "render_done", probes_render_done, 2);
+
+	return probes;
+}
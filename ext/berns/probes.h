@@ -0,0 +1,35 @@
+#ifndef PROBES_H
+#define PROBES_H
+#include <stdbool.h>
+
+#include "ruby.h"
+
+/*
+ * Static tracepoints for bpftrace, perf, and SystemTap, under the provider
+ * "berns". Each compiles to a single nop until a tracer attaches to it, or to
+ * nothing when sys/sdt.h isn't available, in which case the arguments aren't
+ * evaluated so they must not have side effects. See benchmarks/berns.bt for
+ * the list of probes and their arguments.
+ */
+#ifdef HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+
+#define PROBE1(name, a) DTRACE_PROBE1(berns, name, a)
+#define PROBE2(name, a, b) DTRACE_PROBE2(berns, name, a, b)
+#define PROBE3(name, a, b, c) DTRACE_PROBE3(berns, name, a, b, c)
+#define PROBE4(name, a, b, c, d) DTRACE_PROBE4(berns, name, a, b, c, d)
+#else
+#define PROBE1(name, a) ((void) 0)
+#define PROBE2(name, a, b) ((void) 0)
+#define PROBE3(name, a, b, c) ((void) 0)
+#define PROBE4(name, a, b, c, d) ((void) 0)
+#endif
+
+/*
+ * Define the Berns::Probes module under the given module and return it. It
+ * fires the render_start and render_done probes for Berns::Builder, which
+ * only calls it while a tracer is attached to one of them.
+ */
+extern VALUE probes_define(VALUE module);
+
+#endif
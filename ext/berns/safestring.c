@@ -0,0 +1,132 @@
+#include "ruby/encoding.h"
+#include "safestring.h"
+
+static VALUE cSafeString = Qnil;
+static VALUE template = Qnil;
+static ID id_freeze;
+static ID id_html_safe_p;
+
+VALUE safestring_new(const char *ptr, long len) {
+	return rb_obj_freeze(safestring_buffer(ptr, len));
+}
+
+VALUE safestring_buffer(const char *ptr, long len) {
+	VALUE string = rb_str_new_with_class(template, ptr, len);
+
+	rb_enc_associate_index(string, rb_utf8_encindex());
+
+	return string;
+}
+
+bool safestring_p(VALUE string) {
+	VALUE klass = rb_obj_class(string);
+
+	if (RB_LIKELY(klass == rb_cString)) {
+		return false;
+	}
+
+	if (klass == cSafeString || RTEST(rb_class_inherited_p(klass, cSafeString))) {
+		return true;
+	}
+
+	return rb_respond_to(string, id_html_safe_p) && RTEST(rb_funcall(string, id_html_safe_p, 0));
+}
+
+/*
+ * Berns::SafeString#html_safe? is always true, so Rails doesn't escape it
+ * again either.
+ */
+static VALUE safestring_html_safe_p(RB_UNUSED_VAR(VALUE self)) {
+	return Qtrue;
+}
+
+/*
+ * Berns::SafeString#to_s returns itself rather than a plain String copy, so it
+ * stays trusted when passed through #to_s, e.g. by Berns::Builder#text.
+ */
+static VALUE safestring_to_s(VALUE self) {
+	return self;
+}
+
+/*
+ * A plain String copy of a Berns::SafeString. Copies that can be changed are
+ * plain strings, since whatever is appended to them afterwards isn't trusted.
+ */
+static VALUE safestring_plain(VALUE string) {
+	VALUE copy = rb_str_new(RSTRING_PTR(string), RSTRING_LEN(string));
+
+	rb_enc_copy(copy, string);
+
+	return copy;
+}
+
+/*
+ * Berns::SafeString#dup returns a plain String.
+ */
+static VALUE safestring_dup(VALUE self) {
+	return safestring_plain(self);
+}
+
+/*
+ * Berns::SafeString#+@ returns a plain String copy of a frozen safe string, and
+ * the safe string itself otherwise like String#+@.
+ */
+static VALUE safestring_uplus(VALUE self) {
+	return OBJ_FROZEN(self) ? safestring_plain(self) : self;
+}
+
+/*
+ * Berns::SafeString#clone returns a plain String when the clone wouldn't be
+ * frozen, e.g. with freeze: false, and a Berns::SafeString otherwise.
+ */
+static VALUE safestring_clone(int argc, VALUE *argv, VALUE self) {
+	VALUE opts = Qnil;
+	VALUE freeze = Qundef;
+
+	rb_scan_args(argc, argv, "0:", &opts);
+
+	if (!NIL_P(opts)) {
+		rb_get_kwargs(opts, &id_freeze, 0, 1, &freeze);
+	}
+
+	if (freeze == Qfalse || ((freeze == Qundef || NIL_P(freeze)) && !OBJ_FROZEN(self))) {
+		return safestring_plain(self);
+	}
+
+	return rb_call_super_kw(argc, argv, RB_PASS_CALLED_KEYWORDS);
+}
+
+/*
+ * Berns::SafeString#encode returns a plain String, since String#encode returns
+ * a new string of the receiver's class that isn't frozen.
+ */
+static VALUE safestring_encode(int argc, VALUE *argv, VALUE self) {
+	VALUE encoded = rb_call_super_kw(argc, argv, RB_PASS_CALLED_KEYWORDS);
+
+	if (encoded != self && rb_obj_class(encoded) != rb_cString) {
+		encoded = safestring_plain(encoded);
+	}
+
+	return encoded;
+}
+
+VALUE safestring_define(VALUE module) {
+	id_freeze = rb_intern("freeze");
+	id_html_safe_p = rb_intern("html_safe?");
+
+	cSafeString = rb_define_class_under(module, "SafeString", rb_cString);
+	rb_define_method(cSafeString, "html_safe?", safestring_html_safe_p, 0);
+	rb_define_method(cSafeString, "html_safe", safestring_to_s, 0);
+	rb_define_method(cSafeString, "to_s", safestring_to_s, 0);
+	rb_define_method(cSafeString, "to_str", safestring_to_s, 0);
+	rb_define_method(cSafeString, "dup", safestring_dup, 0);
+	rb_define_method(cSafeString, "+@", safestring_uplus, 0);
+	rb_define_method(cSafeString, "clone", safestring_clone, -1);
+	rb_define_method(cSafeString, "encode", safestring_encode, -1);
+
+	/* New safe strings are created with the class of this one. */
+	template = rb_obj_freeze(rb_class_new_instance(0, NULL, cSafeString));
+	rb_gc_register_mark_object(template);
+
+	return cSafeString;
+}
@@ -0,0 +1,36 @@
+#ifndef SAFESTRING_H
+#define SAFESTRING_H
+#include <stdbool.h>
+
+#include "ruby.h"
+
+/*
+ * Define the Berns::SafeString class under the given module and return it.
+ * It's a String subclass for HTML that's already escaped or otherwise trusted,
+ * which Berns returns from its element methods and escape_html, and which the
+ * escape methods return as-is.
+ */
+extern VALUE safestring_define(VALUE module);
+
+/*
+ * Create a new frozen UTF-8 Berns::SafeString with a copy of len bytes of ptr.
+ * Every safe string Berns returns is frozen, since appending to one would
+ * leave whatever was appended trusted without being escaped.
+ */
+extern VALUE safestring_new(const char *ptr, long len);
+
+/*
+ * Create a new UTF-8 Berns::SafeString of len bytes, copied from ptr unless
+ * it's NULL, that isn't frozen yet so it can be written in place. Freeze it
+ * with rb_obj_freeze before returning it.
+ */
+extern VALUE safestring_buffer(const char *ptr, long len);
+
+/*
+ * Whether string is trusted not to need escaping: a Berns::SafeString, or a
+ * String subclass whose #html_safe? is true like Rails' ActiveSupport::SafeBuffer.
+ * Plain Strings are never trusted, which only takes a class comparison.
+ */
+extern bool safestring_p(VALUE string);
+
+#endif
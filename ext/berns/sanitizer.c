@@ -0,0 +1,694 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "ruby.h"
+#include "ruby/encoding.h"
+#include "safestring.h"
+#include "sanitizer.h"
+#include "strxfree.h"
+#include "strxnew.h"
+
+/*
+ * Allowed elements nested deeper than this are dropped, keeping their text,
+ * so the stack of open elements has a fixed size.
+ */
+#define SANITIZER_MAX_DEPTH 256
+
+/*
+ * Element and attribute names longer than this can't be in an allowlist.
+ */
+#define SANITIZER_MAX_NAME 64
+
+/*
+ * A list of lowercase names e.g. allowed elements or attributes.
+ */
+typedef struct {
+	char **items;
+	size_t *lengths;
+	size_t count;
+} sanitizer_names;
+
+typedef struct {
+	/* Allowed elements, and for each one whether it's void and its attributes. */
+	sanitizer_names elements;
+	bool *voids;
+	sanitizer_names *attributes;
+
+	/* Attributes allowed on every element. */
+	sanitizer_names global;
+
+	/* Attributes holding URLs, and for each one the protocols it allows. */
+	sanitizer_names urls;
+	sanitizer_names *protocols;
+} sanitizer_policy;
+
+/*
+ * A single attribute as it appeared in the input.
+ */
+typedef struct {
+	const char *name;
+	size_t namelen;
+	const char *value;
+	size_t vallen;
+	bool has_value;
+} sanitizer_attribute;
+
+static const char *void_elements[] = {
+	"area", "base", "br", "col", "embed", "hr", "img", "input", "link", "menuitem", "meta", "param", "source", "track", "wbr"
+};
+
+/*
+ * Elements that are always removed along with everything inside of them,
+ * whether or not they're in the allowlist.
+ */
+static const char *dropped_elements[] = {
+	"iframe", "noembed", "noframes", "noscript", "object", "plaintext", "script", "style", "template", "textarea", "title", "xmp"
+};
+
+#define COUNT(array) (sizeof(array) / sizeof(array[0]))
+
+static inline char lowercase(char c) {
+	return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+static inline bool alpha_p(char c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static inline bool digit_p(char c) {
+	return c >= '0' && c <= '9';
+}
+
+static inline bool space_p(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static long names_index(const sanitizer_names *names, const char *name, size_t len) {
+	for (size_t i = 0; i < names->count; i++) {
+		if (names->lengths[i] == len && memcmp(names->items[i], name, len) == 0) {
+			return (long) i;
+		}
+	}
+
+	return -1;
+}
+
+static bool list_p(const char **list, size_t count, const char *name, size_t len) {
+	for (size_t i = 0; i < count; i++) {
+		if (strlen(list[i]) == len && memcmp(list[i], name, len) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void names_free(sanitizer_names *names) {
+	for (size_t i = 0; i < names->count; i++) {
+		strxfree(names->items[i]);
+	}
+
+	if (names->items) {
+		ruby_xfree(names->items);
+		ruby_xfree(names->lengths);
+	}
+
+	names->items = NULL;
+	names->lengths = NULL;
+	names->count = 0;
+}
+
+static size_t names_memsize(const sanitizer_names *names) {
+	size_t size = names->count * (sizeof(char *) + sizeof(size_t));
+
+	for (size_t i = 0; i < names->count; i++) {
+		size += names->lengths[i] + 1;
+	}
+
+	return size;
+}
+
+/*
+ * Copy an Array of Strings into names. The Strings should already be
+ * lowercase.
+ */
+static void names_from_array(sanitizer_names *names, VALUE array) {
+	Check_Type(array, T_ARRAY);
+
+	long count = RARRAY_LEN(array);
+
+	names->items = ALLOC_N(char *, count);
+	names->lengths = ALLOC_N(size_t, count);
+	names->count = 0;
+
+	for (long i = 0; i < count; i++) {
+		VALUE name = RARRAY_AREF(array, i);
+		Check_Type(name, T_STRING);
+
+		size_t len = RSTRING_LEN(name);
+		char *item = strxnew(len + 1);
+
+		memcpy(item, RSTRING_PTR(name), len);
+		item[len] = '\0';
+
+		names->items[i] = item;
+		names->lengths[i] = len;
+		names->count++;
+	}
+}
+
+static void policy_clear(sanitizer_policy *policy) {
+	for (size_t i = 0; i < policy->elements.count && policy->attributes; i++) {
+		names_free(&policy->attributes[i]);
+	}
+
+	for (size_t i = 0; i < policy->urls.count && policy->protocols; i++) {
+		names_free(&policy->protocols[i]);
+	}
+
+	ruby_xfree(policy->voids);
+	ruby_xfree(policy->attributes);
+	ruby_xfree(policy->protocols);
+
+	names_free(&policy->elements);
+	names_free(&policy->global);
+	names_free(&policy->urls);
+
+	policy->voids = NULL;
+	policy->attributes = NULL;
+	policy->protocols = NULL;
+}
+
+static void policy_free(void *data) {
+	policy_clear(data);
+	ruby_xfree(data);
+}
+
+static size_t policy_memsize(const void *data) {
+	const sanitizer_policy *policy = data;
+	size_t size = sizeof(sanitizer_policy) + names_memsize(&policy->elements) + names_memsize(&policy->global) + names_memsize(&policy->urls);
+
+	for (size_t i = 0; i < policy->elements.count; i++) {
+		size += sizeof(bool) + sizeof(sanitizer_names) + names_memsize(&policy->attributes[i]);
+	}
+
+	for (size_t i = 0; i < policy->urls.count; i++) {
+		size += sizeof(sanitizer_names) + names_memsize(&policy->protocols[i]);
+	}
+
+	return size;
+}
+
+static const rb_data_type_t policy_type = {
+	"Berns::Sanitizer",
+	{ NULL, policy_free, policy_memsize },
+	0, 0,
+	RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+static VALUE policy_alloc(VALUE klass) {
+	sanitizer_policy *policy;
+
+	return TypedData_Make_Struct(klass, sanitizer_policy, &policy_type, policy);
+}
+
+static size_t entity_length(const char *src, size_t i, size_t len);
+
+/*
+ * Append a run of text, escaping "<", ">", and any "&" that doesn't start a
+ * character reference. Quotes are also escaped in attribute values.
+ */
+static void append_escaped(VALUE out, const char *src, size_t from, size_t to, bool attribute) {
+	size_t start = from;
+
+	for (size_t i = from; i < to; i++) {
+		const char *escaped;
+
+		switch(src[i]) {
+			case '&':
+				if (entity_length(src, i, to) > 0) {
+					continue;
+				}
+
+				escaped = "&amp;";
+				break;
+			case '<':
+				escaped = "&lt;";
+				break;
+			case '>':
+				escaped = "&gt;";
+				break;
+			case '"':
+				if (!attribute) {
+					continue;
+				}
+
+				escaped = "&quot;";
+				break;
+			case '\'':
+				if (!attribute) {
+					continue;
+				}
+
+				escaped = "&#39;";
+				break;
+			default:
+				continue;
+		}
+
+		rb_str_buf_cat(out, src + start, i - start);
+		rb_str_buf_cat_ascii(out, escaped);
+		start = i + 1;
+	}
+
+	rb_str_buf_cat(out, src + start, to - start);
+}
+
+/*
+ * If a character reference like "&amp;", "&#39;", or "&#x27;" starts at i,
+ * return its length, otherwise 0.
+ */
+static size_t entity_length(const char *src, size_t i, size_t len) {
+	size_t j = i + 1;
+	size_t start;
+
+	if (j < len && src[j] == '#') {
+		j++;
+
+		if (j < len && (src[j] == 'x' || src[j] == 'X')) {
+			j++;
+			start = j;
+
+			while (j < len && j - start < 6 && (digit_p(src[j]) || (lowercase(src[j]) >= 'a' && lowercase(src[j]) <= 'f'))) {
+				j++;
+			}
+		} else {
+			start = j;
+
+			while (j < len && j - start < 7 && digit_p(src[j])) {
+				j++;
+			}
+		}
+	} else {
+		start = j;
+
+		while (j < len && j - start < 32 && (alpha_p(src[j]) || (j > start && digit_p(src[j])))) {
+			j++;
+		}
+	}
+
+	if (j > start && j < len && src[j] == ';') {
+		return j - i + 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Find the end of a case-insensitive needle in src starting at i, returning
+ * len if it isn't found.
+ */
+static size_t skip_past(const char *src, size_t i, size_t len, const char *needle) {
+	size_t nlen = strlen(needle);
+
+	for (; i + nlen <= len; i++) {
+		size_t j = 0;
+
+		while (j < nlen && lowercase(src[i + j]) == needle[j]) {
+			j++;
+		}
+
+		if (j == nlen) {
+			return i + nlen;
+		}
+	}
+
+	return len;
+}
+
+/*
+ * Read a tag or attribute name starting at i into a lowercase buffer. Returns
+ * the index after the name. If the name is too long to be in an allowlist
+ * *len is set to 0.
+ */
+static size_t read_name(const char *src, size_t i, size_t len, char *name, size_t *namelen, bool attribute) {
+	size_t n = 0;
+	bool overflow = false;
+
+	while (i < len && !space_p(src[i]) && src[i] != '>' && src[i] != '/' && (!attribute || src[i] != '=')) {
+		if (n < SANITIZER_MAX_NAME) {
+			name[n++] = lowercase(src[i]);
+		} else {
+			overflow = true;
+		}
+
+		i++;
+	}
+
+	*namelen = overflow ? 0 : n;
+
+	return i;
+}
+
+/*
+ * Whether a URL attribute value uses one of the allowed protocols. URLs without
+ * a protocol, i.e. relative URLs, are always allowed.
+ */
+static bool protocol_allowed_p(const sanitizer_names *protocols, const char *value, size_t len) {
+	char scheme[SANITIZER_MAX_NAME];
+	size_t n = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		unsigned char c = value[i];
+
+		/* Browsers ignore whitespace and control characters in protocols. */
+		if (c <= 0x20 || c == 0x7f) {
+			continue;
+		}
+
+		if (c == ':') {
+			return names_index(protocols, scheme, n) >= 0;
+		}
+
+		if (c == '/' || c == '?' || c == '#') {
+			return true;
+		}
+
+		/* Anything else, like an entity hiding the protocol, is rejected. */
+		if (!(alpha_p(c) || digit_p(c) || c == '+' || c == '-' || c == '.') || n == SANITIZER_MAX_NAME) {
+			return false;
+		}
+
+		scheme[n++] = lowercase(c);
+	}
+
+	return true;
+}
+
+static void append_attribute(VALUE out, const sanitizer_policy *policy, long element, sanitizer_attribute *attr) {
+	char name[SANITIZER_MAX_NAME];
+	size_t namelen = 0;
+
+	read_name(attr->name, 0, attr->namelen, name, &namelen, true);
+
+	if (namelen == 0) {
+		return;
+	}
+
+	if (names_index(&policy->attributes[element], name, namelen) < 0 && names_index(&policy->global, name, namelen) < 0) {
+		return;
+	}
+
+	long url = names_index(&policy->urls, name, namelen);
+
+	if (url >= 0 && attr->has_value && !protocol_allowed_p(&policy->protocols[url], attr->value, attr->vallen)) {
+		return;
+	}
+
+	rb_str_buf_cat_ascii(out, " ");
+	rb_str_buf_cat(out, name, namelen);
+
+	if (attr->has_value) {
+		rb_str_buf_cat_ascii(out, "=\"");
+		append_escaped(out, attr->value, 0, attr->vallen, true);
+		rb_str_buf_cat_ascii(out, "\"");
+	}
+}
+
+/*
+ * Parse the attributes of a start tag beginning at i, appending the allowed
+ * ones if the element is allowed. Returns the index after the closing ">" or
+ * len if the tag is never closed.
+ */
+static size_t parse_attributes(VALUE out, const sanitizer_policy *policy, long element, const char *src, size_t i, size_t len, bool *closed) {
+	*closed = false;
+
+	while (i < len) {
+		while (i < len && (space_p(src[i]) || src[i] == '/')) {
+			i++;
+		}
+
+		if (i >= len) {
+			break;
+		}
+
+		if (src[i] == '>') {
+			*closed = true;
+			return i + 1;
+		}
+
+		sanitizer_attribute attr = { src + i, 0, NULL, 0, false };
+
+		/* A leading "=" is part of the name, per the spec. */
+		size_t start = i++;
+
+		while (i < len && !space_p(src[i]) && src[i] != '>' && src[i] != '/' && src[i] != '=') {
+			i++;
+		}
+
+		attr.namelen = i - start;
+
+		while (i < len && space_p(src[i])) {
+			i++;
+		}
+
+		if (i < len && src[i] == '=') {
+			i++;
+
+			while (i < len && space_p(src[i])) {
+				i++;
+			}
+
+			attr.has_value = true;
+
+			if (i < len && (src[i] == '"' || src[i] == '\'')) {
+				char quote = src[i++];
+				const char *end = memchr(src + i, quote, len - i);
+
+				if (end == NULL) {
+					return len;
+				}
+
+				attr.value = src + i;
+				attr.vallen = end - (src + i);
+				i = end - src + 1;
+			} else {
+				start = i;
+
+				while (i < len && !space_p(src[i]) && src[i] != '>') {
+					i++;
+				}
+
+				attr.value = src + start;
+				attr.vallen = i - start;
+			}
+		}
+
+		if (element >= 0) {
+			append_attribute(out, policy, element, &attr);
+		}
+	}
+
+	return len;
+}
+
+static void append_end_tag(VALUE out, const sanitizer_policy *policy, long element) {
+	rb_str_buf_cat_ascii(out, "</");
+	rb_str_buf_cat(out, policy->elements.items[element], policy->elements.lengths[element]);
+	rb_str_buf_cat_ascii(out, ">");
+}
+
+static VALUE sanitize(const sanitizer_policy *policy, const char *src, size_t len) {
+	VALUE out = safestring_buffer(NULL, len);
+	rb_str_set_len(out, 0);
+
+	long stack[SANITIZER_MAX_DEPTH];
+	size_t depth = 0;
+	size_t text = 0;
+	size_t i = 0;
+
+	char name[SANITIZER_MAX_NAME];
+	size_t namelen;
+
+	while (i < len) {
+		const char *lt = memchr(src + i, '<', len - i);
+
+		if (lt == NULL) {
+			break;
+		}
+
+		i = lt - src;
+		append_escaped(out, src, text, i, false);
+
+		bool end_tag = i + 1 < len && src[i + 1] == '/';
+		size_t start = end_tag ? i + 2 : i + 1;
+
+		if (start < len && src[start] == '!' && !end_tag) {
+			/* Comments, doctypes, and CDATA sections are all removed. */
+			if (start + 2 < len && src[start + 1] == '-' && src[start + 2] == '-') {
+				i = skip_past(src, start + 3, len, "-->");
+			} else {
+				i = skip_past(src, start, len, ">");
+			}
+		} else if (start < len && src[start] == '?' && !end_tag) {
+			i = skip_past(src, start, len, ">");
+		} else if (start < len && alpha_p(src[start])) {
+			i = read_name(src, start, len, name, &namelen, false);
+
+			long element = namelen > 0 ? names_index(&policy->elements, name, namelen) : -1;
+			bool dropped = namelen > 0 && list_p(dropped_elements, COUNT(dropped_elements), name, namelen);
+
+			if (dropped) {
+				element = -1;
+			}
+
+			if (end_tag) {
+				i = skip_past(src, i, len, ">");
+
+				for (size_t d = depth; element >= 0 && d > 0; d--) {
+					if (stack[d - 1] == element) {
+						while (depth >= d) {
+							append_end_tag(out, policy, stack[--depth]);
+						}
+
+						break;
+					}
+				}
+			} else {
+				bool closed;
+				bool emit = element >= 0 && (policy->voids[element] || depth < SANITIZER_MAX_DEPTH);
+				size_t mark = RSTRING_LEN(out);
+
+				if (emit) {
+					rb_str_buf_cat_ascii(out, "<");
+					rb_str_buf_cat(out, policy->elements.items[element], policy->elements.lengths[element]);
+				}
+
+				i = parse_attributes(out, policy, emit ? element : -1, src, i, len, &closed);
+
+				if (!closed) {
+					/* An unclosed tag at the end of the input is dropped entirely. */
+					rb_str_set_len(out, mark);
+				} else if (emit) {
+					rb_str_buf_cat_ascii(out, ">");
+
+					if (!policy->voids[element]) {
+						stack[depth++] = element;
+					}
+				}
+
+				if (closed && dropped) {
+					/* Skip the content and the end tag, e.g. </script>. */
+					char closing[SANITIZER_MAX_NAME + 3] = "</";
+
+					memcpy(closing + 2, name, namelen);
+					closing[namelen + 2] = '\0';
+
+					i = skip_past(src, i, len, closing);
+					i = skip_past(src, i, len, ">");
+				}
+			}
+		} else {
+			/* Not markup at all, so this is a literal "<". */
+			rb_str_buf_cat_ascii(out, "&lt;");
+			i++;
+		}
+
+		text = i;
+	}
+
+	if (text < len) {
+		append_escaped(out, src, text, len, false);
+	}
+
+	while (depth > 0) {
+		append_end_tag(out, policy, stack[--depth]);
+	}
+
+	return rb_obj_freeze(out);
+}
+
+/*
+ * Berns::Sanitizer#compile
+ *
+ * Replaces the policy with the given lowercase allowlists. attributes is an
+ * Array of Arrays of attribute names, one for each element, and protocols is a
+ * Hash of URL attribute names to the protocols they allow.
+ */
+static VALUE sanitizer_compile(VALUE self, VALUE elements, VALUE attributes, VALUE global, VALUE protocols) {
+	sanitizer_policy *policy;
+
+	rb_check_frozen(self);
+	TypedData_Get_Struct(self, sanitizer_policy, &policy_type, policy);
+
+	Check_Type(elements, T_ARRAY);
+	Check_Type(attributes, T_ARRAY);
+	Check_Type(protocols, T_HASH);
+
+	if (RARRAY_LEN(attributes) != RARRAY_LEN(elements)) {
+		rb_raise(rb_eArgError, "Berns::Sanitizer needs one list of attributes per element.");
+	}
+
+	policy_clear(policy);
+
+	names_from_array(&policy->elements, elements);
+	names_from_array(&policy->global, global);
+	names_from_array(&policy->urls, rb_funcall(protocols, rb_intern("keys"), 0));
+
+	policy->voids = ALLOC_N(bool, policy->elements.count);
+	policy->attributes = ZALLOC_N(sanitizer_names, policy->elements.count);
+	policy->protocols = ZALLOC_N(sanitizer_names, policy->urls.count);
+
+	for (size_t i = 0; i < policy->elements.count; i++) {
+		policy->voids[i] = list_p(void_elements, COUNT(void_elements), policy->elements.items[i], policy->elements.lengths[i]);
+		names_from_array(&policy->attributes[i], RARRAY_AREF(attributes, i));
+	}
+
+	for (size_t i = 0; i < policy->urls.count; i++) {
+		VALUE url = rb_str_new(policy->urls.items[i], policy->urls.lengths[i]);
+		names_from_array(&policy->protocols[i], rb_hash_aref(protocols, url));
+	}
+
+	return self;
+}
+
+/*
+ * Berns::Sanitizer#sanitize
+ *
+ * string should be a string or nil, anything else will raise an error.
+ * Sanitized output is a frozen Berns::SafeString, so it isn't escaped again,
+ * but strings without markup or entities are returned as-is like escape_html.
+ */
+static VALUE sanitizer_sanitize(VALUE self, VALUE string) {
+	sanitizer_policy *policy;
+
+	if (NIL_P(string)) {
+		return Qnil;
+	}
+
+	Check_Type(string, T_STRING);
+	TypedData_Get_Struct(self, sanitizer_policy, &policy_type, policy);
+
+	const char *src = RSTRING_PTR(string);
+	size_t len = RSTRING_LEN(string);
+
+	/* Without markup or entities there's nothing to do. */
+	if (memchr(src, '<', len) == NULL && memchr(src, '>', len) == NULL && memchr(src, '&', len) == NULL) {
+		return string;
+	}
+
+	VALUE result = sanitize(policy, src, len);
+	RB_GC_GUARD(string);
+
+	return result;
+}
+
+VALUE sanitizer_define(VALUE module) {
+	VALUE klass = rb_define_class_under(module, "Sanitizer", rb_cObject);
+
+	rb_define_alloc_func(klass, policy_alloc);
+	rb_define_private_method(klass, "compile", sanitizer_compile, 4);
+	rb_define_method(klass, "sanitize", sanitizer_sanitize, 1);
+
+	return klass;
+}
@@ -0,0 +1,16 @@
+#ifndef SANITIZER_H
+#define SANITIZER_H
+
+#include "ruby.h"
+
+/*
+ * Define the Berns::Sanitizer class under the given module and return it.
+ *
+ * Instances hold a compiled allowlist of elements, attributes, and URL
+ * protocols and sanitize HTML against it in a single pass without building a
+ * DOM. Allowed markup is re-serialized, disallowed tags are dropped while
+ * keeping their text, and everything else is escaped.
+ */
+extern VALUE sanitizer_define(VALUE module);
+
+#endif
@@ -0,0 +1,104 @@
+#include "stats.h"
+
+#ifdef BERNS_STATS
+/*
+ * Room for a counter per call site, which is a few per function and one per
+ * element method. Call sites past the limit still count but aren't reported.
+ */
+#define STATS_MAX_COUNTERS 512
+
+stats_totals stats;
+
+static stats_counter *counters[STATS_MAX_COUNTERS];
+static size_t counters_length = 0;
+
+void stats_register(stats_counter *counter) {
+	counter->registered = true;
+
+	if (counters_length < STATS_MAX_COUNTERS) {
+		counters[counters_length++] = counter;
+	}
+}
+
+static VALUE stats_entry(VALUE methods, const stats_counter *counter) {
+	VALUE key = ID2SYM(rb_intern(counter->name));
+	VALUE entry = rb_hash_aref(methods, key);
+
+	if (NIL_P(entry)) {
+		entry = rb_hash_new();
+		rb_hash_aset(entry, ID2SYM(rb_intern("calls")), INT2FIX(0));
+		rb_hash_aset(entry, ID2SYM(rb_intern("bytes_in")), INT2FIX(0));
+		rb_hash_aset(entry, ID2SYM(rb_intern("bytes_out")), INT2FIX(0));
+		rb_hash_aset(methods, key, entry);
+	}
+
+	return entry;
+}
+
+static void stats_add(VALUE entry, const char *name, size_t count) {
+	VALUE key = ID2SYM(rb_intern(name));
+
+	rb_hash_aset(entry, key, rb_funcall(rb_hash_aref(entry, key), '+', 1, SIZET2NUM(count)));
+}
+
+/*
+ * Berns.stats
+ */
+static VALUE stats_external(RB_UNUSED_VAR(VALUE self)) {
+	VALUE result = rb_hash_new();
+	VALUE methods = rb_hash_new();
+	VALUE escapes = rb_hash_new();
+
+	for (size_t i = 0; i < counters_length; i++) {
+		const stats_counter *counter = counters[i];
+
+		if (counter->calls == 0) {
+			continue;
+		}
+
+		VALUE entry = stats_entry(methods, counter);
+
+		stats_add(entry, "calls", counter->calls);
+		stats_add(entry, "bytes_in", counter->bytes_in);
+		stats_add(entry, "bytes_out", counter->bytes_out);
+	}
+
+	rb_hash_aset(escapes, ID2SYM(rb_intern("clean")), SIZET2NUM(stats.escapes_clean));
+	rb_hash_aset(escapes, ID2SYM(rb_intern("modified")), SIZET2NUM(stats.escapes_modified));
+
+	rb_hash_aset(result, ID2SYM(rb_intern("methods")), methods);
+	rb_hash_aset(result, ID2SYM(rb_intern("escapes")), escapes);
+	rb_hash_aset(result, ID2SYM(rb_intern("allocations")), SIZET2NUM(stats.allocations));
+	rb_hash_aset(result, ID2SYM(rb_intern("reallocations")), SIZET2NUM(stats.reallocations));
+
+	return result;
+}
+
+/*
+ * Berns.reset_stats
+ */
+static VALUE stats_reset_external(RB_UNUSED_VAR(VALUE self)) {
+	for (size_t i = 0; i < counters_length; i++) {
+		counters[i]->calls = 0;
+		counters[i]->bytes_in = 0;
+		counters[i]->bytes_out = 0;
+	}
+
+	memset(&stats, 0, sizeof(stats));
+
+	return Qnil;
+}
+#else
+static VALUE stats_external(RB_UNUSED_VAR(VALUE self)) {
+	return Qnil;
+}
+
+static VALUE stats_reset_external(RB_UNUSED_VAR(VALUE self)) {
+	return Qnil;
+}
+#endif
+
+void stats_define(VALUE module) {
+	rb_define_singleton_method(module, "reset_stats", stats_reset_external, 0);
+	rb_define_singleton_method(module, "stats", stats_external, 0);
+}
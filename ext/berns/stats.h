@@ -0,0 +1,67 @@
+#ifndef STATS_H
+#define STATS_H
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ruby.h"
+
+/*
+ * Counters for one call site of an external function. Each is registered the
+ * first time it's recorded, and call sites sharing a name, like the different
+ * returns of one function, are summed when read.
+ */
+typedef struct {
+	const char *name;
+	bool registered;
+	size_t calls;
+	size_t bytes_in;
+	size_t bytes_out;
+} stats_counter;
+
+/*
+ * Counters that aren't tied to a single function.
+ */
+typedef struct {
+	size_t escapes_clean;
+	size_t escapes_modified;
+	size_t allocations;
+	size_t reallocations;
+} stats_totals;
+
+/*
+ * Define Berns.stats and Berns.reset_stats on the given module. Both return nil
+ * unless the extension was built with --enable-stats.
+ */
+extern void stats_define(VALUE module);
+
+/*
+ * With BERNS_STATS undefined, recording compiles to nothing and none of the
+ * arguments are evaluated, so they must not have side effects.
+ *
+ * Every counter is only touched while holding the GVL, and the extension only
+ * runs on the main Ractor, so plain increments are enough.
+ */
+#ifdef BERNS_STATS
+extern stats_totals stats;
+extern void stats_register(stats_counter *counter);
+
+#define STATS_RECORD(function, in, out) \
+	do { \
+		static stats_counter stats_counter_ = { function, false, 0, 0, 0 }; \
+		\
+		if (RB_UNLIKELY(!stats_counter_.registered)) { \
+			stats_register(&stats_counter_); \
+		} \
+		\
+		stats_counter_.calls++; \
+		stats_counter_.bytes_in += (in); \
+		stats_counter_.bytes_out += (out); \
+	} while (0)
+
+#define STATS_COUNT(total, count) (stats.total += (count))
+#else
+#define STATS_RECORD(function, in, out) ((void) 0)
+#define STATS_COUNT(total, count) ((void) 0)
+#endif
+
+#endif
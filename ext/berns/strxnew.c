@@ -1,8 +1,11 @@
 #include "ruby.h"
+#include "stats.h"
 #include "strxnew.h"
 
 char * strxnew(size_t size) {
 	char *string = ruby_xmalloc(size);
 
+	STATS_COUNT(allocations, 1);
+
 	return string;
 }
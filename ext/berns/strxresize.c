@@ -1,6 +1,9 @@
 #include "ruby.h"
+#include "stats.h"
 #include "strxresize.h"
 
 char * strxresize(char * memory, size_t size) {
+	STATS_COUNT(reallocations, 1);
+
 	return ruby_xrealloc(memory, size);
 }
@@ -0,0 +1,94 @@
+/* clock_gettime and CLOCK_MONOTONIC, which -std=c99 leaves out. */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <time.h>
+
+#include "histogram.h"
+#include "timing.h"
+
+static ID id_bytes;
+static ID id_exclusive;
+static ID id_inclusive;
+static ID id_nested;
+
+static uint64_t timing_clock(void) {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+/*
+ * The fiber-local total of nanoseconds spent in completed named renders. Each
+ * render reads it when it starts and, when it's done, replaces whatever its
+ * nested renders added with its own inclusive time, so the difference a render
+ * sees is the time spent in the named renders directly inside it.
+ */
+static uint64_t timing_nested_total(void) {
+	VALUE total = rb_thread_local_aref(rb_thread_current(), id_nested);
+
+	return NIL_P(total) ? 0 : NUM2ULL(total);
+}
+
+static histogram * timing_histogram(VALUE self, ID name) {
+	return histogram_get(rb_ivar_get(self, name));
+}
+
+/*
+ * Berns::Timing.now
+ *
+ * The monotonic clock in nanoseconds, read when a render starts and passed to
+ * #record when it's done.
+ */
+static VALUE timing_now(RB_UNUSED_VAR(VALUE klass)) {
+	return ULL2NUM(timing_clock());
+}
+
+/*
+ * Berns::Timing.nested
+ *
+ * The fiber's nested total, read when a render starts and passed to #record
+ * when it's done.
+ */
+static VALUE timing_nested(RB_UNUSED_VAR(VALUE klass)) {
+	return ULL2NUM(timing_nested_total());
+}
+
+/*
+ * Berns::Timing#record
+ *
+ * Record a render that started at the given clock reading and nested total and
+ * produced size bytes of output.
+ */
+static VALUE timing_record(VALUE self, VALUE started, VALUE nested, VALUE size) {
+	uint64_t now = timing_clock();
+	uint64_t start = NUM2ULL(started);
+	uint64_t before = NUM2ULL(nested);
+	uint64_t elapsed = now > start ? now - start : 0;
+	uint64_t inner = timing_nested_total() - before;
+
+	rb_thread_local_aset(rb_thread_current(), id_nested, ULL2NUM(before + elapsed));
+
+	histogram_add(timing_histogram(self, id_inclusive), elapsed);
+	histogram_add(timing_histogram(self, id_exclusive), elapsed > inner ? elapsed - inner : 0);
+	histogram_add(timing_histogram(self, id_bytes), NUM2ULL(size));
+
+	return Qnil;
+}
+
+VALUE timing_define(VALUE module) {
+	VALUE klass = rb_define_class_under(module, "Timing", rb_cObject);
+
+	id_bytes = rb_intern("@bytes");
+	id_exclusive = rb_intern("@exclusive");
+	id_inclusive = rb_intern("@inclusive");
+	id_nested = rb_intern("__berns_timing_nested");
+
+	rb_define_singleton_method(klass, "nested", timing_nested, 0);
+	rb_define_singleton_method(klass, "now", timing_now, 0);
+	rb_define_method(klass, "record", timing_record, 3);
+
+	return klass;
+}
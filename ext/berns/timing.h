@@ -0,0 +1,14 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include "ruby.h"
+
+/*
+ * Define the native parts of the Berns::Timing class under the given module,
+ * which is otherwise defined in lib/berns/timing.rb, and return it. These are
+ * the clock and nesting reads each named render makes when it starts, and the
+ * histogram updates it makes when it's done.
+ */
+extern VALUE timing_define(VALUE module);
+
+#endif
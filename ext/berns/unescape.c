@@ -0,0 +1,251 @@
+#include <string.h>
+
+#include "entities.h"
+#include "unescape.h"
+
+#ifdef __SSE4_2__
+# ifdef _MSC_VER
+#  include <nmmintrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+#endif
+
+/*
+ * What the C1 control characters 0x80 through 0x9F decode to when they're
+ * written as numeric references, since pages that use them almost always mean
+ * Windows-1252. Zero means the codepoint is left alone.
+ */
+static const uint16_t windows_1252[32] = {
+	0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+	0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+	0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+	0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178,
+};
+
+static inline bool alnum_p(uint8_t c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+static inline int hex_value(uint8_t c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	} else if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	} else if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	}
+
+	return -1;
+}
+
+/*
+ * FNV-1a, seeded so names that collide in one seed can be separated by
+ * another. This has to match the hash in the Rakefile's entities task.
+ */
+static inline uint32_t entity_hash(const uint8_t *name, size_t length, uint32_t seed) {
+	uint32_t hash = 0x811c9dc5 ^ seed;
+
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ name[i]) * 0x01000193;
+	}
+
+	return hash;
+}
+
+/*
+ * Look up a named reference, with its semicolon if it has one, returning its
+ * entry or NULL if there's no such name.
+ */
+static const entity * entity_find(const uint8_t *name, size_t length) {
+	uint16_t seed = entity_displacements[entity_hash(name, length, 0) % ENTITY_BUCKETS];
+
+	if (seed == 0) {
+		return NULL;
+	}
+
+	const entity *found = &entity_table[entity_hash(name, length, seed) % ENTITY_SLOTS];
+
+	if (found->length == length && memcmp(entity_names + found->name, name, length) == 0) {
+		return found;
+	}
+
+	return NULL;
+}
+
+/*
+ * Encode a codepoint as UTF-8, returning the number of bytes written.
+ */
+static size_t utf8_encode(uint8_t *dest, uint32_t codepoint) {
+	if (codepoint < 0x80) {
+		dest[0] = codepoint;
+		return 1;
+	} else if (codepoint < 0x800) {
+		dest[0] = 0xC0 | (codepoint >> 6);
+		dest[1] = 0x80 | (codepoint & 0x3F);
+		return 2;
+	} else if (codepoint < 0x10000) {
+		dest[0] = 0xE0 | (codepoint >> 12);
+		dest[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+		dest[2] = 0x80 | (codepoint & 0x3F);
+		return 3;
+	}
+
+	dest[0] = 0xF0 | (codepoint >> 18);
+	dest[1] = 0x80 | ((codepoint >> 12) & 0x3F);
+	dest[2] = 0x80 | ((codepoint >> 6) & 0x3F);
+	dest[3] = 0x80 | (codepoint & 0x3F);
+	return 4;
+}
+
+/*
+ * Decode a numeric reference starting at the "&#" at src into dest. Returns
+ * the number of bytes of src it used, or zero if there are no digits.
+ *
+ * The semicolon is optional, and codepoints that can't be encoded, like zero,
+ * surrogates, and anything past U+10FFFF, become U+FFFD.
+ */
+static size_t decode_numeric(uint8_t *dest, const uint8_t *src, size_t size, size_t *written) {
+	size_t i = 2;
+	size_t start;
+	uint32_t codepoint = 0;
+
+	if (i < size && (src[i] == 'x' || src[i] == 'X')) {
+		int digit;
+
+		start = ++i;
+
+		while (i < size && (digit = hex_value(src[i])) >= 0) {
+			codepoint = codepoint > 0x10FFFF ? codepoint : codepoint * 16 + digit;
+			i++;
+		}
+	} else {
+		start = i;
+
+		while (i < size && src[i] >= '0' && src[i] <= '9') {
+			codepoint = codepoint > 0x10FFFF ? codepoint : codepoint * 10 + (src[i] - '0');
+			i++;
+		}
+	}
+
+	if (i == start) {
+		return 0;
+	}
+
+	if (i < size && src[i] == ';') {
+		i++;
+	}
+
+	if (codepoint == 0 || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+		codepoint = 0xFFFD;
+	} else if (codepoint >= 0x80 && codepoint <= 0x9F && windows_1252[codepoint - 0x80]) {
+		codepoint = windows_1252[codepoint - 0x80];
+	}
+
+	*written = utf8_encode(dest, codepoint);
+
+	return i;
+}
+
+/*
+ * Decode a named reference starting at the "&" at src into dest. Returns the
+ * number of bytes of src it used, or zero if it isn't one.
+ *
+ * Like browsers, a name without a semicolon decodes the longest legacy name it
+ * starts with, so "&copy2024" is "©2024".
+ */
+static size_t decode_named(uint8_t *dest, const uint8_t *src, size_t size, size_t *written) {
+	const uint8_t *name = src + 1;
+	size_t limit = size - 1 < ENTITY_MAX_LENGTH ? size - 1 : ENTITY_MAX_LENGTH;
+	size_t length = 0;
+	const entity *found = NULL;
+
+	while (length < limit && alnum_p(name[length])) {
+		length++;
+	}
+
+	if (length > 0 && length < limit && name[length] == ';') {
+		found = entity_find(name, ++length);
+	}
+
+	if (found == NULL) {
+		if (length > ENTITY_LEGACY_MAX_LENGTH) {
+			length = ENTITY_LEGACY_MAX_LENGTH;
+		}
+
+		for (; length > 1 && found == NULL; length--) {
+			found = entity_find(name, length);
+		}
+
+		if (found == NULL) {
+			return 0;
+		}
+
+		length++;
+	}
+
+	memcpy(dest, found->value, found->size);
+	*written = found->size;
+
+	return length + 1;
+}
+
+size_t unescape_find(const uint8_t *src, size_t i, size_t size) {
+#ifdef __SSE4_2__
+	const __m128i ampersand = _mm_setr_epi8('&', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+	while (i + 16 <= size) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (src + i));
+		int index = _mm_cmpestri(ampersand, 1, chunk, 16, _SIDD_CMP_EQUAL_ANY);
+
+		if (index != 16) {
+			return i + index;
+		}
+
+		i += 16;
+	}
+#endif
+
+	const uint8_t *found = i < size ? memchr(src + i, '&', size - i) : NULL;
+
+	return found ? (size_t) (found - src) : size;
+}
+
+size_t unescape_html(uint8_t *dest, const uint8_t *src, size_t size, bool *modified) {
+	size_t index = 0;
+	size_t i = 0;
+
+	*modified = false;
+
+	while (i < size) {
+		size_t next = unescape_find(src, i, size);
+
+		memcpy(dest + index, src + i, next - i);
+		index += next - i;
+		i = next;
+
+		if (i == size) {
+			break;
+		}
+
+		size_t written = 0;
+		size_t used;
+
+		if (i + 1 < size && src[i + 1] == '#') {
+			used = decode_numeric(dest + index, src + i, size - i, &written);
+		} else {
+			used = decode_named(dest + index, src + i, size - i, &written);
+		}
+
+		if (used == 0) {
+			dest[index++] = '&';
+			i++;
+		} else {
+			*modified = true;
+			index += written;
+			i += used;
+		}
+	}
+
+	return index;
+}
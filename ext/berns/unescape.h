@@ -0,0 +1,30 @@
+#ifndef UNESCAPE_H
+#define UNESCAPE_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The most bytes unescaping size bytes can produce. A few named references
+ * decode to more bytes than they're written in, at most six bytes for five.
+ */
+#define UNESCAPE_MAX_SIZE(size) ((size) + (size) / 5 + 1)
+
+/*
+ * Return the offset of the first "&" in src at or after i, or size if there is
+ * none, in which case there's nothing to unescape.
+ */
+extern size_t unescape_find(const uint8_t *src, size_t i, size_t size);
+
+/*
+ * Copy src into dest, decoding named, decimal, and hexadecimal character
+ * references to UTF-8 the way HTML does in text. Anything that isn't a
+ * reference, like a bare "&", is copied as-is. dest must hold at least
+ * UNESCAPE_MAX_SIZE(size) bytes and must not overlap src.
+ *
+ * Returns the length written to dest and sets modified to whether it differs
+ * from src.
+ */
+extern size_t unescape_html(uint8_t *dest, const uint8_t *src, size_t size, bool *modified);
+
+#endif
@@ -0,0 +1,233 @@
+#include <string.h>
+
+#include "whitespace.h"
+
+#ifdef __SSE4_2__
+# ifdef _MSC_VER
+#  include <nmmintrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+#endif
+
+/*
+ * Elements whose whitespace is significant, along with their closing tags.
+ */
+static const char *preserved[][2] = {
+	{ "pre", "</pre" },
+	{ "script", "</script" },
+	{ "style", "</style" },
+	{ "textarea", "</textarea" },
+};
+
+static inline bool ws_p(uint8_t c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static inline uint8_t lowercase(uint8_t c) {
+	return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+/*
+ * Find the offset of the first "<" or whitespace at or after i.
+ */
+static size_t next_special(const uint8_t *src, size_t i, size_t size) {
+#ifdef __SSE4_2__
+	const __m128i specials = _mm_setr_epi8('<', ' ', '\t', '\n', '\r', '\f', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+	while (i + 16 <= size) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (src + i));
+		int index = _mm_cmpestri(specials, 6, chunk, 16, _SIDD_CMP_EQUAL_ANY);
+
+		if (index != 16) {
+			return i + index;
+		}
+
+		i += 16;
+	}
+#endif
+
+	while (i < size && src[i] != '<' && !ws_p(src[i])) {
+		i++;
+	}
+
+	return i;
+}
+
+size_t ws_collapsible(const uint8_t *src, size_t size) {
+	size_t i = 0;
+
+#ifdef __SSE4_2__
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i others = _mm_setr_epi8('\t', '\n', '\r', '\f', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+	unsigned previous = 0;
+
+	while (i + 16 <= size) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (src + i));
+
+		/* Any tab, newline, and so on can be collapsed. */
+		if (_mm_cmpestri(others, 4, chunk, 16, _SIDD_CMP_EQUAL_ANY) != 16) {
+			break;
+		}
+
+		/* As can a space following a space, including across chunks. */
+		unsigned spaces = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, space));
+
+		if ((spaces & ((spaces << 1) | previous)) != 0) {
+			break;
+		}
+
+		previous = spaces >> 15;
+		i += 16;
+	}
+
+	/* Back up so the scalar loop sees a space that ended the last chunk. */
+	if (i > 0) {
+		i--;
+	}
+#endif
+
+	for (; i < size; i++) {
+		if (ws_p(src[i]) && (src[i] != ' ' || (i + 1 < size && ws_p(src[i + 1])))) {
+			return i;
+		}
+	}
+
+	return size;
+}
+
+/*
+ * Find the end of the tag starting at i, skipping over quoted attribute values.
+ * Returns size if the tag is never closed.
+ */
+static size_t tag_end(const uint8_t *src, size_t i, size_t size) {
+	uint8_t quote = 0;
+
+	for (i++; i < size; i++) {
+		if (quote) {
+			if (src[i] == quote) {
+				quote = 0;
+			}
+		} else if (src[i] == '"' || src[i] == '\'') {
+			quote = src[i];
+		} else if (src[i] == '>') {
+			return i + 1;
+		}
+	}
+
+	return size;
+}
+
+/*
+ * Find a case-insensitive needle at or after i, returning its offset or size.
+ */
+static size_t find(const uint8_t *src, size_t i, size_t size, const char *needle) {
+	size_t nlen = strlen(needle);
+
+	for (; i + nlen <= size; i++) {
+		const uint8_t *first = memchr(src + i, needle[0], size - i);
+
+		if (first == NULL) {
+			break;
+		}
+
+		i = first - src;
+
+		if (i + nlen > size) {
+			break;
+		}
+
+		size_t j = 1;
+
+		while (j < nlen && lowercase(src[i + j]) == (uint8_t) needle[j]) {
+			j++;
+		}
+
+		if (j == nlen) {
+			return i;
+		}
+	}
+
+	return size;
+}
+
+/*
+ * If a start tag for a preserved element begins at i, return its closing tag.
+ */
+static const char * preserved_closing(const uint8_t *src, size_t i, size_t size) {
+	for (size_t p = 0; p < sizeof(preserved) / sizeof(preserved[0]); p++) {
+		const char *name = preserved[p][0];
+		size_t nlen = strlen(name);
+		size_t j = 0;
+
+		if (i + 1 + nlen >= size) {
+			continue;
+		}
+
+		while (j < nlen && lowercase(src[i + 1 + j]) == (uint8_t) name[j]) {
+			j++;
+		}
+
+		uint8_t after = src[i + 1 + nlen];
+
+		if (j == nlen && (ws_p(after) || after == '>' || after == '/')) {
+			return preserved[p][1];
+		}
+	}
+
+	return NULL;
+}
+
+size_t ws_collapse(uint8_t *dest, const uint8_t *src, size_t size, bool *modified) {
+	size_t index = 0;
+	size_t i = 0;
+
+	*modified = false;
+
+	while (i < size) {
+		size_t next = next_special(src, i, size);
+
+		memmove(dest + index, src + i, next - i);
+		index += next - i;
+		i = next;
+
+		if (i == size) {
+			break;
+		}
+
+		if (src[i] == '<') {
+			size_t end;
+
+			if (i + 3 < size && src[i + 1] == '!' && src[i + 2] == '-' && src[i + 3] == '-') {
+				end = find(src, i + 4, size, "-->");
+				end = end + 3 < size ? end + 3 : size;
+			} else {
+				const char *closing = preserved_closing(src, i, size);
+
+				end = tag_end(src, i, size);
+
+				if (closing) {
+					end = find(src, end, size, closing);
+				}
+			}
+
+			memmove(dest + index, src + i, end - i);
+			index += end - i;
+			i = end;
+		} else {
+			size_t start = i;
+
+			while (i < size && ws_p(src[i])) {
+				i++;
+			}
+
+			if (i - start > 1 || src[start] != ' ') {
+				*modified = true;
+			}
+
+			dest[index++] = ' ';
+		}
+	}
+
+	return index;
+}
@@ -0,0 +1,26 @@
+#ifndef WHITESPACE_H
+#define WHITESPACE_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Return the offset of the first whitespace that could be collapsed in src,
+ * i.e. a tab, newline, carriage return, or form feed, or a space followed by
+ * more whitespace, or size if there is none. This ignores markup, so it's only
+ * a quick check for whether ws_collapse could change anything.
+ */
+extern size_t ws_collapsible(const uint8_t *src, size_t size);
+
+/*
+ * Copy src into dest, collapsing each run of whitespace outside of tags into a
+ * single space. The contents of pre, textarea, script, and style elements,
+ * comments, and everything inside tags, like attribute values, are copied
+ * as-is. dest must be at least size bytes and may be the same as src.
+ *
+ * Returns the length written to dest and sets modified to whether it differs
+ * from src.
+ */
+extern size_t ws_collapse(uint8_t *dest, const uint8_t *src, size_t size, bool *modified);
+
+#endif
@@ -1,9 +1,13 @@
 # frozen_string_literal: true
 require 'berns/berns'
 require 'berns/version'
+require 'berns/sanitizer'
+require 'berns/timing'
 
 module Berns # :nodoc:
   autoload :Builder, 'berns/builder'
+  autoload :Component, 'berns/component'
+  autoload :Rope, 'berns/rope'
 
   STANDARD = %i[
     a abbr address article aside audio b bdi bdo blockquote body button canvas
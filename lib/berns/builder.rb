@@ -4,34 +4,132 @@ require 'berns'
 module Berns
   # An HTML builder DSL using Berns' HTML methods.
   class Builder
-    def initialize(&block)
+    autoload :Retained, 'berns/retained'
+
+    # Elements whose content is left alone when minifying.
+    PRESERVED = %i[pre script style textarea].freeze
+
+    # Renders smaller than this many bytes start from an empty buffer, since
+    # preallocating costs a few allocations of its own and small strings grow
+    # cheaply.
+    MIN_CAPACITY = 4096
+
+    # Each render's output starts as a Berns::SafeString with the contents of
+    # this, so it's trusted by Berns.escape_html and Rails without scanning it
+    # again.
+    EMPTY = Berns::SafeString.new('').freeze
+
+    # The digest of the last render when initialized with `digest: true`.
+    #
+    # @return [Berns::Digest, nil]
+    attr_reader :digest
+
+    # The number of bytes preallocated for the next render's output.
+    #
+    # @return [Integer]
+    attr_reader :capacity
+
+    # Render time and size histograms when initialized with a `name:`.
+    #
+    # @return [Berns::Timing, nil]
+    attr_reader :timing
+
+    # @param minify [Boolean] collapse runs of whitespace in text and raw content
+    #   to a single space, except inside PRESERVED elements
+    # @param digest [Boolean] hash the output as it's rendered, see #digest
+    # @param capacity [Integer, nil] bytes to preallocate for every render's
+    #   output, or nil to learn it from a moving maximum of recent renders
+    # @param rope [Boolean] return each render as a frozen Berns::Rope that
+    #   references large fragments instead of copying them, see Berns::Rope
+    # @param name [String, Symbol, nil] record every render's time and size under
+    #   this template name, see Berns::Timing
+    # @param retain [Boolean] reuse the output of slots whose inputs haven't
+    #   changed since the last render, see Berns::Builder::Retained
+    def initialize(minify: false, digest: false, capacity: nil, rope: false, name: nil, retain: false, &block)
       raise(ArgumentError, 'Berns::Builder initialized without a block argument', caller) unless block
 
       @block = block
+      @minify = minify
+      @collapse = minify
+      @digest = Berns::Digest.new if digest
+      @adaptive = capacity.nil?
+      @capacity = capacity || 0
+      @rope = rope
+      @timing = Berns::Timing[name] if name
+      @retain = retain
+      extend(Retained) if retain
     end
 
-    # @return [String]
+    # @return [String, Berns::Rope]
     def call(*args, **kwargs)
-      @buffer = +''
-      content = instance_exec(*args, **kwargs, &@block)
-
-      # This is a special case where the buffer hasn't been appended to but the
-      # block returned a string.
-      if @buffer.empty? && content.is_a?(String)
-        Berns.escape_html(content).freeze
-      else
-        @buffer.freeze
-      end
+      start
+      finish(instance_exec(*args, **kwargs, &@block))
     end
     alias to_s call
     alias to_str call
 
+    # Compile the block into a method on a generated subclass and return an
+    # instance of that subclass, which renders the same way but without
+    # instance_exec. When the block only takes required positional and keyword
+    # arguments, #call takes exactly those too, skipping the splatted argument
+    # Array and keyword Hash on every render.
+    #
+    # Compiled templates check their arguments like methods do, so missing
+    # positional arguments raise an ArgumentError instead of being nil.
+    #
+    # @return [Berns::Builder]
+    def compile
+      @compile ||= Builder.compiled_class(@block).new(minify: @minify, digest: !@digest.nil?, capacity: (@capacity unless @adaptive), rope: @rope, name: @timing&.name, retain: @retain, &@block)
+    end
+
+    # Generate a subclass of Berns::Builder with the block defined as its
+    # private #render method.
+    #
+    # @return [Class]
+    def self.compiled_class(block)
+      Class.new(self) do
+        define_method(:render, &block)
+        private :render
+
+        parameters = instance_method(:render).parameters
+
+        specialized = parameters.all? { |type, name| name && %i[req keyreq].include?(type) } && begin
+          signature = parameters.map { |type, name| type == :req ? name.to_s : "#{ name }:" }.join(', ')
+          arguments = parameters.map { |type, name| type == :req ? name.to_s : "#{ name }: #{ name }" }.join(', ')
+
+          class_eval <<~RUBY, __FILE__, __LINE__ + 1
+            def call(#{ signature })               # def call(name, title:)
+              start                                #   start
+              finish(render(#{ arguments }))       #   finish(render(name, title: title))
+            end                                    # end
+          RUBY
+
+          true
+        rescue SyntaxError
+          # Keyword arguments named after reserved words, like `class:`, can't
+          # be passed along by name.
+          false
+        end
+
+        unless specialized
+          def call(*args, **kwargs)
+            start
+            finish(render(*args, **kwargs))
+          end
+        end
+
+        alias_method :to_s, :call
+        alias_method :to_str, :call
+      end
+    end
+
     # Append HTML escaped text to the buffer.
     #
     # @param string [String]
     # @return [String]
     def text(string)
-      @buffer << Berns.escape_html(string.to_s)
+      string = Berns.escape_html(string.to_s)
+      @buffer << (@collapse ? collapse(string) : string)
     end
 
     # Append raw text to the buffer.
@@ -39,35 +137,175 @@ module Berns
     # @param string [String]
     # @return [String]
     def raw(string)
-      @buffer << string.to_s
+      @buffer << (@collapse ? collapse(string.to_s) : string.to_s)
+    end
+
+    # Append the output of a Berns::Component, which is a single append when it's
+    # already cached.
+    #
+    # @param component [Berns::Component]
+    # @return [String]
+    def component(component, *args, **kwargs)
+      @buffer << component.call(*args, **kwargs)
     end
 
     # Append an arbitrary standard element to the buffer.
     #
     # @return [String]
-    def element(elm, *args, **kwargs, &block)
-      content = Builder.new(&block).call if block
-      @buffer << Berns.element(elm, *args, **kwargs) { content }
+    def element(elm, attributes = nil, &block)
+      content = (PRESERVED.include?(elm.to_sym) ? preserve(&block) : capture(&block)) if block
+      @buffer << (attributes ? Berns.element(elm, attributes) { content } : Berns.element(elm) { content })
     end
 
     # Append an arbitrary void element to the buffer.
     #
     # @return [String]
-    def void(...)
-      @buffer << Berns.void(...)
+    def void(elm, attributes = nil)
+      @buffer << (attributes ? Berns.void(elm, attributes) : Berns.void(elm))
     end
 
+    # Each element method takes an optional attributes hash rather than splatted
+    # arguments so a call like `div(class: 'x') { ... }` only allocates the hash
+    # itself and calls the matching Berns method directly.
     Berns::STANDARD.each do |meth|
-      define_method(meth) do |*args, **kwargs, &block|
-        content = Builder.new(&block).call if block
-        @buffer << Berns.send(meth, *args, **kwargs) { content }
-      end
+      capture = PRESERVED.include?(meth) ? 'preserve' : 'capture'
+
+      class_eval <<~RUBY, __FILE__, __LINE__ + 1
+        def #{ meth }(attributes = nil, &block)                                                  # def div(attributes = nil, &block)
+          content = #{ capture }(&block) if block                                                #   content = capture(&block) if block
+          @buffer << (attributes ? Berns.#{ meth }(attributes) { content } : Berns.#{ meth } { content }) #   @buffer << (attributes ? Berns.div(attributes) { content } : Berns.div { content })
+        end                                                                                      # end
+      RUBY
     end
 
     Berns::VOID.each do |meth|
-      define_method(meth) do |*args, **kwargs|
-        @buffer << Berns.send(meth, *args, **kwargs)
+      class_eval <<~RUBY, __FILE__, __LINE__ + 1
+        def #{ meth }(attributes = nil)                                                # def br(attributes = nil)
+          @buffer << (attributes ? Berns.#{ meth }(attributes) : Berns.#{ meth })      #   @buffer << (attributes ? Berns.br(attributes) : Berns.br)
+        end                                                                            # end
+      RUBY
+    end
+
+    # The digest of the last render as a strong ETag header value.
+    #
+    # @return [String, nil]
+    def etag
+      @digest&.etag
+    end
+
+    private
+
+    # Reset the buffer, and the digest if there is one, for a new render. Large
+    # outputs start with enough room that they're rarely reallocated.
+    def start
+      @buffer = if @rope
+        Berns::Rope.new
+      elsif @capacity < MIN_CAPACITY
+        Berns::SafeString.new(EMPTY)
+      else
+        Berns::SafeString.new(encoding: Encoding::UTF_8, capacity: @capacity)
+      end
+
+      @probed = Berns::Probes::AVAILABLE && Berns::Probes.enabled?
+      Berns::Probes.render_start(probe_label) if @probed
+
+      if @timing
+        @nested = Berns::Timing.nested
+        @started = Berns::Timing.now
+      end
+
+      return unless @digest
+
+      @digest.reset
+      @output = @buffer
+      @hashed = 0
+    end
+
+    # This is a special case where the buffer hasn't been appended to but the
+    # block returned a string.
+    #
+    # @return [String, Berns::Rope]
+    def finish(content)
+      if @buffer.empty? && content.is_a?(String)
+        content = Berns.escape_html(content)
+        content = Berns.collapse_whitespace(content) if @collapse
+        @digest&.update(content)
+        output = @rope ? (@buffer << content).freeze : content.freeze
+      elsif @rope
+        @buffer.each { |fragment| @digest.update(fragment) } if @digest
+        output = @buffer.freeze
+      else
+        hash_output if @digest
+        learn(@buffer.bytesize) if @adaptive
+        output = @buffer.freeze
+      end
+
+      Berns::Probes.render_done(probe_label, output.bytesize) if @probed
+      @timing&.record(@started, @nested, output.bytesize)
+      output
+    end
+
+    # Where the block was defined, which identifies this template in the
+    # render_start and render_done probes.
+    #
+    # @return [String]
+    def probe_label
+      @probe_label ||= (@block.source_location || ['(unknown)', 0]).join(':').freeze
+    end
+
+    # Track a moving maximum of output sizes, decaying by an eighth each render
+    # so one unusually large render doesn't inflate every one after it.
+    def learn(size)
+      decayed = @capacity - (@capacity >> 3)
+      @capacity = size > decayed ? size : decayed
+    end
+
+    # Hash whatever has been appended to the output buffer since we last did,
+    # so each byte is hashed once, shortly after it's written.
+    def hash_output
+      @digest.update(@output, @hashed)
+      @hashed = @output.bytesize
+    end
+
+    # Render a nested block into a fresh buffer and return its content, using
+    # the same rules as #call for blocks that return a string.
+    #
+    # @return [String]
+    def capture(&block)
+      outer = @buffer
+      hash_output if @digest && !@rope && outer.equal?(@output)
+      @buffer = +''
+      content = instance_exec(&block)
+
+      if @buffer.empty? && content.is_a?(String)
+        content = Berns.escape_html(content)
+        @collapse ? Berns.collapse_whitespace(content) : content
+      else
+        @buffer
       end
+    ensure
+      @buffer = outer
+    end
+
+    # Collapse whitespace in a string being appended to the buffer, including a
+    # run that spans the end of the buffer and the start of the string.
+    #
+    # @return [String]
+    def collapse(string)
+      string = Berns.collapse_whitespace(string)
+      @buffer.end_with?(' ') && string.start_with?(' ') ? string.byteslice(1..) : string
+    end
+
+    # Like #capture but without collapsing whitespace, for the content of
+    # elements like pre where it's significant.
+    #
+    # @return [String]
+    def preserve(&block)
+      collapse = @collapse
+      @collapse = false
+      capture(&block)
+    ensure
+      @collapse = collapse
     end
   end
 end
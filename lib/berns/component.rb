@@ -0,0 +1,112 @@
+# frozen_string_literal: true
+require 'berns'
+
+module Berns
+  # A template whose rendered output is cached by its arguments, for small
+  # pieces of markup like avatars and badges that are rendered with the same
+  # arguments over and over. Hits skip the template entirely and return the
+  # same frozen string.
+  #
+  # Arguments are used as cache keys as-is, so they should be immutable values
+  # like Strings, Symbols, and Integers, or frozen collections of them.
+  #
+  # The cache is a least recently used cache bounded by both its number of
+  # entries and the total bytes of output it holds, and it's safe to share
+  # between threads.
+  #
+  # @example
+  #   Badge = Berns::Component.new(max_entries: 100) do |label, kind:|
+  #     span(class: "badge badge-#{ kind }") { label }
+  #   end
+  #
+  #   Badge.call('New', kind: :info) # => '<span class="badge badge-info">New</span>'
+  class Component
+    # @param max_entries [Integer] the most rendered outputs to keep
+    # @param max_bytes [Integer] the most bytes of rendered output to keep
+    # @param minify [Boolean] passed through to Berns::Builder
+    # @param name [String, Symbol, nil] passed through to Berns::Builder, so
+    #   renders on a cache miss are recorded by Berns::Timing
+    def initialize(max_entries: 256, max_bytes: 1 << 20, minify: false, name: nil, &block)
+      raise(ArgumentError, 'Berns::Component initialized without a block argument', caller) unless block
+
+      @block = block
+      @minify = minify
+      @name = name
+      @max_entries = max_entries
+      @max_bytes = max_bytes
+      @mutex = Mutex.new
+      @cache = {}
+      @bytes = 0
+      @hits = 0
+      @misses = 0
+      @evictions = 0
+    end
+
+    # Render the component, or return its cached output for the same arguments.
+    #
+    # @return [String]
+    def call(*args, **kwargs)
+      key = kwargs.empty? ? args.freeze : [args, kwargs].freeze
+
+      @mutex.synchronize do
+        if (html = @cache.delete(key))
+          @hits += 1
+          return @cache[key] = html
+        end
+
+        @misses += 1
+      end
+
+      # Render outside of the lock, with a Builder of our own since builders
+      # keep their buffer in an instance variable.
+      html = Builder.new(minify: @minify, name: @name, &@block).call(*args, **kwargs)
+
+      @mutex.synchronize { store(key, html) }
+
+      html
+    end
+    alias to_s call
+    alias to_str call
+
+    # Counts of cache hits, misses, and evictions, along with the number of
+    # entries and bytes of output currently cached.
+    #
+    # @return [Hash{Symbol => Integer}]
+    def stats
+      @mutex.synchronize do
+        { hits: @hits, misses: @misses, evictions: @evictions, entries: @cache.size, bytes: @bytes }
+      end
+    end
+
+    # Empty the cache and reset its stats.
+    #
+    # @return [void]
+    def clear
+      @mutex.synchronize do
+        @cache.clear
+        @bytes = @hits = @misses = @evictions = 0
+      end
+    end
+
+    private
+
+    # Insert the output as the most recently used entry, evicting the least
+    # recently used ones until the cache is within its bounds. Output too large
+    # to ever fit isn't cached at all. Must be called with the mutex held.
+    def store(key, html)
+      return if html.bytesize > @max_bytes || @max_entries < 1
+
+      previous = @cache.delete(key)
+      @bytes -= previous.bytesize if previous
+
+      @cache[key] = html
+      @bytes += html.bytesize
+
+      while @cache.size > @max_entries || @bytes > @max_bytes
+        _, evicted = @cache.shift
+        @bytes -= evicted.bytesize
+        @evictions += 1
+      end
+    end
+  end
+end
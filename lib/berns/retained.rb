@@ -0,0 +1,148 @@
+# frozen_string_literal: true
+require 'berns'
+
+module Berns
+  class Builder
+    # Retained rendering for builders initialized with `retain: true`, for pages
+    # that are rendered again and again with mostly the same data, like polling
+    # dashboards or partial refreshes.
+    #
+    # Parts of the template wrapped in #slot are keyed by a name and the inputs
+    # they depend on. When a slot's inputs are the same as in the previous
+    # render, its block is skipped and its previous HTML is reused as-is, so
+    # only slots whose inputs changed are escaped and serialized again. After
+    # each render, #slots holds the byte range of every slot in the output and
+    # #changes holds the ranges of the slots whose HTML changed.
+    #
+    # @example
+    #   Dashboard = Berns::Builder.new(retain: true) do |stats|
+    #     div(class: 'dashboard') do
+    #       slot(:load, stats.load) { span(id: 'load') { stats.load.to_s } }
+    #       slot(:jobs, stats.jobs) { ul(id: 'jobs') { stats.jobs.each { |job| li { job } } } }
+    #     end
+    #   end
+    #
+    #   Dashboard.call(stats)
+    #   Dashboard.changes # => { jobs: 47...86 } when only the jobs changed
+    module Retained
+      # The byte range of each slot in the last render's output, by name.
+      #
+      # @return [Hash{Object => Range}]
+      attr_reader :slots
+
+      # The byte range of each slot in the last render's output whose HTML
+      # differs from the render before it, including slots that are new.
+      #
+      # @return [Hash{Object => Range}]
+      attr_reader :changes
+
+      # Append the output of the block, or the same slot's output from the last
+      # render if its inputs are equal to last time. Inputs are compared with
+      # #==, so they should be values that aren't modified in place.
+      #
+      # @param name [Object] unique within a render
+      # @return [String]
+      def slot(name, *inputs, &block)
+        raise(ArgumentError, "Berns::Builder#slot #{ name.inspect } is nested in another slot", caller) if @slotting
+        raise(ArgumentError, "Berns::Builder#slot #{ name.inspect } was already rendered", caller) if @current.key?(name)
+
+        previous = @previous[name]
+
+        if previous && previous[0] == inputs
+          html = previous[1]
+          changed = false
+        else
+          html = render_slot(&block)
+          changed = previous.nil? || previous[1] != html
+        end
+
+        start = @buffer.bytesize
+        @buffer << (@collapse && @buffer.end_with?(' ') && html.start_with?(' ') ? html.byteslice(1..) : html)
+        @current[name] = [inputs, html]
+        @ranges << [name, start, @buffer.bytesize, changed]
+        @buffer
+      end
+
+      # Forget every slot's previous output, so the next render runs them all.
+      #
+      # @return [void]
+      def invalidate
+        @previous = {}
+      end
+
+      # Wrapping content in an element moves the slots inside it by the length
+      # of whatever precedes the content in the outer buffer.
+      Berns::STANDARD.each do |meth|
+        class_eval <<~RUBY, __FILE__, __LINE__ + 1
+          def #{ meth }(attributes = nil, &block)             # def div(attributes = nil, &block)
+            mark = @ranges.length                              #   mark = @ranges.length
+            super                                              #   super
+            adopt(mark, #{ meth.length + 3 }) if @ranges.length > mark #   adopt(mark, 6) if @ranges.length > mark
+            @buffer                                            #   @buffer
+          end                                                  # end
+        RUBY
+      end
+
+      # @return [String]
+      def element(elm, attributes = nil, &block)
+        mark = @ranges.length
+        super
+        adopt(mark, elm.to_s.bytesize + 3) if @ranges.length > mark
+        @buffer
+      end
+
+      private
+
+      def start
+        super
+        @previous ||= {}
+        @current = {}
+        @ranges = []
+        @captured = 0
+      end
+
+      def finish(content)
+        output = super
+        @previous = @current
+        @slots = {}
+        @changes = {}
+
+        @ranges.each do |name, first, last, changed|
+          @slots[name] = first...last
+          @changes[name] = first...last if changed
+        end
+
+        output
+      end
+
+      # Remember the size of the content captured last, which is the content of
+      # the element appended next.
+      def capture(&block)
+        content = super
+        @captured = content.bytesize
+        content
+      end
+
+      # Capture a slot's content as a string that won't change underneath us.
+      def render_slot(&block)
+        @slotting = true
+        html = capture(&block)
+        html.frozen? ? html : html.dup.freeze
+      ensure
+        @slotting = false
+      end
+
+      # Move the ranges recorded since mark, which are relative to the content
+      # just wrapped and appended, to be relative to the buffer it went into.
+      def adopt(mark, closing)
+        offset = @buffer.bytesize - closing - @captured
+
+        (mark...@ranges.length).each do |index|
+          range = @ranges[index]
+          range[1] += offset
+          range[2] += offset
+        end
+      end
+    end
+  end
+end
@@ -0,0 +1,156 @@
+# frozen_string_literal: true
+require 'berns'
+
+module Berns
+  # Output kept as a list of fragments instead of one contiguous string. Large
+  # fragments are kept by reference, so a page made mostly of cached partials
+  # and components isn't copied into a page buffer before it's sent. Small
+  # fragments are copied into a shared buffer so the list stays short.
+  #
+  # A rope can be written to an IO with scatter I/O, iterated with #each like a
+  # Rack response body, or flattened into a single string once with #to_s.
+  #
+  # @example
+  #   rope = Berns::Rope.new
+  #   rope << Header.call << Berns.h1 { 'Title' } << Footer.call
+  #   rope.write_to(socket)
+  class Rope
+    # Fragments of at least this many bytes are kept by reference rather than
+    # copied.
+    MIN_REFERENCE = 512
+
+    # The most fragments passed to a single write, which is the smallest
+    # IOV_MAX of the platforms Ruby runs on.
+    MAX_WRITE = 1024
+
+    # The total size of every fragment.
+    #
+    # @return [Integer]
+    attr_reader :bytesize
+
+    def initialize
+      @fragments = []
+      @tail = nil
+      @bytesize = 0
+
+      # Holds the flattened string, if any, in an Array so it can still be set
+      # once the rope is frozen.
+      @string = []
+    end
+
+    # Append a string. Frozen strings are kept as-is and others are duplicated,
+    # which shares their bytes with the original until either is modified.
+    #
+    # @param string [String]
+    # @return [Berns::Rope]
+    def <<(string)
+      size = string.bytesize
+      return self if size.zero?
+
+      @bytesize += size
+      @string.clear
+
+      if size < MIN_REFERENCE
+        (@tail ||= String.new(encoding: Encoding::UTF_8)) << string
+      else
+        seal
+        @fragments << (string.frozen? ? string : string.dup)
+      end
+
+      self
+    end
+
+    # @return [Boolean]
+    def empty?
+      @bytesize.zero?
+    end
+
+    # Whether the last fragment ends with the given string, which is only
+    # checked within that fragment.
+    #
+    # @return [Boolean]
+    def end_with?(suffix)
+      last = @tail || @fragments.last
+      last ? last.end_with?(suffix) : suffix.empty?
+    end
+
+    # The fragments in order.
+    #
+    # @return [Array<String>]
+    def fragments
+      seal
+      @fragments
+    end
+
+    # Yield each fragment in order, so a rope can be used as a Rack body.
+    #
+    # @yieldparam fragment [String]
+    # @return [Berns::Rope, Enumerator]
+    def each(&block)
+      return enum_for(:each) unless block
+
+      fragments.each(&block)
+      self
+    end
+
+    # Write every fragment to an IO, passing many at a time so IO#write can use
+    # writev(2) on file descriptors that allow it.
+    #
+    # @param io [IO]
+    # @return [Integer] the number of bytes written
+    def write_to(io)
+      list = fragments
+
+      if list.length <= MAX_WRITE
+        io.write(*list) unless list.empty?
+      else
+        list.each_slice(MAX_WRITE) { |slice| io.write(*slice) }
+      end
+
+      @bytesize
+    end
+
+    # Flatten the fragments into one string. The result is kept until the next
+    # append, so flattening twice only copies once, frozen or not.
+    #
+    # @return [Berns::SafeString]
+    def to_s
+      @string[0] ||= begin
+        string = Berns::SafeString.new(encoding: Encoding::UTF_8, capacity: @bytesize)
+        fragments.each { |fragment| string << fragment }
+        string.freeze
+      end
+    end
+    alias to_str to_s
+
+    # @return [Boolean]
+    def ==(other)
+      (other.is_a?(Rope) || other.is_a?(String)) && to_s == other.to_s
+    end
+
+    # Seal and freeze the fragments too, since a frozen rope can't be appended
+    # to anyway.
+    #
+    # @return [Berns::Rope]
+    def freeze
+      seal
+      @fragments.freeze
+      super
+    end
+
+    # @return [String]
+    def inspect
+      "#<#{ self.class } fragments=#{ fragments.length } bytesize=#{ @bytesize }>"
+    end
+
+    private
+
+    # Move the buffer of small fragments onto the list.
+    def seal
+      return unless @tail
+
+      @fragments << @tail.freeze
+      @tail = nil
+    end
+  end
+end
@@ -0,0 +1,62 @@
+# frozen_string_literal: true
+module Berns
+  # An allowlist-based HTML sanitizer. Allowed elements and attributes are
+  # kept, URL attributes are checked against a list of protocols, disallowed
+  # tags are removed but their text is kept, and everything else is escaped.
+  #
+  # Elements like script and style are always removed along with their
+  # content.
+  #
+  # @example
+  #   sanitizer = Berns::Sanitizer.new(elements: %w[a b i], attributes: { 'a' => %w[href] })
+  #   sanitizer.sanitize('<a href="/x" onclick="y()">Hi <script>z()</script><u>there</u></a>')
+  #   # => '<a href="/x">Hi there</a>'
+  class Sanitizer
+    ELEMENTS = %w[
+      a abbr b blockquote br cite code dd del dfn dl dt em h1 h2 h3 h4 h5 h6 hr i
+      img ins kbd li mark ol p pre q s samp small span strong sub sup u ul var
+    ].freeze
+
+    # Attributes allowed per element, with :all applying to every element.
+    ATTRIBUTES = {
+      all: %w[dir lang title].freeze,
+      'a' => %w[href].freeze,
+      'blockquote' => %w[cite].freeze,
+      'del' => %w[cite datetime].freeze,
+      'img' => %w[alt height src width].freeze,
+      'ins' => %w[cite datetime].freeze,
+      'q' => %w[cite].freeze
+    }.freeze
+
+    # Protocols allowed in URL attributes. Relative URLs are always allowed.
+    PROTOCOLS = {
+      'cite' => %w[http https].freeze,
+      'href' => %w[http https mailto].freeze,
+      'src' => %w[http https].freeze
+    }.freeze
+
+    # @param elements [Array<String, Symbol>]
+    # @param attributes [Hash{String, Symbol => Array<String, Symbol>}]
+    # @param protocols [Hash{String, Symbol => Array<String, Symbol>}]
+    def initialize(elements: ELEMENTS, attributes: ATTRIBUTES, protocols: PROTOCOLS)
+      elements = elements.map { |element| normalize(element) }.uniq
+      attributes = attributes.to_h { |key, names| [key == :all ? :all : normalize(key), names.map { |name| normalize(name) }] }
+      protocols = protocols.to_h { |key, names| [normalize(key), names.map { |name| normalize(name) }] }
+
+      compile(
+        elements,
+        elements.map { |element| attributes.fetch(element, []) },
+        attributes.fetch(:all, []),
+        protocols
+      )
+    end
+
+    private
+
+    def normalize(name)
+      name.to_s.downcase
+    end
+
+    DEFAULT = new.freeze
+  end
+end
@@ -0,0 +1,139 @@
+# frozen_string_literal: true
+module Berns
+  # Render time and output size histograms for a named template, recorded by
+  # each Berns::Builder or Berns::Component created with the same `name:`.
+  #
+  # Inclusive time covers the whole render. Exclusive time leaves out the
+  # renders of other named templates nested inside it, so a slow partial shows
+  # up under its own name rather than under every page that renders it.
+  #
+  # Timing.now, Timing.nested, and #record, which each named render calls, are
+  # defined in the extension.
+  #
+  # @example
+  #   Row = Berns::Builder.new(name: 'users/row') { |user| tr { td { user.name } } }
+  #   Berns::Timing['users/row'].to_h
+  #   # => { calls: 1, inclusive: { count: 1, sum: 5120, buckets: { 8192 => 1 } }, ... }
+  class Timing
+    # Bucket bounds used for Prometheus output, from about a microsecond to a
+    # minute and from 64 bytes to 64MB. Every series gets the same bounds, and
+    # values past the last one are only counted by the +Inf bucket.
+    PROMETHEUS_NANOSECONDS = (10..36).map { |power| 1 << power }.freeze
+    PROMETHEUS_BYTES = (6..26).map { |power| 1 << power }.freeze
+
+    @all = {}
+    @mutex = Mutex.new
+
+    class << self
+      # The timing for a template name, created the first time it's asked for.
+      #
+      # @param name [String, Symbol]
+      # @return [Berns::Timing]
+      def [](name)
+        name = name.to_s
+        @all[name] || @mutex.synchronize { @all[name] ||= new(name) }
+      end
+
+      # Every timing recorded so far, by name.
+      #
+      # @return [Hash{String => Berns::Timing}]
+      def all
+        @mutex.synchronize { @all.dup }
+      end
+
+      # @return [Hash{String => Hash}]
+      def to_h
+        all.transform_values(&:to_h)
+      end
+
+      # Reset every timing's histograms.
+      #
+      # @return [void]
+      def reset
+        all.each_value(&:reset)
+      end
+
+      # Every timing in the Prometheus text exposition format, as the
+      # histograms berns_render_seconds, berns_render_exclusive_seconds, and
+      # berns_render_bytes labeled by template.
+      #
+      # @return [String]
+      def prometheus
+        timings = all.values
+        output = +''
+
+        prometheus_histogram(output, timings, 'berns_render_seconds', 'Berns template render time.', :inclusive, PROMETHEUS_NANOSECONDS, 1e9)
+        prometheus_histogram(output, timings, 'berns_render_exclusive_seconds', 'Berns template render time, less nested named renders.', :exclusive, PROMETHEUS_NANOSECONDS, 1e9)
+        prometheus_histogram(output, timings, 'berns_render_bytes', 'Berns template output size.', :bytes, PROMETHEUS_BYTES, 1)
+
+        output
+      end
+
+      private
+
+      def prometheus_histogram(output, timings, metric, help, histogram, bounds, scale)
+        output << "# HELP #{ metric } #{ help }\n# TYPE #{ metric } histogram\n"
+
+        timings.each do |timing|
+          label = %(template="#{ timing.name.gsub(/["\\\n]/, '"' => '\\"', '\\' => '\\\\', "\n" => '\\n') }")
+          data = timing.public_send(histogram)
+          pending = data.buckets.to_a
+          total = 0
+
+          bounds.each do |bound|
+            total += pending.shift.last while pending.any? && pending.first.first <= bound
+            output << "#{ metric }_bucket{#{ label },le=\"#{ bound / scale }\"} #{ total }\n"
+          end
+
+          output << "#{ metric }_bucket{#{ label },le=\"+Inf\"} #{ data.count }\n"
+          output << "#{ metric }_sum{#{ label }} #{ data.sum / scale }\n"
+          output << "#{ metric }_count{#{ label }} #{ data.count }\n"
+        end
+      end
+    end
+
+    # @return [String]
+    attr_reader :name
+
+    # Render times in nanoseconds, including nested renders.
+    #
+    # @return [Berns::Histogram]
+    attr_reader :inclusive
+
+    # Render times in nanoseconds, less the renders of nested named templates.
+    #
+    # @return [Berns::Histogram]
+    attr_reader :exclusive
+
+    # Output sizes in bytes.
+    #
+    # @return [Berns::Histogram]
+    attr_reader :bytes
+
+    # @param name [String]
+    def initialize(name)
+      @name = name.frozen? ? name : name.dup.freeze
+      @inclusive = Berns::Histogram.new
+      @exclusive = Berns::Histogram.new
+      @bytes = Berns::Histogram.new
+    end
+
+    # @return [Integer]
+    def calls
+      @inclusive.count
+    end
+
+    # @return [Hash{Symbol => Integer, Hash}]
+    def to_h
+      { calls: calls, inclusive: @inclusive.to_h, exclusive: @exclusive.to_h, bytes: @bytes.to_h }
+    end
+
+    # @return [Berns::Timing]
+    def reset
+      @inclusive.reset
+      @exclusive.reset
+      @bytes.reset
+      self
+    end
+  end
+end
@@ -0,0 +1,168 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+# Guards the number of objects each public API allocates per call, along with
+# the malloc'd bytes it leaves behind. If a change lowers a count, lower the
+# budget here too so it can't creep back up.
+#
+# The budgets are measured on Ruby 3.3 on Linux, and other versions and
+# platforms allocate differently, so these only run with BERNS_ALLOCATIONS set,
+# e.g. by `rake test:allocations`.
+describe 'Berns allocations' do
+  before { skip 'Set BERNS_ALLOCATIONS=1 to run the allocation tests' unless ENV['BERNS_ALLOCATIONS'] }
+
+  let(:attributes) { { class: 'my-class', href: 'https://example.com/?a=1&b=2' }.freeze }
+  let(:nested) { { class: 'card', data: { controller: 'search', action: 'click->search#go', nested: { deeper: 'yes' } } }.freeze }
+  let(:clean) { ('Some perfectly clean text. ' * 64).freeze }
+  let(:dirty) { ('Some <dirty> & "quoted" text. ' * 64).freeze }
+  let(:builder) do
+    Berns::Builder.new do |title|
+      div(class: 'card') do
+        h1 { title }
+        p(class: 'body') { text 'This & that' }
+        br
+      end
+    end
+  end
+
+  # Calls counted per measurement.
+  let(:iterations) { 100 }
+
+  # Malloc'd bytes per call that show up even for calls that malloc nothing,
+  # from the VM growing its own tables while we count. Measured at up to 3.52.
+  let(:malloc_noise) { 8 }
+
+  # Returns the objects allocated and malloc'd bytes retained per call of the
+  # block, with GC disabled so nothing is collected while counting. Objects are
+  # rounded to ignore the odd allocation made outside the block. Each is the
+  # least of three rounds, since the VM now and then grows a table of its own
+  # partway through one.
+  def allocations(&block)
+    10.times(&block)
+
+    rounds = Array.new(3) { allocation_round(&block) }
+
+    [rounds.map(&:first).min, rounds.map(&:last).min]
+  end
+
+  def allocation_round
+    GC.start
+    GC.disable
+
+    objects = GC.stat(:total_allocated_objects)
+    malloced = GC.stat(:malloc_increase_bytes)
+
+    iterations.times { yield }
+
+    [
+      (GC.stat(:total_allocated_objects) - objects).fdiv(iterations).round,
+      (GC.stat(:malloc_increase_bytes) - malloced).fdiv(iterations)
+    ]
+  ensure
+    GC.enable
+  end
+
+  def assert_allocations(objects, malloced, &block)
+    actual_objects, actual_malloced = allocations(&block)
+
+    assert_operator actual_objects, :<=, objects, "Allocated objects per call exceeded #{ objects }"
+    assert_operator actual_malloced, :<=, malloced + malloc_noise, "Retained malloc bytes per call exceeded #{ malloced }"
+  end
+
+  describe 'element' do
+    it 'allocates only the result without attributes' do
+      assert_allocations(1, 0) { Berns.element(:div) { 'Content' } }
+    end
+
+    it 'allocates within budget with attributes' do
+      assert_allocations(2, 0) { Berns.element(:div, attributes) { 'Content' } }
+      assert_allocations(2, 0) { Berns.div(attributes) { 'Content' } }
+      assert_allocations(4, 0) { Berns.element(:div, nested) { 'Content' } }
+    end
+
+    it 'retains only the result for large content' do
+      assert_allocations(1, dirty.bytesize + 64) { Berns.element(:div) { dirty } }
+    end
+  end
+
+  describe 'void' do
+    it 'allocates within budget' do
+      assert_allocations(1, 0) { Berns.void(:br) }
+      assert_allocations(2, 0) { Berns.void(:img, attributes) }
+      assert_allocations(2, 0) { Berns.img(attributes) }
+    end
+  end
+
+  describe 'to_attribute' do
+    it 'allocates within budget' do
+      assert_allocations(1, 0) { Berns.to_attribute(:class, 'my-class') }
+      assert_allocations(3, 0) { Berns.to_attribute(:data, nested[:data]) }
+    end
+  end
+
+  describe 'to_attributes' do
+    it 'allocates within budget' do
+      assert_allocations(2, 0) { Berns.to_attributes(attributes) }
+      assert_allocations(4, 0) { Berns.to_attributes(nested) }
+    end
+  end
+
+  describe 'escape_html' do
+    it 'allocates nothing for clean strings' do
+      assert_allocations(0, 0) { Berns.escape_html(clean) }
+    end
+
+    it 'allocates and retains only the result for dirty strings' do
+      assert_allocations(1, Berns.escape_html(dirty).bytesize + 64) { Berns.escape_html(dirty) }
+    end
+  end
+
+  describe 'sanitize' do
+    it 'allocates nothing for clean strings' do
+      assert_allocations(0, 0) { Berns.sanitize(clean) }
+    end
+
+    it 'allocates and retains only the result for dirty strings' do
+      assert_allocations(1, Berns.sanitize(dirty).bytesize + 64) { Berns.sanitize(dirty) }
+    end
+  end
+
+  describe 'unescape_html' do
+    it 'allocates nothing for strings without references' do
+      assert_allocations(0, 0) { Berns.unescape_html(clean) }
+    end
+
+    it 'allocates and retains only the result for escaped strings' do
+      escaped = Berns.escape_html(dirty)
+
+      assert_allocations(1, dirty.bytesize + 64) { Berns.unescape_html(escaped) }
+    end
+  end
+
+  describe 'snippet' do
+    it 'allocates and retains only the result' do
+      assert_allocations(1, Berns.snippet(dirty, 100).bytesize + 64) { Berns.snippet(dirty, 100) }
+      assert_allocations(1, Berns.snippet(dirty, 10_000).bytesize + 64) { Berns.snippet(dirty, 10_000) }
+    end
+  end
+
+  describe 'Builder#call' do
+    # Argument handling in Ruby itself allocates differently across versions,
+    # so this one is a ceiling rather than an exact count.
+    it 'allocates within budget' do
+      objects, malloced = allocations { builder.call('Title') }
+
+      assert_operator objects, :<=, 20
+      assert_operator malloced, :<=, 512
+    end
+
+    it 'allocates less when compiled' do
+      compiled = builder.compile
+      objects, malloced = allocations { compiled.call('Title') }
+
+      assert_operator objects, :<=, 16
+      assert_operator malloced, :<=, 512
+    end
+  end
+end
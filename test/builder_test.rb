@@ -95,6 +95,188 @@ describe Berns::Builder do
     end
   end
 
+  describe '#compile' do
+    it 'renders the same output as the original builder' do
+      dom = Berns::Builder.new do |pos, title:|
+        div(class: 'wrapper') do
+          h1 { title }
+          p { pos }
+          br
+        end
+      end
+
+      assert_equal dom.call('PARAGRAPH!', title: 'TITLE!'), dom.compile.call('PARAGRAPH!', title: 'TITLE!')
+      assert_equal '<div class="wrapper"><h1>&lt;b&gt;</h1><p></p><br></div>', dom.compile.call('', title: '<b>')
+    end
+
+    it 'returns the same compiled builder each time' do
+      dom = Berns::Builder.new { b { 'Bold!' } }
+
+      assert_same dom.compile, dom.compile
+      assert_kind_of Berns::Builder, dom.compile
+      assert_equal '<b>Bold!</b>', dom.compile.to_s
+    end
+
+    it 'raises an error for missing arguments' do
+      dom = Berns::Builder.new { |pos, title:| h1 { "#{ pos } #{ title }" } }
+
+      assert_raises(ArgumentError) { dom.compile.call('pos') }
+      assert_raises(ArgumentError) { dom.compile.call(title: 'title') }
+    end
+
+    it 'supports optional and splatted arguments' do
+      dom = Berns::Builder.new do |*names, greeting: 'Hello', **opts|
+        names.each { |name| p(opts) { "#{ greeting } #{ name }" } }
+      end
+
+      assert_equal '<p class="x">Hi Bob</p><p class="x">Hi Sue</p>', dom.compile.call('Bob', 'Sue', greeting: 'Hi', class: 'x')
+    end
+
+    it 'supports keyword arguments named after reserved words' do
+      dom = Berns::Builder.new { |class:| div(class: binding.local_variable_get(:class)) }
+
+      assert_equal '<div class="x"></div>', dom.compile.call(class: 'x')
+    end
+
+    it 'captures the block return when the buffer has not been modified' do
+      dom = Berns::Builder.new { |text| text }
+
+      assert_equal '&lt;plain&gt;', dom.compile.call('<plain>')
+      assert_predicate dom.compile.call('<plain>'), :frozen?
+    end
+  end
+
+  describe 'minify' do
+    it 'does not collapse whitespace by default' do
+      dom = Berns::Builder.new { p { "  a\n  b  " } }
+
+      assert_equal "<p>  a\n  b  </p>", dom.call
+    end
+
+    it 'collapses whitespace in text, raw, and captured content' do
+      dom = Berns::Builder.new(minify: true) do
+        div do
+          text "  Hello\n   world "
+          raw "\n  <b>  bold  </b>\n"
+          span { "  inline\t\tcontent  " }
+        end
+      end
+
+      assert_equal '<div> Hello world <b> bold </b> <span> inline content </span></div>', dom.call
+    end
+
+    it 'leaves attribute values alone' do
+      dom = Berns::Builder.new(minify: true) { div(title: 'a   b') { raw '<i title="c   d">x</i>' } }
+
+      assert_equal '<div title="a   b"><i title="c   d">x</i></div>', dom.call
+    end
+
+    it 'leaves preserved elements alone' do
+      dom = Berns::Builder.new(minify: true) do
+        pre { text "  keep\n    this  " }
+        textarea { "  a\n  b" }
+        element(:script) { raw "  if (a)  {\n    b();\n  }" }
+        style { raw "  p  {  }  " }
+        raw "<pre>  raw\n  pre  </pre>  after  "
+      end
+
+      assert_equal "<pre>  keep\n    this  </pre><textarea>  a\n  b</textarea><script>  if (a)  {\n    b();\n  }</script><style>  p  {  }  </style><pre>  raw\n  pre  </pre> after ", dom.call
+    end
+
+    it 'collapses whitespace again after a preserved element' do
+      dom = Berns::Builder.new(minify: true) do
+        pre { span { '  a  ' } }
+        p { '  b  ' }
+      end
+
+      assert_equal '<pre><span>  a  </span></pre><p> b </p>', dom.call
+    end
+
+    it 'carries over to compiled builders' do
+      dom = Berns::Builder.new(minify: true) { |name| h1 { "  #{ name }  " } }
+
+      assert_equal '<h1> Bob </h1>', dom.compile.call('Bob')
+    end
+  end
+
+  describe 'digest' do
+    let(:template) do
+      Berns::Builder.new(digest: true) do |items|
+        h1 { 'Items' }
+        ul { items.each { |item| li { item } } }
+        text 'Footer & more'
+      end
+    end
+
+    it 'does not compute a digest by default' do
+      dom = Berns::Builder.new { h1 { 'Title' } }
+      dom.call
+
+      assert_nil dom.digest
+      assert_nil dom.etag
+    end
+
+    it 'computes the digest of the output while rendering' do
+      output = template.call(%w[a b c])
+
+      assert_equal Berns::Digest.hexdigest(output), template.digest.hexdigest
+      assert_equal %("#{ Berns::Digest.hexdigest(output) }"), template.etag
+    end
+
+    it 'computes a fresh digest for each render' do
+      first = template.call(%w[a])
+      second = template.call(%w[b])
+
+      assert_equal Berns::Digest.hexdigest(second), template.digest.hexdigest
+      refute_equal Berns::Digest.hexdigest(first), template.digest.hexdigest
+    end
+
+    it 'computes the digest of captured block returns' do
+      dom = Berns::Builder.new(digest: true) { 'a < b' }
+
+      assert_equal Berns::Digest.hexdigest(dom.call), dom.digest.hexdigest
+    end
+
+    it 'carries over to compiled builders' do
+      compiled = template.compile
+      output = compiled.call(%w[a b])
+
+      assert_equal Berns::Digest.hexdigest(output), compiled.digest.hexdigest
+    end
+  end
+
+  describe 'capacity' do
+    it 'learns a moving maximum of output sizes' do
+      dom = Berns::Builder.new { |count| count.times { text 'x' } }
+
+      assert_equal 0, dom.capacity
+
+      dom.call(10_000)
+
+      assert_equal 10_000, dom.capacity
+
+      dom.call(10)
+
+      assert_equal 8_750, dom.capacity
+      assert_equal 'x' * 10, dom.call(10)
+    end
+
+    it 'uses an explicit capacity as-is' do
+      dom = Berns::Builder.new(capacity: 65_536) { |count| count.times { text 'x' } }
+
+      assert_equal 'x' * 100_000, dom.call(100_000)
+      assert_equal 65_536, dom.capacity
+      assert_equal 65_536, dom.compile.capacity
+    end
+
+    it 'renders UTF-8 strings from a preallocated buffer' do
+      dom = Berns::Builder.new(capacity: 65_536) { p { 'café' } }
+
+      assert_equal Encoding::UTF_8, dom.call.encoding
+      assert_equal '<p>café</p>', dom.call
+    end
+  end
+
   describe '#to_s' do
     it 'renders the template to a string' do
       dom = Berns::Builder.new { b { 'Bold!' } }
@@ -127,6 +309,44 @@ describe Berns::Builder do
     end
   end
 
+  describe 'nested blocks' do
+    it 'run on the same builder as the block around them' do
+      builder = Berns::Builder.new do
+        @title = 'Outer'
+        div do
+          @footer = 'Inner'
+          h1 { text @title }
+        end
+        p { text @footer }
+      end
+
+      assert_equal '<div><h1>Outer</h1></div><p>Inner</p>', builder.call
+    end
+
+    it 'keep methods they define on the builder' do
+      builder = Berns::Builder.new do
+        div do
+          def helper # rubocop:disable Lint/NestedMethodDefinition
+            'Helper'
+          end
+        end
+        text helper
+      end
+
+      assert_equal '<div></div>Helper', builder.call
+      assert_respond_to builder, :helper
+    end
+  end
+
+  describe 'element method arguments' do
+    it 'take a single optional attributes hash' do
+      assert_equal [%i[opt attributes], %i[block block]], Berns::Builder.instance_method(:div).parameters
+      assert_equal [%i[opt attributes]], Berns::Builder.instance_method(:br).parameters
+      assert_equal '<div></div>', Berns::Builder.new { div(nil) }.call
+      assert_raises(ArgumentError) { Berns::Builder.new { div({ class: 'a' }, { id: 'b' }) }.call }
+    end
+  end
+
   describe 'block return values' do
     it 'does not capture the block return when the buffer has been modified' do
       dom = Berns::Builder.new do
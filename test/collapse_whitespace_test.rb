@@ -0,0 +1,68 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe 'Berns.collapse_whitespace' do
+  it 'handles nil' do
+    assert_nil Berns.collapse_whitespace(nil)
+  end
+
+  it 'raises an error for non-strings' do
+    assert_raises(TypeError) { Berns.collapse_whitespace(1) }
+  end
+
+  it 'returns the string itself when there is nothing to collapse' do
+    string = 'Nothing to collapse here, just single spaces. ' * 4
+
+    assert_same string, Berns.collapse_whitespace(string)
+  end
+
+  it 'returns the string itself when only preserved content has whitespace' do
+    string = '<pre>  a  </pre>'
+
+    assert_same string, Berns.collapse_whitespace(string)
+  end
+
+  it 'collapses runs of whitespace into a single space' do
+    assert_equal ' a b c ', Berns.collapse_whitespace("  a \n\t b\r\n\fc\n")
+    assert_equal 'a b', Berns.collapse_whitespace("a\nb")
+  end
+
+  it 'finds runs of whitespace anywhere in long strings' do
+    (0..40).each do |index|
+      string = 'x' * 40
+      string[index, 0] = '  '
+
+      assert_equal string.sub('  ', ' '), Berns.collapse_whitespace(string), "whitespace at #{ index }"
+    end
+  end
+
+  it 'leaves tags and attribute values alone' do
+    assert_equal %(<a  href="/x"  title='a   b'> x </a>), Berns.collapse_whitespace(%(<a  href="/x"  title='a   b'>\n  x\n</a>))
+    assert_equal %(<a title="  >  "> x </a>), Berns.collapse_whitespace(%(<a title="  >  ">  x  </a>))
+  end
+
+  it 'leaves comments alone' do
+    assert_equal '<!--  a  --> b', Berns.collapse_whitespace("<!--  a  -->  b")
+  end
+
+  it 'leaves the content of preserved elements alone' do
+    %w[pre PRE script style textarea].each do |name|
+      assert_equal "<#{ name } class=\"x\">  a\n  b  </#{ name }> c ", Berns.collapse_whitespace("<#{ name } class=\"x\">  a\n  b  </#{ name }>  c  ")
+    end
+  end
+
+  it 'does not mistake similarly named elements for preserved ones' do
+    assert_equal '<preview> a </preview>', Berns.collapse_whitespace('<preview>  a  </preview>')
+  end
+
+  it 'handles unterminated markup' do
+    assert_equal '<pre>  a  ', Berns.collapse_whitespace('<pre>  a  ')
+    assert_equal 'a <b  c', Berns.collapse_whitespace('a  <b  c')
+    assert_equal '<!--  a', Berns.collapse_whitespace('<!--  a')
+  end
+
+  it 'returns UTF-8 strings' do
+    assert_equal Encoding::UTF_8, Berns.collapse_whitespace("café  au lait").encoding
+  end
+end
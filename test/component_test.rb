@@ -0,0 +1,125 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Component do
+  let(:renders) { [] }
+
+  let(:badge) do
+    calls = renders
+
+    Berns::Component.new(max_entries: 2) do |label, kind: :info|
+      calls << label
+      span(class: "badge badge-#{ kind }") { label }
+    end
+  end
+
+  it 'raises an argument error if a block is not passed' do
+    assert_raises(ArgumentError) { Berns::Component.new }
+  end
+
+  it 'renders like a builder' do
+    assert_equal '<span class="badge badge-info">New</span>', badge.call('New')
+    assert_equal '<span class="badge badge-warning">Old</span>', badge.call('Old', kind: :warning)
+    assert_equal '<span class="badge badge-info">New</span>', badge.to_s('New')
+  end
+
+  it 'returns the same frozen output for the same arguments' do
+    first = badge.call('New')
+    second = badge.call('New')
+
+    assert_same first, second
+    assert_predicate first, :frozen?
+    assert_equal %w[New], renders
+  end
+
+  it 'keys the cache on keyword arguments too' do
+    badge.call('New')
+    badge.call('New', kind: :info)
+    badge.call('New', kind: :warning)
+
+    assert_equal %w[New New New], renders
+  end
+
+  it 'evicts the least recently used entry' do
+    badge.call('a')
+    badge.call('b')
+    badge.call('a')
+    badge.call('c')
+    badge.call('a')
+    badge.call('b')
+
+    bytes = badge.stats[:bytes]
+
+    assert_equal %w[a b c b], renders
+    assert_equal({ hits: 2, misses: 4, evictions: 2, entries: 2, bytes: bytes }, badge.stats)
+    assert_equal bytes, badge.call('a').bytesize + badge.call('b').bytesize
+  end
+
+  it 'bounds the cache by bytes' do
+    component = Berns::Component.new(max_bytes: 40) { |text| p { text } }
+
+    component.call('a' * 20)
+    component.call('b' * 20)
+
+    assert_equal 1, component.stats[:entries]
+    assert_equal 1, component.stats[:evictions]
+    assert_operator component.stats[:bytes], :<=, 40
+
+    component.call('c' * 100)
+
+    assert_equal 1, component.stats[:entries]
+  end
+
+  it 'does not cache anything when max_entries is 0' do
+    component = Berns::Component.new(max_entries: 0) { |text| p { text } }
+
+    component.call('a')
+    component.call('a')
+
+    assert_equal({ hits: 0, misses: 2, evictions: 0, entries: 0, bytes: 0 }, component.stats)
+  end
+
+  it 'tracks stats and can be cleared' do
+    bytes = badge.call('New').bytesize
+    badge.call('New')
+    bytes += badge.call('Old').bytesize
+
+    assert_equal({ hits: 1, misses: 2, evictions: 0, entries: 2, bytes: bytes }, badge.stats)
+
+    badge.clear
+
+    assert_equal({ hits: 0, misses: 0, evictions: 0, entries: 0, bytes: 0 }, badge.stats)
+  end
+
+  it 'passes minify through to the builder' do
+    component = Berns::Component.new(minify: true) { |text| p { text } }
+
+    assert_equal '<p> a b </p>', component.call("  a\n  b  ")
+  end
+
+  it 'can be used from a builder' do
+    icon = badge
+
+    dom = Berns::Builder.new do
+      div do
+        component icon, 'New'
+        component icon, 'New'
+      end
+    end
+
+    assert_equal '<div><span class="badge badge-info">New</span><span class="badge badge-info">New</span></div>', dom.call
+    assert_equal %w[New], renders
+  end
+
+  it 'is safe to share between threads' do
+    component = Berns::Component.new(max_entries: 8) { |n| span { n.to_s } }
+
+    Array.new(4) { Thread.new { 500.times { |i| assert_equal "<span>#{ i % 16 }</span>", component.call(i % 16) } } }.each(&:join)
+
+    stats = component.stats
+
+    assert_equal 2000, stats[:hits] + stats[:misses]
+    assert_operator stats[:entries], :<=, 8
+  end
+end
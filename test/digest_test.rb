@@ -0,0 +1,60 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Digest do
+  it 'computes XXH64 digests' do
+    assert_equal 'ef46db3751d8e999', Berns::Digest.hexdigest('')
+    assert_equal 'd24ec4f1a98c6e5b', Berns::Digest.hexdigest('a')
+    assert_equal '44bc2cf5ad770999', Berns::Digest.hexdigest('abc')
+    assert_equal 'fbcea83c8a378bf1', Berns::Digest.hexdigest('Nobody inspects the spammish repetition')
+  end
+
+  it 'gives the same digest however the input is split up' do
+    string = (0..2000).map(&:to_s).join.freeze
+    expected = Berns::Digest.hexdigest(string)
+
+    [1, 3, 7, 31, 32, 33, 100, 4096].each do |size|
+      digest = Berns::Digest.new
+      string.each_char.each_slice(size) { |chunk| digest << chunk.join }
+
+      assert_equal expected, digest.hexdigest, "chunks of #{ size }"
+    end
+  end
+
+  it 'hashes from an offset' do
+    digest = Berns::Digest.new.update('skip this, hash this', 11)
+
+    assert_equal Berns::Digest.hexdigest('hash this'), digest.hexdigest
+    assert_raises(IndexError) { Berns::Digest.new.update('abc', 4) }
+    assert_raises(IndexError) { Berns::Digest.new.update('abc', -1) }
+  end
+
+  it 'raises an error for non-strings' do
+    assert_raises(TypeError) { Berns::Digest.new << 1 }
+    assert_raises(TypeError) { Berns::Digest.hexdigest(nil) }
+  end
+
+  it 'converts to an integer, string, and ETag' do
+    digest = Berns::Digest.new << 'abc'
+
+    assert_equal 0x44bc2cf5ad770999, digest.to_i
+    assert_equal '44bc2cf5ad770999', digest.to_s
+    assert_equal '"44bc2cf5ad770999"', digest.etag
+  end
+
+  it 'can be reset and copied' do
+    digest = Berns::Digest.new << 'abc'
+    copy = digest.dup
+
+    digest.reset << 'a'
+    copy << 'd'
+
+    assert_equal Berns::Digest.hexdigest('a'), digest.hexdigest
+    assert_equal Berns::Digest.hexdigest('abcd'), copy.hexdigest
+  end
+
+  it 'can not be updated when frozen' do
+    assert_raises(FrozenError) { Berns::Digest.new.freeze << 'a' }
+  end
+end
@@ -0,0 +1,184 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+require 'stringio'
+require 'fileutils'
+require 'tmpdir'
+
+# Larger than one chunk, with escapes landing on either side of the boundary.
+content = ((('x' * 1023) + '<') * 200 + %(a & b "c" 'd' <e>\n)).freeze
+
+describe 'Berns.escape_file' do
+  before do
+    @dir = Dir.mktmpdir('berns')
+    @input = File.join(@dir, 'input.txt')
+    File.binwrite(@input, content)
+  end
+
+  after { FileUtils.remove_entry(@dir) }
+
+  it 'escapes a file to a path' do
+    output = File.join(@dir, 'output.html')
+
+    assert_equal Berns.escape_html(content).bytesize, Berns.escape_file(@input, output)
+    assert_equal Berns.escape_html(content), File.binread(output)
+  end
+
+  it 'truncates an existing output file' do
+    output = File.join(@dir, 'output.html')
+    File.write(output, 'y' * (content.bytesize * 2))
+    Berns.escape_file(@input, output)
+
+    assert_equal Berns.escape_html(content), File.binread(output)
+  end
+
+  it 'accepts Pathnames' do
+    require 'pathname'
+    output = Pathname(@dir).join('output.html')
+    Berns.escape_file(Pathname(@input), output)
+
+    assert_equal Berns.escape_html(content), output.binread
+  end
+
+  it 'escapes a file to an IO after whatever it has buffered' do
+    output = File.join(@dir, 'output.html')
+
+    File.open(output, 'w') do |file|
+      file.write('<pre>')
+      Berns.escape_file(@input, file)
+      file.write('</pre>')
+    end
+
+    assert_equal "<pre>#{ Berns.escape_html(content) }</pre>", File.read(output)
+  end
+
+  it 'escapes a file to a pipe' do
+    reader, writer = IO.pipe
+    thread = Thread.new { reader.read }
+    Berns.escape_file(@input, writer)
+    writer.close
+
+    assert_equal Berns.escape_html(content), thread.value
+  end
+
+  it 'escapes a file to anything with a write method' do
+    output = StringIO.new
+
+    assert_equal Berns.escape_html(content).bytesize, Berns.escape_file(@input, output)
+    assert_equal Berns.escape_html(content), output.string
+  end
+
+  it 'copies CRLF line endings and ^Z bytes as-is' do
+    File.binwrite(@input, "a\r\n<b>\x1Ac\r\n")
+    output = File.join(@dir, 'output.html')
+    expected = "a\r\n&lt;b&gt;\x1Ac\r\n".b
+
+    Berns.escape_file(@input, output)
+
+    assert_equal expected, File.binread(output)
+
+    File.open(output, 'wb') { |file| Berns.escape_file(@input, file) }
+
+    assert_equal expected, File.binread(output)
+  end
+
+  it 'writes through IOs that convert encodings or newlines' do
+    output = File.join(@dir, 'output.html')
+
+    File.open(output, 'w:UTF-16LE') { |file| Berns.escape_file(@input, file) }
+
+    assert_equal Berns.escape_html(content).encode(Encoding::UTF_16LE).b, File.binread(output)
+
+    File.open(output, 'w', crlf_newline: true) { |file| Berns.escape_file(@input, file) }
+
+    assert_equal Berns.escape_html(content).gsub("\n", "\r\n"), File.binread(output)
+  end
+
+  it 'escapes an empty file' do
+    File.write(@input, '')
+    output = File.join(@dir, 'output.html')
+
+    assert_equal 0, Berns.escape_file(@input, output)
+    assert_equal '', File.read(output)
+  end
+
+  it 'raises an error for missing files' do
+    assert_raises(Errno::ENOENT) { Berns.escape_file(File.join(@dir, 'missing'), StringIO.new) }
+    assert_raises(Errno::ENOENT) { Berns.escape_file(File.join(@dir, 'missing'), File.join(@dir, 'output.html')) }
+    assert_raises(Errno::ENOENT) { Berns.escape_file(@input, File.join(@dir, 'missing', 'output.html')) }
+  end
+
+  it 'raises an error instead of escaping a file onto itself' do
+    assert_raises(ArgumentError) { Berns.escape_file(@input, @input) }
+    File.open(@input, 'a') { |file| assert_raises(ArgumentError) { Berns.escape_file(@input, file) } }
+
+    assert_equal content, File.binread(@input)
+  end
+
+  it 'raises an error for output that cannot be written' do
+    assert_raises(NoMethodError) { Berns.escape_file(@input, Object.new) }
+    assert_raises(TypeError) { Berns.escape_file(nil, StringIO.new) }
+  end
+end
+
+describe 'Berns.escape_stream' do
+  it 'escapes from one IO to another' do
+    input = StringIO.new(content)
+    output = StringIO.new
+
+    assert_equal Berns.escape_html(content).bytesize, Berns.escape_stream(input, output)
+    assert_equal Berns.escape_html(content), output.string
+  end
+
+  it 'escapes from the current position of the input' do
+    input = StringIO.new("<b>\n<i>")
+    input.gets
+    output = StringIO.new
+
+    Berns.escape_stream(input, output)
+
+    assert_equal '&lt;i&gt;', output.string
+  end
+
+  it 'uses the string read returns rather than the buffer it was given' do
+    reader = Object.new
+    chunks = ['<a>', '&b']
+    reader.define_singleton_method(:read) { |_size, _buffer| chunks.shift }
+    output = StringIO.new
+
+    assert_equal 15, Berns.escape_stream(reader, output)
+    assert_equal '&lt;a&gt;&amp;b', output.string
+  end
+
+  it 'stops when read returns an empty string' do
+    reader = Object.new
+    chunks = ['<a>']
+    reader.define_singleton_method(:read) { |_size, _buffer| chunks.shift || '' }
+    output = StringIO.new
+
+    Berns.escape_stream(reader, output)
+
+    assert_equal '&lt;a&gt;', output.string
+  end
+
+  it 'writes a new string for each chunk' do
+    writes = []
+    writer = Object.new
+    writer.define_singleton_method(:write) { |string| writes << string }
+
+    Berns.escape_stream(StringIO.new(content), writer)
+
+    assert_equal Berns.escape_html(content), writes.join
+    assert_equal writes.length, writes.map(&:object_id).uniq.length
+    assert writes.all?(&:frozen?)
+  end
+
+  it 'escapes from a pipe' do
+    reader, writer = IO.pipe
+    Thread.new { writer.write(content); writer.close }
+    output = StringIO.new
+    Berns.escape_stream(reader, output)
+
+    assert_equal Berns.escape_html(content), output.string
+  end
+end
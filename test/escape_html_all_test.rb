@@ -0,0 +1,92 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns do
+  describe '#escape_html_all' do
+    it 'escapes every string in an array' do
+      assert_equal ['&lt;&quot;tag&quot;', 'clean', ''], Berns.escape_html_all(['<"tag"', 'clean', ''])
+      assert_empty Berns.escape_html_all([])
+    end
+
+    it 'reuses strings that do not need escaping' do
+      clean = 'Nothing to see here'
+      result = Berns.escape_html_all([clean, '<b>'])
+
+      assert_same clean, result.first
+      assert_equal Encoding::UTF_8, result.last.encoding
+    end
+
+    it 'gives the same results with and without the GVL' do
+      strings = Array.new(100) { |i| "Row #{ i } <b>'bold'</b> & \"quoted\" #{ 'x' * i * 10 }" }
+      expected = strings.map { |string| Berns.escape_html(string) }
+
+      assert_equal expected, Berns.escape_html_all(strings, without_gvl: true)
+      assert_equal expected, Berns.escape_html_all(strings, without_gvl: false)
+    end
+
+    it 'escapes the strings as they were when called even if html_safe? changes them' do
+      victim = +'<b>'
+      meddler = Class.new(String) do
+        define_method(:html_safe?) do
+          victim << ('<i>' * 1000)
+          false
+        end
+      end
+
+      [true, false].each do |without_gvl|
+        victim.replace('<b>')
+        strings = [victim, meddler.new('<u>'), victim]
+
+        assert_equal ['&lt;b&gt;', '&lt;u&gt;', '&lt;b&gt;'], Berns.escape_html_all(strings, without_gvl: without_gvl)
+      end
+    end
+
+    it 'returns the strings it scanned even if html_safe? changes the array' do
+      clean = +'clean'
+      strings = nil
+      meddler = Class.new(String) do
+        define_method(:html_safe?) do
+          clean.replace('<script>')
+          strings.clear
+          false
+        end
+      end
+
+      [true, false].each do |without_gvl|
+        clean.replace('clean')
+        strings = [meddler.new('<u>'), clean, clean]
+        result = Berns.escape_html_all(strings, without_gvl: without_gvl)
+
+        assert_equal ['&lt;u&gt;', 'clean', 'clean'], result
+        assert_predicate result.last, :frozen?
+      end
+    end
+
+    it 'escapes the right bytes even if html_safe? compacts the heap' do
+      skip 'GC.compact is not supported' unless GC.respond_to?(:compact)
+
+      meddler = Class.new(String) do
+        def html_safe?
+          GC.compact
+          false
+        end
+      end
+
+      [true, false].each do |without_gvl|
+        strings = Array.new(50) { |i| "<#{ i }>" }
+        strings.insert(25, meddler.new('<u>'))
+        expected = strings.map { |string| Berns.escape_html(String.new(string)) }
+
+        assert_equal expected, Berns.escape_html_all(strings, without_gvl: without_gvl)
+      end
+    end
+
+    it 'raises an error for non-array values or non-string elements' do
+      assert_raises(TypeError) { Berns.escape_html_all('nope') }
+      assert_raises(TypeError) { Berns.escape_html_all(['ok', :nope]) }
+      assert_raises(TypeError) { Berns.escape_html_all(['ok', nil]) }
+      assert_raises(ArgumentError) { Berns.escape_html_all([], nope: true) }
+    end
+  end
+end
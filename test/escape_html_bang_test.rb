@@ -0,0 +1,41 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns do
+  describe '#escape_html!' do
+    it 'escapes HTML strings in place' do
+      string = +'<"tag"'
+      result = Berns.escape_html!(string)
+
+      assert_same string, result
+      assert_equal '&lt;&quot;tag&quot;', string
+    end
+
+    it 'matches #escape_html for longer strings' do
+      string = +"Some <b>bold</b> & 'quoted' text that is long enough to use the vectorized \"path\" >>"
+      expected = Berns.escape_html(string)
+
+      Berns.escape_html!(string)
+
+      assert_equal expected, string
+    end
+
+    it 'returns nil when there is nothing to escape' do
+      string = +'Nothing to see here'
+
+      assert_nil Berns.escape_html!(string)
+      assert_equal 'Nothing to see here', string
+    end
+
+    it 'raises an error for frozen strings' do
+      assert_raises(FrozenError) { Berns.escape_html!('<"tag"') }
+    end
+
+    it 'raises an error for non-string values' do
+      assert_raises(TypeError) { Berns.escape_html!(:nope) }
+      assert_raises(TypeError) { Berns.escape_html!(['nope']) }
+      assert_raises(TypeError) { Berns.escape_html!(nil) }
+    end
+  end
+end
@@ -13,5 +13,108 @@ describe Berns do
       assert_raises(TypeError) { Berns.escape_html(['nope']) }
       assert_raises(TypeError) { Berns.escape_html({ no: 'pe' }) }
     end
+
+    describe 'with invalid:' do
+      it 'replaces invalid UTF-8 while escaping with :replace' do
+        result = Berns.escape_html((+"<\xE3\x81 & \xFF>").force_encoding(Encoding::BINARY), invalid: :replace)
+
+        assert_equal "&lt;\uFFFD &amp; \uFFFD&gt;", result
+        assert_equal Encoding::UTF_8, result.encoding
+        assert_kind_of Berns::SafeString, result
+      end
+
+      it 'replaces each maximal invalid subsequence like String#scrub' do
+        [
+          "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xE0\x80", "\xF0\x9F\x98<", "a\x80\x80b", '😀' * 20 + "\xF0\x9F"
+        ].each do |input|
+          input = (+input).force_encoding(Encoding::UTF_8)
+
+          assert_equal Berns.escape_html(input.scrub), Berns.escape_html(input, invalid: :replace)
+        end
+      end
+
+      it 'raises on invalid UTF-8 with :raise' do
+        error = assert_raises(Encoding::InvalidByteSequenceError) { Berns.escape_html("ok <\xFF", invalid: :raise) }
+
+        assert_match(/\\xFF at byte 4/, error.message)
+      end
+
+      it 'returns clean, valid UTF-8 strings as-is with a valid coderange' do
+        string = +'clean ünïcode'
+
+        assert_same string, Berns.escape_html(string, invalid: :raise)
+        assert_predicate string, :valid_encoding?
+      end
+
+      it 'converts clean strings in other encodings to UTF-8' do
+        result = Berns.escape_html((+'clean ü').force_encoding(Encoding::BINARY), invalid: :replace)
+
+        assert_equal 'clean ü', result
+        assert_equal Encoding::UTF_8, result.encoding
+      end
+
+      it 'copies US-ASCII strings with high bytes to UTF-8 without touching them' do
+        %i[replace raise].each do |invalid|
+          ascii = (+"caf\xC3\xA9").force_encoding(Encoding::US_ASCII)
+          result = Berns.escape_html(ascii, invalid: invalid)
+
+          refute_same ascii, result
+          assert_equal 'café', result
+          assert_equal Encoding::UTF_8, result.encoding
+          assert_predicate result, :valid_encoding?
+          assert_equal Encoding::US_ASCII, ascii.encoding
+          refute_predicate ascii, :valid_encoding?
+        end
+      end
+
+      it 'returns clean US-ASCII strings as-is' do
+        ascii = (+'clean').force_encoding(Encoding::US_ASCII)
+
+        assert_same ascii, Berns.escape_html(ascii, invalid: :replace)
+        assert_predicate ascii, :valid_encoding?
+      end
+
+      it 'transcodes other ASCII-compatible encodings to UTF-8' do
+        latin1 = (+"caf\xE9 <b>").force_encoding(Encoding::ISO_8859_1)
+
+        assert_equal 'café &lt;b&gt;', Berns.escape_html(latin1, invalid: :replace)
+        assert_equal 'café', Berns.escape_html((+"caf\xE9").force_encoding(Encoding::ISO_8859_1), invalid: :raise)
+        assert_equal Encoding::UTF_8, Berns.escape_html(latin1, invalid: :raise).encoding
+      end
+
+      it 'replaces or raises on bytes that cannot be transcoded' do
+        undefined = (+"a\x81<").force_encoding(Encoding::Windows_1252)
+
+        assert_equal "a\uFFFD&lt;", Berns.escape_html(undefined, invalid: :replace)
+        assert_raises(Encoding::UndefinedConversionError) { Berns.escape_html(undefined, invalid: :raise) }
+        assert_raises(Encoding::InvalidByteSequenceError) { Berns.escape_html((+"\x82").force_encoding(Encoding::Shift_JIS), invalid: :raise) }
+      end
+
+      it 'raises an error for encodings that are not ASCII-compatible' do
+        assert_raises(Encoding::CompatibilityError) { Berns.escape_html('<b>'.encode(Encoding::UTF_16LE), invalid: :replace) }
+        assert_raises(Encoding::CompatibilityError) { Berns.escape_html('<b>'.encode(Encoding::UTF_16BE), invalid: :raise) }
+      end
+
+      it 'escapes long strings that grow past the first guess' do
+        input = (+"<\xFF>" * 10_000).force_encoding(Encoding::BINARY)
+
+        assert_equal "&lt;\uFFFD&gt;" * 10_000, Berns.escape_html(input, invalid: :replace)
+      end
+
+      it 'escapes as usual with nil' do
+        assert_equal '&lt;&quot;tag&quot;', Berns.escape_html('<"tag"', invalid: nil)
+      end
+
+      it 'returns safe strings as-is' do
+        safe = Berns::SafeString.new("<\xFF")
+
+        assert_same safe, Berns.escape_html(safe, invalid: :raise)
+      end
+
+      it 'raises an error for other values' do
+        assert_raises(ArgumentError) { Berns.escape_html('nope', invalid: :ignore) }
+        assert_raises(ArgumentError) { Berns.escape_html('nope', nope: :replace) }
+      end
+    end
   end
 end
@@ -0,0 +1,55 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Histogram do
+  it 'starts empty' do
+    histogram = Berns::Histogram.new
+
+    assert_equal({ count: 0, sum: 0, buckets: {} }, histogram.to_h)
+  end
+
+  it 'counts values in power of two buckets with inclusive upper bounds' do
+    histogram = Berns::Histogram.new
+    [0, 1, 2, 3, 4, 5, 1024, 1025].each { |value| histogram << value }
+
+    assert_equal 8, histogram.count
+    assert_equal 2064, histogram.sum
+    assert_equal({ 0 => 1, 1 => 1, 2 => 1, 4 => 2, 8 => 1, 1024 => 1, 2048 => 1 }, histogram.buckets)
+  end
+
+  it 'counts negative values as zero' do
+    histogram = Berns::Histogram.new.record(-5)
+
+    assert_equal({ count: 1, sum: 0, buckets: { 0 => 1 } }, histogram.to_h)
+  end
+
+  it 'counts huge values in the last bucket' do
+    histogram = Berns::Histogram.new.record(2**63 - 1)
+
+    assert_equal [2**62], histogram.buckets.keys
+  end
+
+  it 'raises an error for non-integers' do
+    assert_raises(TypeError) { Berns::Histogram.new.record('1') }
+  end
+
+  it 'resets' do
+    histogram = Berns::Histogram.new.record(10).reset
+
+    assert_equal 0, histogram.count
+    assert_empty histogram.buckets
+  end
+
+  it 'copies its counts when duplicated' do
+    histogram = Berns::Histogram.new.record(10)
+    copy = histogram.dup.record(20)
+
+    assert_equal 1, histogram.count
+    assert_equal 2, copy.count
+  end
+
+  it 'raises an error when frozen' do
+    assert_raises(FrozenError) { Berns::Histogram.new.freeze.record(1) }
+  end
+end
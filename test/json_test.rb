@@ -0,0 +1,58 @@
+# frozen_string_literal: true
+require 'berns'
+require 'cgi/escape'
+require 'json'
+require 'minitest/autorun'
+
+describe 'Berns#json' do
+  def expected(attr, value)
+    %(#{ attr }="#{ CGI.escapeHTML(JSON.generate(value)) }")
+  end
+
+  it 'wraps a value in a frozen Berns::JSONValue' do
+    json = Berns.json({ a: 1 })
+
+    assert_kind_of Berns::JSONValue, json
+    assert_equal({ a: 1 }, json.value)
+    assert_predicate json, :frozen?
+  end
+
+  it 'serializes and escapes hashes and arrays as attribute values' do
+    value = { name: %(Tom & "Jerry's" <friends>), tags: ['a', :b, 1, 2.5, nil, true, false], nested: { 'deep' => [{ x: -12_345_678_901_234_567_890 }] } }
+
+    assert_equal expected('data-config', value), Berns.to_attribute('data-config', Berns.json(value))
+    assert_equal expected('data-config', value), Berns.to_attributes(data: { config: Berns.json(value) })
+  end
+
+  it 'escapes control characters and backslashes like the json gem' do
+    value = ["line\nbreak\ttab\\slash\u0001\u001f/", 'Café — naïve']
+
+    assert_equal expected('data-x', value), Berns.to_attribute(:'data-x', Berns.json(value))
+  end
+
+  it 'serializes scalar values and empty containers' do
+    [nil, true, 'string', 42, 1.0e+20, [], {}].each do |value|
+      assert_equal expected('data-x', value), Berns.to_attribute(:'data-x', Berns.json(value))
+    end
+  end
+
+  it 'works in element attributes' do
+    assert_equal %(<div data-config="{&quot;a&quot;:[1,2]}"></div>), Berns.div(data: { config: Berns.json({ a: [1, 2] }) })
+  end
+
+  it 'serializes other objects as strings using #to_s' do
+    assert_equal %(data-x="[&quot;Berns&quot;]"), Berns.to_attribute(:'data-x', Berns.json([Berns]))
+  end
+
+  it 'raises an error for values that are not valid JSON' do
+    assert_raises(ArgumentError) { Berns.to_attribute(:x, Berns.json(Float::NAN)) }
+    assert_raises(ArgumentError) { Berns.to_attribute(:x, Berns.json([Float::INFINITY])) }
+  end
+
+  it 'raises an error for values that are nested too deeply' do
+    recursive = []
+    recursive << recursive
+
+    assert_raises(ArgumentError) { Berns.to_attribute(:x, Berns.json(recursive)) }
+  end
+end
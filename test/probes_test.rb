@@ -0,0 +1,35 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Probes do
+  it 'is disabled without a tracer attached' do
+    assert_includes [true, false], Berns::Probes::AVAILABLE
+    refute Berns::Probes.enabled?
+  end
+
+  it 'is enabled while a tracer is attached to a render probe' do
+    skip 'built without sys/sdt.h' unless Berns::Probes::AVAILABLE
+
+    require 'fiddle'
+    library = Fiddle::Handle.new($LOADED_FEATURES.grep(%r{berns/berns\.(so|bundle|dll)\z}).first)
+    semaphore = Fiddle::Pointer.new(library['berns_render_start_semaphore'])
+
+    # This is what bpftrace, perf, and SystemTap do when they attach.
+    semaphore[0, 2] = [1].pack('S')
+
+    assert_predicate Berns::Probes, :enabled?
+  ensure
+    semaphore[0, 2] = [0].pack('S') if semaphore
+  end
+
+  it 'fires the render probes' do
+    assert_nil Berns::Probes.render_start('template.rb:1')
+    assert_nil Berns::Probes.render_done('template.rb:1', 10)
+  end
+
+  it 'checks render probe arguments' do
+    assert_raises(TypeError) { Berns::Probes.render_start(nil) }
+    assert_raises(TypeError) { Berns::Probes.render_done(nil, 10) }
+  end
+end
@@ -0,0 +1,136 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Builder::Retained do
+  let(:runs) { Hash.new(0) }
+
+  let(:builder) do
+    runs = self.runs
+
+    Berns::Builder.new(retain: true) do |load, jobs|
+      div(class: 'dashboard') do
+        h1 { 'Status' }
+        section do
+          slot(:load, load) { runs[:load] += 1; span(id: 'load') { load.to_s } }
+        end
+        slot(:jobs, jobs) { runs[:jobs] += 1; ul(id: 'jobs') { jobs.each { |job| li { job } } } }
+      end
+    end
+  end
+
+  def assert_slots(output, slots)
+    assert_equal slots.keys, builder.slots.keys
+    slots.each { |name, html| assert_equal html, output.byteslice(builder.slots[name]), "slot #{ name }" }
+  end
+
+  it 'renders like a regular builder and reports every slot as changed at first' do
+    output = builder.call(1, %w[a b])
+
+    assert_equal '<div class="dashboard"><h1>Status</h1><section><span id="load">1</span></section><ul id="jobs"><li>a</li><li>b</li></ul></div>', output
+    assert_slots output, load: '<span id="load">1</span>', jobs: '<ul id="jobs"><li>a</li><li>b</li></ul>'
+    assert_equal builder.slots, builder.changes
+  end
+
+  it 'skips slots whose inputs have not changed' do
+    builder.call(1, %w[a b])
+    output = builder.call(1, %w[a c])
+
+    assert_equal({ load: 1, jobs: 2 }, runs)
+    assert_equal [:jobs], builder.changes.keys
+    assert_equal '<ul id="jobs"><li>a</li><li>c</li></ul>', output.byteslice(builder.changes[:jobs])
+    assert_slots output, load: '<span id="load">1</span>', jobs: '<ul id="jobs"><li>a</li><li>c</li></ul>'
+  end
+
+  it 'reports ranges that moved with the output before them' do
+    builder.call(1, %w[a])
+    output = builder.call(1000, %w[a])
+
+    assert_equal [:load], builder.changes.keys
+    assert_slots output, load: '<span id="load">1000</span>', jobs: '<ul id="jobs"><li>a</li></ul>'
+  end
+
+  it 'leaves slots out of the changes when new inputs render the same HTML' do
+    builder.call(1, %w[a])
+    builder.call(1.0, %w[a])
+
+    assert_equal({ load: 1, jobs: 1 }, runs)
+
+    builder.call('1', %w[a])
+
+    assert_equal 2, runs[:load]
+    assert_empty builder.changes
+  end
+
+  it 'renders every slot again after invalidate' do
+    builder.call(1, %w[a])
+    builder.invalidate
+    builder.call(1, %w[a])
+
+    assert_equal({ load: 2, jobs: 2 }, runs)
+    assert_equal builder.slots, builder.changes
+  end
+
+  it 'tracks slots inside element, preserved, and nested elements' do
+    builder = Berns::Builder.new(retain: true) do |code|
+      element(:custom, class: 'x') do
+        pre { slot(:code, code) { code { code } } }
+        p { b { i { slot(:deep) { text "<#{ code }>" } } } }
+      end
+    end
+
+    output = builder.call('a < b')
+
+    assert_equal '<custom class="x"><pre><code>a &lt; b</code></pre><p><b><i>&lt;a &lt; b&gt;</i></b></p></custom>', output
+    assert_equal '<code>a &lt; b</code>', output.byteslice(builder.slots[:code])
+    assert_equal '&lt;a &lt; b&gt;', output.byteslice(builder.slots[:deep])
+  end
+
+  it 'compiles' do
+    runs = self.runs
+    compiled = Berns::Builder.new(retain: true) { |count:| div { slot(:count, count) { runs[:count] += 1; count.to_s } } }.compile
+
+    assert_equal '<div>1</div>', compiled.call(count: 1)
+    assert_equal '<div>1</div>', compiled.call(count: 1)
+    assert_equal 1, runs[:count]
+    assert_empty compiled.changes
+  end
+
+  it 'minifies' do
+    output = Berns::Builder.new(retain: true, minify: true) { div { slot(:text) { text "a \n b" } } }.call
+
+    assert_equal '<div>a b</div>', output
+  end
+
+  it 'collapses whitespace where a slot meets what comes before it' do
+    template = proc { |value| div { text 'a '; slot(:a, value) { text ' x ' }; text ' b' } }
+    expected = Berns::Builder.new(minify: true) { div { text 'a '; text ' x '; text ' b' } }.call
+    builder = Berns::Builder.new(retain: true, minify: true, &template)
+
+    2.times do
+      output = builder.call(1)
+
+      assert_equal '<div>a x b</div>', output
+      assert_equal expected, output
+      assert_equal 'x ', output.byteslice(builder.slots[:a])
+    end
+
+    assert_equal '<div>a  x  b</div>', Berns::Builder.new(retain: true, &template).call(1)
+  end
+
+  it 'raises an error for nested slots' do
+    builder = Berns::Builder.new(retain: true) { slot(:outer) { slot(:inner) { 'x' } } }
+
+    assert_raises(ArgumentError) { builder.call }
+  end
+
+  it 'raises an error for slots rendered twice' do
+    builder = Berns::Builder.new(retain: true) { 2.times { slot(:same) { 'x' } } }
+
+    assert_raises(ArgumentError) { builder.call }
+  end
+
+  it 'leaves regular builders without slots' do
+    refute_respond_to Berns::Builder.new { 'x' }, :slot
+  end
+end
@@ -0,0 +1,165 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+require 'stringio'
+
+describe Berns::Rope do
+  let(:large) { ('x' * Berns::Rope::MIN_REFERENCE).freeze }
+
+  describe '#<<' do
+    it 'copies small fragments into one fragment' do
+      rope = Berns::Rope.new
+      rope << '<p>' << 'a' << '</p>'
+
+      assert_equal ['<p>a</p>'], rope.fragments
+      assert_equal 8, rope.bytesize
+    end
+
+    it 'references large frozen fragments' do
+      rope = Berns::Rope.new
+      rope << '<div>' << large << '</div>'
+
+      assert_equal 3, rope.fragments.length
+      assert_same large, rope.fragments[1]
+    end
+
+    it 'keeps large unfrozen fragments from changing underneath it' do
+      string = +('y' * Berns::Rope::MIN_REFERENCE)
+      rope = Berns::Rope.new
+      rope << string
+      string << 'z'
+
+      assert_equal 'y' * Berns::Rope::MIN_REFERENCE, rope.to_s
+    end
+
+    it 'skips empty strings' do
+      rope = Berns::Rope.new
+      rope << ''
+
+      assert_empty rope
+      assert_empty rope.fragments
+    end
+  end
+
+  describe '#to_s' do
+    it 'flattens every fragment into a frozen safe string' do
+      rope = Berns::Rope.new
+      rope << 'a' << large << 'b'
+
+      assert_equal "a#{ large }b", rope.to_s
+      assert_predicate rope.to_s, :frozen?
+      assert_predicate rope.to_s, :html_safe?
+      assert_same rope.to_s, rope.to_s
+    end
+
+    it 'flattens again after another append' do
+      rope = Berns::Rope.new
+      rope << 'a'
+      rope.to_s
+      rope << 'b'
+
+      assert_equal 'ab', rope.to_s
+    end
+
+    it 'flattens a frozen rope' do
+      rope = Berns::Rope.new
+      rope << 'a'
+      rope.freeze
+
+      assert_equal 'a', rope.to_s
+      assert_same rope.to_s, rope.to_s
+      assert_raises(FrozenError) { rope << 'b' }
+    end
+
+    it 'flattens a rendered rope only once' do
+      rope = Berns::Builder.new(rope: true) { div { text 'x' * Berns::Rope::MIN_REFERENCE } }.call
+
+      assert_predicate rope, :frozen?
+      assert_same rope.to_s, rope.to_str
+      assert_equal rope, rope.to_s
+    end
+  end
+
+  describe '#write_to' do
+    it 'writes every fragment in order' do
+      rope = Berns::Rope.new
+      rope << 'a' << large << 'b' << large
+
+      reader, writer = IO.pipe
+      written = rope.write_to(writer)
+      writer.close
+
+      assert_equal rope.bytesize, written
+      assert_equal rope.to_s, reader.read
+    end
+
+    it 'writes more fragments than fit in one call' do
+      rope = Berns::Rope.new
+      (Berns::Rope::MAX_WRITE + 3).times { rope << large }
+      io = StringIO.new
+
+      assert_equal rope.bytesize, rope.write_to(io)
+      assert_equal rope.to_s, io.string
+    end
+  end
+
+  it 'works as a Rack body' do
+    rope = Berns::Rope.new
+    rope << 'a' << large
+
+    yielded = []
+
+    assert_same rope, rope.each { |fragment| yielded << fragment }
+    assert_equal ['a', large], yielded
+    assert_equal ['a', large], rope.each.to_a
+  end
+end
+
+describe Berns::Builder do
+  let(:partial) { Berns.div { 'x' * Berns::Rope::MIN_REFERENCE }.freeze }
+
+  it 'returns a frozen rope when initialized with rope: true' do
+    partial = self.partial
+    builder = Berns::Builder.new(rope: true) do
+      h1 { 'Title' }
+      raw partial
+      p { 'Footer' }
+    end
+
+    output = builder.call
+
+    assert_kind_of Berns::Rope, output
+    assert_predicate output, :frozen?
+    assert_same partial, output.fragments[1]
+    assert_equal Berns::Builder.new { h1 { 'Title' }; raw partial; p { 'Footer' } }.call, output.to_s
+  end
+
+  it 'returns a rope when the block returns a string' do
+    output = Berns::Builder.new(rope: true) { '<b>' }.call
+
+    assert_equal '&lt;b&gt;', output.to_s
+  end
+
+  it 'digests the output' do
+    partial = self.partial
+    block = proc { div { text 'a' }; raw partial }
+    rope = Berns::Builder.new(rope: true, digest: true, &block)
+    string = Berns::Builder.new(digest: true, &block)
+
+    assert_equal string.call, rope.call.to_s
+    assert_equal string.etag, rope.etag
+  end
+
+  it 'compiles with rope: true' do
+    output = Berns::Builder.new(rope: true) { |name:| h1 { name } }.compile.call(name: 'Berns')
+
+    assert_kind_of Berns::Rope, output
+    assert_equal '<h1>Berns</h1>', output.to_s
+  end
+
+  it 'minifies' do
+    output = Berns::Builder.new(rope: true, minify: true) { text 'a  '; text '  b' }.call
+
+    assert_equal 'a b', output.to_s
+  end
+end
@@ -0,0 +1,149 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::SafeString do
+  # Stands in for ActiveSupport::SafeBuffer, which is only html_safe? until it's
+  # modified unsafely.
+  let(:buffer_class) do
+    Class.new(String) do
+      def html_safe?
+        !@unsafe
+      end
+
+      def unsafe!
+        @unsafe = true
+        self
+      end
+    end
+  end
+
+  it 'is returned by element methods' do
+    assert_instance_of Berns::SafeString, Berns.div { 'Content' }
+    assert_instance_of Berns::SafeString, Berns.br
+    assert_instance_of Berns::SafeString, Berns.element(:custom)
+    assert_instance_of Berns::SafeString, Berns.void(:custom, class: 'a')
+    assert_equal Encoding::UTF_8, Berns.div.encoding
+  end
+
+  it 'is returned when escaping changed something' do
+    escaped = Berns.escape_html('a < b')
+
+    assert_instance_of Berns::SafeString, escaped
+    assert_equal Encoding::UTF_8, escaped.encoding
+    assert_instance_of Berns::SafeString, Berns.escape_html_all(['<'])[0]
+    assert_instance_of Berns::SafeString, Berns.snippet('a < b', 3)
+  end
+
+  it 'is not returned when escaping changed nothing' do
+    clean = +'no tags here'
+
+    assert_same clean, Berns.escape_html(clean)
+    assert_instance_of String, Berns.escape_html(clean)
+    refute_predicate Berns.escape_html(clean), :frozen?
+  end
+
+  it 'is returned by builders' do
+    assert_instance_of Berns::SafeString, Berns::Builder.new { div { 'x' } }.call
+    assert_instance_of Berns::SafeString, Berns::Builder.new(capacity: 8192) { div { 'x' } }.call
+    assert_equal Encoding::UTF_8, Berns::Builder.new { p }.call.encoding
+  end
+
+  it 'is not escaped again' do
+    safe = Berns::SafeString.new('<b>&amp;</b>')
+
+    assert_same safe, Berns.escape_html(safe)
+    assert_nil Berns.escape_html!(safe)
+    assert_same safe, Berns.escape_html_all([safe], without_gvl: true)[0]
+    assert_equal '<p><b>&amp;</b></p>', Berns::Builder.new { p { text safe } }.call
+    assert_equal '<b>&amp;</b>', Berns::Builder.new { safe }.call
+  end
+
+  it 'is html_safe' do
+    safe = Berns::SafeString.new('<b>')
+
+    assert_predicate safe, :html_safe?
+    assert_same safe, safe.html_safe
+    assert_same safe, safe.to_s
+  end
+
+  it 'trusts strings that are html_safe' do
+    assert_equal '<b>', Berns.escape_html(buffer_class.new('<b>'))
+    assert_equal '&lt;b&gt;', Berns.escape_html(buffer_class.new('<b>').unsafe!)
+  end
+
+  it 'does not trust plain strings' do
+    assert_equal '&lt;b&gt;', Berns.escape_html('<b>')
+  end
+
+  it 'is frozen when returned by Berns' do
+    [
+      Berns.div { 'Content' }, Berns.br, Berns.element(:custom), Berns.void(:custom, class: 'a'),
+      Berns.escape_html('a < b'), Berns.escape_html("a < \xFF", invalid: :replace), Berns.escape_html_all(['<'])[0],
+      Berns.snippet('a < b', 3), Berns::Builder.new { div { 'x' } }.call
+    ].each do |safe|
+      assert_predicate safe, :frozen?
+    end
+  end
+
+  it 'cannot have untrusted HTML appended to it' do
+    html = Berns.p { 'hi' }
+
+    assert_raises(FrozenError) { html << '<script>alert(1)</script>' }
+    assert_raises(FrozenError) { html.concat('<script>') }
+    assert_raises(FrozenError) { html.insert(0, '<script>') }
+    assert_raises(FrozenError) { html.prepend('<script>') }
+    assert_raises(FrozenError) { html[0] = '<script>' }
+    assert_raises(FrozenError) { html.gsub!('hi', '<script>') }
+    assert_raises(FrozenError) { html.sub!('hi', '<script>') }
+    assert_equal '<p>hi</p>', Berns.escape_html(html)
+    assert_equal '<div><p>hi</p></div>', Berns::Builder.new { div { text html } }.call
+  end
+
+  it 'cannot be replaced with untrusted HTML' do
+    escaped = Berns.escape_html('a&b')
+
+    assert_raises(FrozenError) { escaped.replace('<img onerror=alert(1)>') }
+    assert_equal 'a&amp;b', Berns.escape_html(escaped)
+  end
+
+  it 'loses its mark when copied into a plain string' do
+    copy = Berns.div + '<script>'
+
+    assert_instance_of String, copy
+    assert_equal '&lt;div&gt;&lt;/div&gt;&lt;script&gt;', Berns.escape_html(copy)
+  end
+
+  it 'loses its mark when copied into a string that can be changed' do
+    html = Berns.p { 'x' }
+
+    [html.dup, +html, html.clone(freeze: false), html.encode('UTF-8')].each do |copy|
+      assert_instance_of String, copy
+      refute_predicate copy, :frozen?
+
+      copy << '<script>'
+
+      assert_equal '&lt;p&gt;x&lt;/p&gt;&lt;script&gt;', Berns.escape_html(copy)
+      assert_equal '<div>&lt;p&gt;x&lt;/p&gt;&lt;script&gt;</div>', Berns::Builder.new { div { text copy } }.call
+    end
+  end
+
+  it 'keeps its mark when cloned frozen' do
+    html = Berns.p { 'x' }
+
+    assert_instance_of Berns::SafeString, html.clone
+    assert_instance_of Berns::SafeString, html.clone(freeze: true)
+    assert_predicate html.clone, :frozen?
+    assert_raises(ArgumentError) { html.clone(freeze: 1) }
+    assert_instance_of String, Berns::SafeString.new('<b>').clone
+  end
+
+  it 'is only trusted as the same object when not frozen' do
+    safe = Berns::SafeString.new('<b>')
+
+    assert_same safe, +safe
+    assert_instance_of String, safe.dup
+    assert_equal Encoding::UTF_16LE, safe.encode('UTF-16LE').encoding
+    assert_instance_of String, safe.encode('UTF-16LE')
+  end
+end
@@ -0,0 +1,29 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe 'Berns#sanitize_all' do
+  it 'raises an error on anything but an array of strings or nil' do
+    assert_raises(TypeError) { Berns.sanitize_all('nope') }
+    assert_raises(TypeError) { Berns.sanitize_all(['ok', 1]) }
+    assert_raises(TypeError) { Berns.sanitize_all([:symbol]) }
+  end
+
+  it 'removes HTML from every string in an array' do
+    assert_equal ['This should be clean', nil, 'Clean'], Berns.sanitize_all(['This <span>should be clean</span>', nil, 'Clean'])
+  end
+
+  it 'reuses strings that were already clean' do
+    clean = 'This should be clean'
+
+    assert_same clean, Berns.sanitize_all([clean]).first
+  end
+
+  it 'gives the same results with and without the GVL' do
+    strings = Array.new(100) { |i| "Row #{ i } <b>bold</b> &amp; #{ 'x' * i * 10 }" }
+    expected = strings.map { |string| Berns.sanitize(string) }
+
+    assert_equal expected, Berns.sanitize_all(strings, without_gvl: true)
+    assert_equal expected, Berns.sanitize_all(strings, without_gvl: false)
+  end
+end
@@ -0,0 +1,36 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe 'Berns#sanitize!' do
+  it 'raises an error on anything but a string or nil' do
+    assert_raises(TypeError) { Berns.sanitize!(1) }
+    assert_raises(TypeError) { Berns.sanitize!(:symbol) }
+    assert_raises(TypeError) { Berns.sanitize!([]) }
+  end
+
+  it 'raises an error on frozen strings' do
+    assert_raises(FrozenError) { Berns.sanitize!('This <span>is frozen</span>') }
+  end
+
+  it 'removes HTML from strings in place' do
+    string = +'This <span>should be clean</span>'
+    result = Berns.sanitize!(string)
+
+    assert_same string, result
+    assert_equal 'This should be clean', string
+
+    string = +'&lt;This <span>should&gt; be <br><br><br />clean'
+    Berns.sanitize!(string)
+
+    assert_equal 'This should be clean', string
+  end
+
+  it 'returns nil when nothing was removed' do
+    string = +'This should be clean'
+
+    assert_nil Berns.sanitize!(string)
+    assert_equal 'This should be clean', string
+    assert_nil Berns.sanitize!(nil)
+  end
+end
@@ -0,0 +1,134 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Sanitizer do
+  let(:sanitizer) { Berns::Sanitizer::DEFAULT }
+
+  it 'returns clean strings as-is' do
+    string = 'This is clean'
+
+    assert_same string, sanitizer.sanitize(string)
+  end
+
+  it 'returns sanitized output as a frozen safe string' do
+    html = sanitizer.sanitize('<p>Hi <script>x()</script><b>there</b> &amp; you</p>')
+
+    assert_instance_of Berns::SafeString, html
+    assert_predicate html, :frozen?
+    assert_equal Encoding::UTF_8, html.encoding
+    assert_equal '<div><p>Hi <b>there</b> &amp; you</p></div>', Berns::Builder.new { div { text html } }.call
+  end
+
+  it 'handles nil' do
+    assert_nil sanitizer.sanitize(nil)
+  end
+
+  it 'raises an error for non-strings' do
+    assert_raises(TypeError) { sanitizer.sanitize(1) }
+  end
+
+  it 'keeps allowed elements and attributes' do
+    assert_equal '<p title="Greeting">Hi <b>there</b></p>', sanitizer.sanitize('<p title="Greeting">Hi <b>there</b></p>')
+    assert_equal '<a href="https://example.com">Link</a>', sanitizer.sanitize("<A HREF='https://example.com'>Link</A>")
+    assert_equal 'A<br>B<img src="/a.png" alt="A">', sanitizer.sanitize('A<br/>B<img src=/a.png alt=A />')
+  end
+
+  it 'removes disallowed attributes' do
+    assert_equal '<p>Hi</p>', sanitizer.sanitize('<p onclick="alert(1)" style="color: red">Hi</p>')
+    assert_equal '<img src="x">', sanitizer.sanitize('<img src=x onerror=alert(1)>')
+  end
+
+  it 'removes disallowed tags but keeps their text' do
+    assert_equal 'Hi there', sanitizer.sanitize('<div>Hi <font>there</font></div>')
+  end
+
+  it 'removes dangerous elements along with their content' do
+    assert_equal 'ab', sanitizer.sanitize('a<script>alert("</p>")</script>b')
+    assert_equal 'ab', sanitizer.sanitize('a<STYLE>p { color: red }</style >b')
+    assert_equal 'a', sanitizer.sanitize('a<textarea><b>never closed')
+  end
+
+  it 'removes comments and declarations' do
+    assert_equal 'ab', sanitizer.sanitize('a<!-- <b>comment</b> -->b')
+    assert_equal 'ab', sanitizer.sanitize('<!DOCTYPE html>a<?xml version="1.0"?>b')
+  end
+
+  it 'checks URL protocols' do
+    assert_equal '<a>x</a>', sanitizer.sanitize('<a href="javascript:alert(1)">x</a>')
+    assert_equal '<a>x</a>', sanitizer.sanitize('<a href=" JaVaScRiPt:alert(1)">x</a>')
+    assert_equal '<a>x</a>', sanitizer.sanitize("<a href=\"java\tscript:alert(1)\">x</a>")
+    assert_equal '<a>x</a>', sanitizer.sanitize('<a href="java&#115;cript:alert(1)">x</a>')
+    assert_equal '<a>x</a>', sanitizer.sanitize('<a href="data:text/html,hi">x</a>')
+    assert_equal '<a href="mailto:a@b.c">x</a>', sanitizer.sanitize('<a href="mailto:a@b.c">x</a>')
+  end
+
+  it 'allows relative URLs' do
+    assert_equal '<a href="/path?a=b:c">x</a>', sanitizer.sanitize('<a href="/path?a=b:c">x</a>')
+    assert_equal '<a href="#top">x</a>', sanitizer.sanitize('<a href="#top">x</a>')
+    assert_equal '<a href="page.html">x</a>', sanitizer.sanitize('<a href="page.html">x</a>')
+  end
+
+  it 'escapes text and attribute values' do
+    assert_equal '1 &lt; 2 &amp;&amp; 3 &gt; 2', sanitizer.sanitize('1 < 2 && 3 > 2')
+    assert_equal '<p title="&quot;a&quot; &lt;b&gt; &#39;c&#39;">x</p>', sanitizer.sanitize(%q(<p title='"a" <b> &#39;c&#39;'>x</p>))
+  end
+
+  it 'keeps valid character references' do
+    assert_equal '&amp; &copy; &#169; &#xA9;', sanitizer.sanitize('&amp; &copy; &#169; &#xA9;')
+    assert_equal '&amp;nope &amp;#; &amp;#x;', sanitizer.sanitize('&nope &#; &#x;')
+  end
+
+  it 'balances elements' do
+    assert_equal '<p>a <b>b</b></p>', sanitizer.sanitize('<p>a <b>b')
+    assert_equal '<p>a <b>b <i>c</i></b></p> d', sanitizer.sanitize('<p>a <b>b <i>c</p> d')
+    assert_equal 'a<b>b</b>', sanitizer.sanitize('</p>a<b>b</i></b></b>')
+  end
+
+  it 'drops unterminated tags at the end of the input' do
+    assert_equal 'a', sanitizer.sanitize('a<b title="unterminated')
+    assert_equal 'a', sanitizer.sanitize('a<p')
+  end
+
+  it 'limits nesting depth' do
+    html = '<b>' * 1000 + 'deep' + '</b>' * 1000
+    result = sanitizer.sanitize(html)
+
+    assert_equal 256, result.scan('<b>').length
+    assert_equal 256, result.scan('</b>').length
+    assert_includes result, 'deep'
+  end
+
+  it 'returns UTF-8 strings' do
+    assert_equal Encoding::UTF_8, sanitizer.sanitize('<b>café</b>').encoding
+    assert_equal '<b>café</b>', sanitizer.sanitize('<b>café</b>')
+  end
+
+  it 'is frozen by default' do
+    assert_predicate sanitizer, :frozen?
+    assert_raises(FrozenError) { sanitizer.send(:compile, [], [], [], {}) }
+  end
+
+  describe 'with a custom policy' do
+    let(:sanitizer) do
+      Berns::Sanitizer.new(
+        elements: %i[DIV a],
+        attributes: { all: %i[Class], a: %w[href] },
+        protocols: { href: %w[HTTPS] }
+      )
+    end
+
+    it 'normalizes names' do
+      assert_equal '<div class="a">x</div>', sanitizer.sanitize('<div class="a" id="b">x</div>')
+    end
+
+    it 'uses the given protocols' do
+      assert_equal '<a class="c">x</a>', sanitizer.sanitize('<a class="c" href="http://example.com">x</a>')
+      assert_equal '<a href="https://example.com">x</a>', sanitizer.sanitize('<a href="https://example.com">x</a>')
+    end
+
+    it 'drops elements outside the policy' do
+      assert_equal 'bold', sanitizer.sanitize('<b>bold</b>')
+    end
+  end
+end
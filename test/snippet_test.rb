@@ -0,0 +1,78 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe 'Berns.snippet' do
+  it 'handles nil' do
+    assert_nil Berns.snippet(nil, 10)
+  end
+
+  it 'raises an error for invalid arguments' do
+    assert_raises(TypeError) { Berns.snippet(1, 10) }
+    assert_raises(TypeError) { Berns.snippet('a', 'b') }
+    assert_raises(TypeError) { Berns.snippet('a', 10, omission: 1) }
+    assert_raises(ArgumentError) { Berns.snippet('a', -1) }
+    assert_raises(ArgumentError) { Berns.snippet('a', 1, nope: true) }
+  end
+
+  it 'sanitizes and escapes short strings without truncating them' do
+    assert_equal 'Hello &quot;world&quot; it&#39;s me', Berns.snippet(%(<p>Hello "world" it's me</p>), 100)
+    assert_equal 'abc', Berns.snippet('abc', 3)
+    assert_equal '', Berns.snippet('', 0)
+  end
+
+  it 'always returns a new UTF-8 string' do
+    string = 'abc'
+    result = Berns.snippet(string, 10)
+
+    refute_same string, result
+    assert_equal Encoding::UTF_8, result.encoding
+  end
+
+  it 'truncates to the length including the omission' do
+    assert_equal 'Hello w...', Berns.snippet('<b>Hello</b> world, again', 10)
+    assert_equal 'Hello wor…', Berns.snippet('Hello world', 10, omission: '…')
+    assert_equal 'Hello worl', Berns.snippet('Hello world', 10, omission: '')
+    assert_equal '...', Berns.snippet('Hello world', 0)
+  end
+
+  it 'escapes the omission' do
+    assert_equal 'a&lt;&gt;', Berns.snippet('abcdef', 3, omission: '<>')
+  end
+
+  it 'counts characters before escaping' do
+    assert_equal '&quot;&quot;...', Berns.snippet('""""""', 5)
+    assert_equal '&quot;&quot;&quot;', Berns.snippet('"""', 3)
+  end
+
+  it 'counts characters, not bytes, by default' do
+    assert_equal 'héllo…', Berns.snippet('héllo wörld', 6, omission: '…')
+    assert_equal '日本語', Berns.snippet('日本語', 3)
+  end
+
+  it 'truncates on codepoint boundaries when counting bytes' do
+    assert_equal 'hél...', Berns.snippet('héllo wörld', 7, bytes: true)
+    assert_equal 'hé...', Berns.snippet('héllo wörld', 6, bytes: true)
+    assert_equal '日', Berns.snippet('日本語テキスト', 5, omission: '', bytes: true)
+    assert_equal '日本語', Berns.snippet('日本語', 9, bytes: true)
+  end
+
+  it 'counts the omission in bytes when counting bytes' do
+    assert_equal 'ab…', Berns.snippet('abcdef', 5, omission: '…', bytes: true)
+  end
+
+  it 'counts invalid UTF-8 bytes as single characters' do
+    assert_equal "a\xFF...".b, Berns.snippet("a\xFFbcdef", 5).b
+  end
+
+  it 'matches sanitizing, truncating, and escaping separately' do
+    html = %(<article><h1>Title "quoted"</h1><p>It's <em>really</em> &amp; truly a long paragraph of text.</p></article>) * 10
+
+    [0, 1, 5, 20, 80, 1000].each do |length|
+      text = Berns.sanitize(html)
+      text = "#{ text[0, [length - 3, 0].max] }..." if text.length > length
+
+      assert_equal Berns.escape_html(text), Berns.snippet(html, length)
+    end
+  end
+end
@@ -0,0 +1,56 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe 'Berns.stats' do
+  if Berns.stats.nil?
+    it 'returns nil when built without stats' do
+      assert_nil Berns.stats
+      assert_nil Berns.reset_stats
+    end
+  else
+    before { Berns.reset_stats }
+
+    it 'counts calls and bytes per method' do
+      Berns.escape_html('a < b')
+      Berns.escape_html('clean')
+      Berns.div(class: 'x') { 'hi' }
+
+      methods = Berns.stats[:methods]
+
+      assert_equal({ calls: 2, bytes_in: 10, bytes_out: 13 }, methods[:escape_html])
+      assert_equal({ calls: 1, bytes_in: 2, bytes_out: 23 }, methods[:div])
+    end
+
+    it 'sums call sites with the same name' do
+      Berns.collapse_whitespace('clean')
+      Berns.collapse_whitespace("a  \n b")
+
+      assert_equal({ calls: 2, bytes_in: 11, bytes_out: 8 }, Berns.stats[:methods][:collapse_whitespace])
+    end
+
+    it 'counts clean and modified escapes' do
+      Berns.escape_html('clean')
+      Berns.escape_html!(+'a & b')
+      Berns.escape_html_all(['<', 'a', 'b'])
+
+      assert_equal({ clean: 3, modified: 2 }, Berns.stats[:escapes])
+    end
+
+    it 'counts allocations' do
+      Berns.to_attributes(class: 'a' * 1000, id: 'b' * 1000)
+
+      stats = Berns.stats
+
+      assert_operator stats[:allocations], :>, 0
+      assert_operator stats[:reallocations], :>, 0
+    end
+
+    it 'resets every counter' do
+      Berns.escape_html('<')
+      Berns.reset_stats
+
+      assert_equal({ methods: {}, escapes: { clean: 0, modified: 0 }, allocations: 0, reallocations: 0 }, Berns.stats)
+    end
+  end
+end
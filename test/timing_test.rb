@@ -0,0 +1,119 @@
+# frozen_string_literal: true
+require 'berns'
+require 'minitest/autorun'
+
+describe Berns::Timing do
+  before { Berns::Timing.reset }
+
+  it 'returns the same timing for the same name' do
+    assert_same Berns::Timing['timing/same'], Berns::Timing[:'timing/same']
+    assert_equal 'timing/same', Berns::Timing['timing/same'].name
+  end
+
+  it 'records every render of a named builder' do
+    builder = Berns::Builder.new(name: 'timing/builder') { |title| h1 { title } }
+    builder.call('One')
+    builder.call('Two')
+
+    timing = Berns::Timing['timing/builder']
+
+    assert_same timing, builder.timing
+    assert_equal 2, timing.calls
+    assert_equal 2, timing.exclusive.count
+    assert_equal({ count: 2, sum: 24, buckets: { 16 => 2 } }, timing.bytes.to_h)
+    assert_operator timing.inclusive.sum, :>, 0
+  end
+
+  it 'records compiled builders under the same name' do
+    Berns::Builder.new(name: 'timing/compiled') { |title:| h1 { title } }.compile.call(title: 'One')
+
+    assert_equal 1, Berns::Timing['timing/compiled'].calls
+  end
+
+  it 'records component renders on cache misses' do
+    component = Berns::Component.new(name: 'timing/component') { |label| span { label } }
+    component.call('a')
+    component.call('a')
+
+    assert_equal 1, Berns::Timing['timing/component'].calls
+  end
+
+  it 'leaves nested named renders out of exclusive time' do
+    inner = Berns::Builder.new(name: 'timing/inner') do
+      sleep 0.02
+      p { 'Inner' }
+    end
+
+    outer = Berns::Builder.new(name: 'timing/outer') do
+      div do
+        raw inner.call
+        raw inner.call
+      end
+    end
+
+    outer.call
+
+    inner_timing = Berns::Timing['timing/inner']
+    outer_timing = Berns::Timing['timing/outer']
+
+    assert_equal 2, inner_timing.calls
+    assert_equal inner_timing.inclusive.sum, inner_timing.exclusive.sum
+    assert_operator outer_timing.inclusive.sum, :>=, inner_timing.inclusive.sum
+    assert_operator outer_timing.exclusive.sum, :<, 10_000_000
+    assert_in_delta outer_timing.inclusive.sum - inner_timing.inclusive.sum, outer_timing.exclusive.sum, 1
+  end
+
+  it 'leaves unnamed builders in their parent exclusive time' do
+    inner = Berns::Builder.new { sleep 0.01 }
+    Berns::Builder.new(name: 'timing/unnamed') { raw inner.call }.call
+
+    timing = Berns::Timing['timing/unnamed']
+
+    assert_equal timing.inclusive.sum, timing.exclusive.sum
+    assert_operator timing.exclusive.sum, :>=, 10_000_000
+  end
+
+  it 'keeps separate totals per thread' do
+    inner = Berns::Builder.new(name: 'timing/thread-inner') { sleep 0.01 }
+    Thread.new { inner.call }.join
+    Berns::Builder.new(name: 'timing/thread-outer') { 'x' }.call
+
+    timing = Berns::Timing['timing/thread-outer']
+
+    assert_equal timing.inclusive.sum, timing.exclusive.sum
+  end
+
+  it 'returns every timing as a Hash' do
+    Berns::Builder.new(name: 'timing/hash') { 'x' }.call
+
+    hash = Berns::Timing.to_h['timing/hash']
+
+    assert_equal 1, hash[:calls]
+    assert_equal %i[calls inclusive exclusive bytes], hash.keys
+    assert_equal({ count: 1, sum: 1, buckets: { 1 => 1 } }, hash[:bytes])
+  end
+
+  it 'resets every timing' do
+    Berns::Builder.new(name: 'timing/reset') { 'x' }.call
+    Berns::Timing.reset
+
+    assert_equal 0, Berns::Timing['timing/reset'].calls
+  end
+
+  it 'formats every timing as Prometheus text' do
+    Berns::Builder.new(name: %(timing/"prometheus")) { 'x' * 100 }.call
+
+    text = Berns::Timing.prometheus
+    label = 'template="timing/\"prometheus\""'
+
+    assert_includes text, "# TYPE berns_render_seconds histogram\n"
+    assert_includes text, "# TYPE berns_render_exclusive_seconds histogram\n"
+    assert_includes text, "# TYPE berns_render_bytes histogram\n"
+    assert_includes text, %(berns_render_bytes_bucket{#{ label },le="64"} 0\n)
+    assert_includes text, %(berns_render_bytes_bucket{#{ label },le="128"} 1\n)
+    assert_includes text, %(berns_render_bytes_bucket{#{ label },le="+Inf"} 1\n)
+    assert_includes text, %(berns_render_bytes_sum{#{ label }} 100\n)
+    assert_includes text, %(berns_render_seconds_count{#{ label }} 1\n)
+    assert_match(/^berns_render_seconds_bucket\{#{ Regexp.escape(label) },le="1\.024e-06"\} \d+$/, text)
+  end
+end
@@ -34,8 +34,24 @@ describe 'Berns#to_attribute' do
     assert_equal %(foo="&lt;b&gt;bar&lt;/b&gt;-&quot;with &#39;quotes&#39;&quot;"), Berns.to_attribute('foo', %(<b>bar</b>-"with 'quotes'"))
   end
 
-  it 'does not escape the attribute name itself' do
-    assert_equal %(<b>foo="&lt;b&gt;bar&lt;/b&gt;-&quot;with &#39;quotes&#39;&quot;"), Berns.to_attribute('<b>foo', %(<b>bar</b>-"with 'quotes'"))
+  it 'raises an error for invalid attribute names' do
+    assert_raises(ArgumentError) { Berns.to_attribute('<b>foo', 'bar') }
+    assert_raises(ArgumentError) { Berns.to_attribute(:'foo"', 'bar') }
+    assert_raises(ArgumentError) { Berns.to_attribute('foo bar', 'bar') }
+    assert_raises(ArgumentError) { Berns.to_attribute(:data, { 'x>y' => 'bar' }) }
+    assert_raises(ArgumentError) { Berns.to_attribute(:data, { "x\ny": 'bar' }) }
+    assert_raises(ArgumentError) { Berns.to_attribute(:data, { 'x=y'.to_sym => 'bar' }) }
+    assert_raises(ArgumentError) { Berns.to_attribute(:data, { x: { 'a/b' => 'bar' } }) }
+  end
+
+  it 'renders a bare attribute for Symbol keys with empty values' do
+    assert_equal 'class', Berns.to_attribute(:class, '')
+    assert_equal 'class', Berns.to_attributes(class: '')
+    assert_equal 'id="x" hidden', Berns.to_attributes(id: 'x', hidden: '')
+  end
+
+  it 'allows attribute names outside of ASCII' do
+    assert_equal %(data-café="bar"), Berns.to_attribute(:data, { café: 'bar' })
   end
 
   it 'handles flat hashes' do
@@ -39,4 +39,42 @@ describe 'Berns#to_attributes' do
 
     assert_equal expected, Berns.to_attributes(huge)
   end
+
+  it 'handles hashes of the same shape but very different sizes' do
+    long = { class: 'a' * 10_000, id: 'b' * 5_000 }
+    short = { class: 'a', id: 'b' }
+
+    assert_equal %(class="#{ 'a' * 10_000 }" id="#{ 'b' * 5_000 }"), Berns.to_attributes(long)
+    assert_equal 'class="a" id="b"', Berns.to_attributes(short)
+    assert_equal %(class="#{ 'a' * 10_000 }" id="#{ 'b' * 5_000 }"), Berns.to_attributes(long)
+  end
+
+  it 'writes empty values as bare attribute names' do
+    assert_equal 'class id data-a', Berns.to_attributes(class: '', 'id' => '', data: { a: '' })
+    assert_equal 'a', Berns.to_attributes(nil => { a: '' })
+    assert_equal '', Berns.to_attributes(nil => nil)
+  end
+
+  it 'handles deeply nested hashes' do
+    nested = (1..30).reverse_each.inject('deep') { |value, level| { "l#{ level }" => value } }
+
+    assert_equal %(#{ (1..30).map { |level| "l#{ level }" }.join('-') }="deep"), Berns.to_attributes(nested)
+  end
+
+  it 'raises an error for hashes nested too deeply' do
+    nested = (1..40).inject('deep') { |value, _| { a: value } }
+
+    assert_raises(ArgumentError) { Berns.to_attributes(nested) }
+
+    recursive = {}
+    recursive[:data] = recursive
+
+    assert_raises(ArgumentError) { Berns.to_attributes(recursive) }
+    assert_raises(ArgumentError) { Berns.to_attribute(:data, recursive) }
+  end
+
+  it 'raises an error for invalid nested keys' do
+    assert_raises(ArgumentError) { Berns.to_attributes(data: { a: { 'b c' => 1 } }) }
+    assert_raises(TypeError) { Berns.to_attributes(data: { a: { 1 => 1 } }) }
+  end
 end
@@ -0,0 +1,96 @@
+# frozen_string_literal: true
+require 'berns'
+require 'cgi'
+require 'minitest/autorun'
+
+describe 'Berns.unescape_html' do
+  it 'raises an error for non-strings' do
+    assert_raises(TypeError) { Berns.unescape_html(nil) }
+    assert_raises(TypeError) { Berns.unescape_html(1) }
+  end
+
+  it 'returns the string itself when there is nothing to unescape' do
+    string = 'Nothing to unescape here. ' * 4
+
+    assert_same string, Berns.unescape_html(string)
+  end
+
+  it 'returns the string itself when no ampersand starts a reference' do
+    string = 'a & b &; &# &#x; &nosuchentity;'
+
+    assert_same string, Berns.unescape_html(string)
+  end
+
+  it 'reverses escape_html' do
+    string = %(<a href="/?a=1&b=2" title='x'>Fish & chips</a>)
+
+    assert_equal string, Berns.unescape_html(Berns.escape_html(string))
+  end
+
+  it 'decodes named references' do
+    assert_equal '© ™ … é ∉', Berns.unescape_html('&copy; &trade; &hellip; &eacute; &notin;')
+    assert_equal '⟨x⟩', Berns.unescape_html('&LeftAngleBracket;x&RightAngleBracket;')
+  end
+
+  it 'decodes named references that are more than one codepoint' do
+    assert_equal '≫⃒', Berns.unescape_html('&nGt;')
+    assert_equal '≫⃒' * 1000, Berns.unescape_html('&nGt;' * 1000)
+  end
+
+  it 'decodes legacy named references without a semicolon' do
+    assert_equal '© 2024', Berns.unescape_html('&copy 2024')
+    assert_equal '©2024', Berns.unescape_html('&copy2024')
+    assert_equal '¬it;', Berns.unescape_html('&notit;')
+    assert_equal 'a & b', Berns.unescape_html('a &amp b')
+    assert_equal '&trade', Berns.unescape_html('&trade')
+  end
+
+  it 'is case sensitive' do
+    assert_equal '& &AMp;', Berns.unescape_html('&AMP; &AMp;')
+    assert_equal 'É é', Berns.unescape_html('&Eacute; &eacute;')
+  end
+
+  it 'decodes decimal and hexadecimal references' do
+    assert_equal "A A A \u{1F600} \u{1F600}", Berns.unescape_html('&#65; &#x41; &#X41 &#128512; &#x1f600;')
+  end
+
+  it 'replaces numeric references that are not characters' do
+    assert_equal '�' * 4, Berns.unescape_html('&#0;&#xD800;&#x110000;&#99999999999999999999;')
+  end
+
+  it 'decodes C1 control characters as Windows-1252' do
+    assert_equal '€ ”', Berns.unescape_html('&#128; &#x94;')
+    assert_equal "\u0081 \u009D", Berns.unescape_html('&#x81; &#157;')
+  end
+
+  it 'returns a UTF-8 string that is not html_safe' do
+    result = Berns.unescape_html('&lt;b&gt;'.b)
+
+    assert_equal Encoding::UTF_8, result.encoding
+    assert_equal '<b>', result
+    refute_kind_of Berns::SafeString, result
+  end
+
+  it 'finds references anywhere in long strings' do
+    (0..40).each do |index|
+      string = 'x' * 40
+      string[index, 0] = '&amp;'
+
+      assert_equal string.sub('&amp;', '&'), Berns.unescape_html(string), "reference at #{ index }"
+    end
+  end
+
+  it 'handles references cut off by the end of the string' do
+    assert_equal 'x&', Berns.unescape_html('x&')
+    assert_equal 'x&#', Berns.unescape_html('x&#')
+    assert_equal 'x&#x', Berns.unescape_html('x&#x')
+    assert_equal 'x<', Berns.unescape_html('x&lt')
+    assert_equal 'x&Aacut', Berns.unescape_html('x&Aacut')
+  end
+
+  it 'matches CGI.unescapeHTML for what CGI decodes' do
+    string = %(&lt;p class=&quot;x&quot;&gt;It&#39;s &amp; it&apos;s&lt;/p&gt; &#x26; &#38;) * 8
+
+    assert_equal CGI.unescapeHTML(string), Berns.unescape_html(string)
+  end
+end